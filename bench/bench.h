@@ -0,0 +1,44 @@
+#ifndef DSALIB_BENCH_H
+#define DSALIB_BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * @brief Minimal helpers shared by the benchmark programs.
+ *
+ * Benchmarks are plain executables (not ctest targets). Configure with
+ * -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+ */
+
+/* Wall-clock time in nanoseconds. */
+static inline double bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* xorshift64* generator; state must be non-zero. */
+static inline uint64_t bench_rand(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/* Keeps results alive so the optimizer cannot drop the measured work. */
+static volatile long long bench_sink;
+
+static inline void bench_consume(long long value) {
+    bench_sink += value;
+}
+
+/* Prints one result row: label, problem size and time per element. */
+static inline void bench_report(const char* label, size_t elements, double elapsed_ns) {
+    printf("%-32s %12zu  %10.3f ns/elem\n", label, elements, elements ? elapsed_ns / (double)elements : 0.0);
+}
+
+#endif // DSALIB_BENCH_H
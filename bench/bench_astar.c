@@ -0,0 +1,133 @@
+#include "bench.h"
+
+#include <dsalib/graph/astar.h>
+#include <dsalib/util/parallel.h>
+
+#include <stdlib.h>
+
+/*
+ * Point-to-point queries on a side x side 8-connected grid with random
+ * walls and terrain costs: Dijkstra, bidirectional Dijkstra and A* on a
+ * reused search state, A* with freshly zeroed state for every query (what
+ * per-query arrays cost), then A* with one state per thread.
+ * Usage: bench_astar [side] [queries] [max_threads]
+ */
+
+typedef struct {
+    const dsalib_grid_t* grid;
+    const uint32_t* pairs;       // Source, target of each query
+    dsalib_search_state_t** states; // One per worker
+    long long checksum[64];
+} work_t;
+
+static void run_queries(void* ctx, size_t begin, size_t end, size_t worker) {
+    work_t* w = ctx;
+    long long sum = 0;
+    for (size_t q = begin; q < end; q++) {
+        sum += dsalib_astar_grid(w->grid, w->pairs[2 * q], w->pairs[2 * q + 1], dsalib_heuristic_octile,
+                                 (void*)w->grid, w->states[worker]);
+    }
+    w->checksum[worker] = sum;
+}
+
+/* Same estimate, but called through the pointer like any user heuristic. */
+static long long octile_callback(void* ctx, uint32_t node, uint32_t goal) {
+    return dsalib_heuristic_octile(ctx, node, goal);
+}
+
+static void report(const char* label, size_t queries, double elapsed_ns, size_t expanded) {
+    printf("%-32s %12zu  %10.0f queries/s  %10.0f expanded/query\n", label, queries,
+           (double)queries / (elapsed_ns / 1e9), (double)expanded / (double)queries);
+}
+
+int main(int argc, char** argv) {
+    uint32_t side = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 1024;
+    size_t queries = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 100;
+    size_t max_threads = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : dsalib_parallel_hardware_threads();
+    if (max_threads == 0) max_threads = 1;
+    if (max_threads > 64) max_threads = 64;
+    uint64_t rng = 0x44;
+    size_t n = (size_t)side * side;
+    uint8_t* cells = malloc(n);
+    for (size_t i = 0; i < n; i++) {
+        uint64_t r = bench_rand(&rng) % 100;
+        cells[i] = r < 20 ? 0 : r < 90 ? 1 : 3; // 20% walls, 10% rough terrain
+    }
+    dsalib_grid_t grid = {cells, side, side, true};
+    uint32_t* pairs = malloc(2 * queries * sizeof(uint32_t));
+    for (size_t i = 0; i < 2 * queries; i++) {
+        do {
+            pairs[i] = (uint32_t)(bench_rand(&rng) % n);
+        } while (!cells[pairs[i]]);
+    }
+    long long checksum = 0;
+    size_t expanded = 0;
+
+    printf("%-32s %12s  %s\n", "strategy", "queries", "throughput");
+    printf("%ux%u grid\n", side, side);
+
+    dsalib_search_state_t* state = dsalib_search_state_create(n);
+    double start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        checksum += dsalib_astar_grid(&grid, pairs[2 * q], pairs[2 * q + 1], NULL, NULL, state);
+        expanded += state->expanded;
+    }
+    report("  dijkstra, reused state", queries, bench_now_ns() - start, expanded);
+
+    expanded = 0;
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        checksum += dsalib_bidirectional_dijkstra_grid(&grid, pairs[2 * q], pairs[2 * q + 1], state);
+        expanded += state->expanded;
+    }
+    report("  bidirectional dijkstra", queries, bench_now_ns() - start, expanded);
+
+    expanded = 0;
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        checksum += dsalib_astar_grid(&grid, pairs[2 * q], pairs[2 * q + 1], octile_callback, &grid, state);
+        expanded += state->expanded;
+    }
+    report("  A*, octile via callback", queries, bench_now_ns() - start, expanded);
+
+    expanded = 0;
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        checksum += dsalib_astar_grid(&grid, pairs[2 * q], pairs[2 * q + 1], dsalib_heuristic_octile, &grid, state);
+        expanded += state->expanded;
+    }
+    report("  A*, octile built-in", queries, bench_now_ns() - start, expanded);
+
+    expanded = 0;
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        dsalib_search_state_t* fresh = dsalib_search_state_create(n);
+        checksum += dsalib_astar_grid(&grid, pairs[2 * q], pairs[2 * q + 1], dsalib_heuristic_octile, &grid, fresh);
+        expanded += fresh->expanded;
+        dsalib_search_state_destroy(fresh);
+    }
+    report("  A*, fresh state per query", queries, bench_now_ns() - start, expanded);
+
+    dsalib_search_state_t* states[64];
+    for (size_t t = 0; t < max_threads; t++) {
+        states[t] = dsalib_search_state_create(n);
+    }
+    work_t w = {&grid, pairs, states, {0}};
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        char label[64];
+        start = bench_now_ns();
+        dsalib_parallel_for(queries, threads, run_queries, &w);
+        snprintf(label, sizeof(label), "  A*, %zu threads", threads);
+        report(label, queries, bench_now_ns() - start, expanded);
+        for (size_t t = 0; t < threads; t++) checksum += w.checksum[t];
+    }
+
+    for (size_t t = 0; t < max_threads; t++) {
+        dsalib_search_state_destroy(states[t]);
+    }
+    dsalib_search_state_destroy(state);
+    free(pairs);
+    free(cells);
+    bench_consume(checksum);
+    return 0;
+}
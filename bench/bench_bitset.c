@@ -0,0 +1,120 @@
+#include "bench.h"
+
+#include <dsalib/containers/bitset.h>
+#include <dsalib/containers/roaring.h>
+#include <dsalib/search/binary_search.h>
+#include <dsalib/search/sorted_set.h>
+
+#include <stdlib.h>
+
+/*
+ * Sets over a universe of `universe` ints at several densities, stored as
+ * sorted int arrays (the old approach), a dense bitset and a roaring set.
+ * Measures conversion in both directions, intersection, membership
+ * queries, and rank/select on the bitset with its index; prints the bytes
+ * each representation needs.
+ * Usage: bench_bitset [universe] [queries]
+ */
+
+/* Sorted, duplicate-free random set of about universe * percent / 100 values. */
+static size_t make_set(int* out, size_t universe, double percent, uint64_t* rng) {
+    size_t n = 0;
+    uint64_t threshold = (uint64_t)(percent / 100.0 * (double)UINT64_MAX);
+    for (size_t i = 0; i < universe; i++) {
+        if (bench_rand(rng) <= threshold) out[n++] = (int)i;
+    }
+    return n;
+}
+
+int main(int argc, char** argv) {
+    size_t universe = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : (size_t)1 << 24;
+    size_t queries = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000000;
+    double densities[] = {0.1, 5, 50};
+    uint64_t rng = 0x43;
+    int* a = malloc(universe * sizeof(int));
+    int* b = malloc(universe * sizeof(int));
+    int* out = malloc(universe * sizeof(int));
+    int* probes = malloc(queries * sizeof(int));
+    for (size_t i = 0; i < queries; i++) {
+        probes[i] = (int)(bench_rand(&rng) % universe);
+    }
+    long long checksum = 0;
+
+    printf("%-32s %12s  %s\n", "operation", "elements", "time");
+    for (size_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+        size_t na = make_set(a, universe, densities[d], &rng);
+        size_t nb = make_set(b, universe, densities[d], &rng);
+        printf("-- density %.1f%% (%zu values)\n", densities[d], na);
+
+        double start = bench_now_ns();
+        dsalib_bitset_t* ba = dsalib_bitset_from_array(a, na, universe);
+        bench_report("  array -> bitset", na, bench_now_ns() - start);
+        start = bench_now_ns();
+        checksum += (long long)dsalib_bitset_to_array(ba, out);
+        bench_report("  bitset -> array", na, bench_now_ns() - start);
+        start = bench_now_ns();
+        dsalib_roaring_t* ra = dsalib_roaring_from_array(a, na);
+        bench_report("  array -> roaring", na, bench_now_ns() - start);
+        start = bench_now_ns();
+        checksum += (long long)dsalib_roaring_to_array(ra, out);
+        bench_report("  roaring -> array", na, bench_now_ns() - start);
+        dsalib_bitset_t* bb = dsalib_bitset_from_array(b, nb, universe);
+        dsalib_roaring_t* rb = dsalib_roaring_from_array(b, nb);
+
+        start = bench_now_ns();
+        checksum += (long long)dsalib_sorted_intersect(a, na, b, nb, out);
+        bench_report("  intersect, sorted arrays", na + nb, bench_now_ns() - start);
+        start = bench_now_ns();
+        checksum += (long long)dsalib_bitset_and_count(ba, bb);
+        bench_report("  intersect, bitset and_count", na + nb, bench_now_ns() - start);
+        start = bench_now_ns();
+        dsalib_roaring_t* both = dsalib_roaring_and(ra, rb);
+        bench_report("  intersect, roaring and", na + nb, bench_now_ns() - start);
+        checksum += (long long)dsalib_roaring_cardinality(both);
+        dsalib_roaring_destroy(both);
+
+        start = bench_now_ns();
+        for (size_t i = 0; i < queries; i++) {
+            checksum += dsalib_binary_search(a, na, probes[i]) >= 0;
+        }
+        bench_report("  contains, binary search", queries, bench_now_ns() - start);
+        start = bench_now_ns();
+        for (size_t i = 0; i < queries; i++) {
+            checksum += dsalib_bitset_test(ba, (size_t)probes[i]);
+        }
+        bench_report("  contains, bitset", queries, bench_now_ns() - start);
+        start = bench_now_ns();
+        for (size_t i = 0; i < queries; i++) {
+            checksum += dsalib_roaring_contains(ra, probes[i]);
+        }
+        bench_report("  contains, roaring", queries, bench_now_ns() - start);
+
+        dsalib_bitset_build_index(ba);
+        start = bench_now_ns();
+        for (size_t i = 0; i < queries; i++) {
+            checksum += (long long)dsalib_bitset_rank(ba, (size_t)probes[i]);
+        }
+        bench_report("  rank, bitset index", queries, bench_now_ns() - start);
+        start = bench_now_ns();
+        for (size_t i = 0; i < queries; i++) {
+            size_t pos = 0;
+            dsalib_bitset_select(ba, (size_t)probes[i] % na, &pos);
+            checksum += (long long)pos;
+        }
+        bench_report("  select, bitset index", queries, bench_now_ns() - start);
+
+        printf("  bytes: array %zu, bitset %zu, roaring %zu\n", na * sizeof(int),
+               (ba->num_words + ba->num_words / 8 + 1) * sizeof(uint64_t), dsalib_roaring_memory(ra));
+        dsalib_bitset_destroy(ba);
+        dsalib_bitset_destroy(bb);
+        dsalib_roaring_destroy(ra);
+        dsalib_roaring_destroy(rb);
+    }
+
+    free(a);
+    free(b);
+    free(out);
+    free(probes);
+    bench_consume(checksum);
+    return 0;
+}
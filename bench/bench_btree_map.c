@@ -0,0 +1,134 @@
+#include "bench.h"
+
+#include <dsalib/containers/btree_map.h>
+
+#include <stdlib.h>
+
+/*
+ * Mixed read/write workloads on the B+-tree map versus a plain unbalanced
+ * BST with one malloc'd node per key (the C-BST design). dsalib has no hash
+ * map yet, so that comparison is not included.
+ * Usage: bench_btree_map [keys] [operations]
+ */
+
+typedef struct bst_node {
+    int key;
+    int value;
+    struct bst_node* left;
+    struct bst_node* right;
+} bst_node_t;
+
+static bst_node_t* bst_insert(bst_node_t* root, int key, int value) {
+    bst_node_t** link = &root;
+    while (*link) {
+        if (key == (*link)->key) {
+            (*link)->value = value;
+            return root;
+        }
+        link = key < (*link)->key ? &(*link)->left : &(*link)->right;
+    }
+    bst_node_t* node = malloc(sizeof(bst_node_t));
+    node->key = key;
+    node->value = value;
+    node->left = NULL;
+    node->right = NULL;
+    *link = node;
+    return root;
+}
+
+static bst_node_t* bst_find(bst_node_t* root, int key) {
+    while (root && root->key != key) {
+        root = key < root->key ? root->left : root->right;
+    }
+    return root;
+}
+
+static void bst_destroy(bst_node_t* root) {
+    if (!root) return;
+    bst_destroy(root->left);
+    bst_destroy(root->right);
+    free(root);
+}
+
+static void run_workload(size_t keys, size_t ops, int write_percent) {
+    uint64_t rng = 0x28 + (uint64_t)write_percent;
+    int universe = (int)(keys * 2);
+
+    dsalib_btree_map_t* map = dsalib_btree_map_create();
+    bst_node_t* bst = NULL;
+    for (size_t i = 0; i < keys; i++) {
+        int key = (int)(bench_rand(&rng) % (uint64_t)universe);
+        dsalib_btree_map_insert(map, key, key);
+        bst = bst_insert(bst, key, key);
+    }
+
+    uint64_t seed = rng;
+    long long hits = 0;
+    double start = bench_now_ns();
+    for (size_t i = 0; i < ops; i++) {
+        uint64_t r = bench_rand(&rng);
+        int key = (int)((r >> 8) % (uint64_t)universe);
+        if ((int)(r % 100) < write_percent) {
+            dsalib_btree_map_insert(map, key, (int)i);
+        } else {
+            hits += dsalib_btree_map_find(map, key, NULL);
+        }
+    }
+    double btree_ns = bench_now_ns() - start;
+
+    rng = seed;
+    start = bench_now_ns();
+    for (size_t i = 0; i < ops; i++) {
+        uint64_t r = bench_rand(&rng);
+        int key = (int)((r >> 8) % (uint64_t)universe);
+        if ((int)(r % 100) < write_percent) {
+            bst = bst_insert(bst, key, (int)i);
+        } else {
+            hits += bst_find(bst, key) != NULL;
+        }
+    }
+    double bst_ns = bench_now_ns() - start;
+    bench_consume(hits);
+
+    char label[64];
+    snprintf(label, sizeof(label), "btree_map %d%% writes", write_percent);
+    bench_report(label, ops, btree_ns);
+    snprintf(label, sizeof(label), "bst %d%% writes", write_percent);
+    bench_report(label, ops, bst_ns);
+
+    dsalib_btree_map_destroy(map);
+    bst_destroy(bst);
+}
+
+int main(int argc, char** argv) {
+    size_t keys = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    size_t ops = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 5000000;
+
+    printf("%-32s %12s  %s\n", "workload", "operations", "time");
+    run_workload(keys, ops, 0);
+    run_workload(keys, ops, 10);
+    run_workload(keys, ops, 50);
+
+    // Bulk load and full range scan.
+    int* sorted = malloc(keys * sizeof(int));
+    for (size_t i = 0; i < keys; i++) {
+        sorted[i] = (int)(i * 2);
+    }
+    double start = bench_now_ns();
+    dsalib_btree_map_t* map = dsalib_btree_map_bulk_load(sorted, sorted, keys);
+    bench_report("bulk_load", keys, bench_now_ns() - start);
+
+    dsalib_btree_map_iter_t it = dsalib_btree_map_seek(map, 0);
+    long long sum = 0;
+    int value;
+    start = bench_now_ns();
+    while (dsalib_btree_map_iter_next(&it, NULL, &value)) {
+        sum += value;
+    }
+    bench_report("range scan (per key)", keys, bench_now_ns() - start);
+    bench_consume(sum);
+
+    dsalib_btree_map_destroy(map);
+    free(sorted);
+    return 0;
+}
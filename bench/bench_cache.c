@@ -0,0 +1,112 @@
+#include "bench.h"
+
+#include <dsalib/containers/cache.h>
+#include <dsalib/util/parallel.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * Read-through caching of a Zipfian key trace (get, put on miss): hit
+ * ratio and time per request for LRU, CLOCK and S3-FIFO at cache sizes of
+ * 1% and 10% of the key space and two skews, then the sharded cache at
+ * 1..N threads (S3-FIFO, 16 shards), each thread replaying its own slice
+ * of the trace.
+ * Usage: bench_cache [keys] [requests] [max_threads]
+ */
+
+/* Zipfian ranks in [0, n) by the Gray et al. method (as used by YCSB). */
+static void fill_zipf(int* trace, size_t size, size_t n, double theta, uint64_t* rng) {
+    double zetan = 0.0;
+    for (size_t i = 1; i <= n; i++) {
+        zetan += 1.0 / pow((double)i, theta);
+    }
+    double zeta2 = 1.0 + 1.0 / pow(2.0, theta);
+    double alpha = 1.0 / (1.0 - theta);
+    double eta = (1.0 - pow(2.0 / (double)n, 1.0 - theta)) / (1.0 - zeta2 / zetan);
+    for (size_t i = 0; i < size; i++) {
+        double u = (double)(bench_rand(rng) >> 11) / 9007199254740992.0;
+        double uz = u * zetan;
+        size_t rank;
+        if (uz < 1.0) {
+            rank = 0;
+        } else if (uz < zeta2) {
+            rank = 1;
+        } else {
+            rank = (size_t)((double)n * pow(eta * u - eta + 1.0, alpha));
+        }
+        trace[i] = (int)(rank < n ? rank : n - 1);
+    }
+}
+
+typedef struct {
+    dsalib_sharded_cache_t* cache;
+    const int* trace;
+} replay_t;
+
+static void replay_sharded(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    replay_t* r = ctx;
+    for (size_t i = begin; i < end; i++) {
+        int key = r->trace[i];
+        if (!dsalib_sharded_cache_get(r->cache, key, NULL)) {
+            dsalib_sharded_cache_put(r->cache, key, key);
+        }
+    }
+}
+
+static double hit_ratio(dsalib_cache_stats_t stats) {
+    uint64_t total = stats.hits + stats.misses;
+    return total ? (double)stats.hits / (double)total : 0.0;
+}
+
+int main(int argc, char** argv) {
+    size_t keys = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    size_t requests = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 10000000;
+    size_t max_threads = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : dsalib_parallel_hardware_threads();
+    if (max_threads == 0) max_threads = 1;
+    uint64_t rng = 0x41;
+    double thetas[] = {0.7, 0.99};
+    size_t percents[] = {1, 10};
+    dsalib_cache_policy_t policies[] = {DSALIB_CACHE_LRU, DSALIB_CACHE_CLOCK, DSALIB_CACHE_S3FIFO};
+    const char* names[] = {"LRU", "CLOCK", "S3-FIFO"};
+    int* trace = malloc(requests * sizeof(int));
+
+    printf("%-32s %12s  %s\n", "strategy", "requests", "time");
+    for (int t = 0; t < 2; t++) {
+        fill_zipf(trace, requests, keys, thetas[t], &rng);
+        for (int c = 0; c < 2; c++) {
+            size_t capacity = keys * percents[c] / 100;
+            printf("zipf %.2f, cache %zu%% of %zu keys\n", thetas[t], percents[c], keys);
+            for (int p = 0; p < 3; p++) {
+                char label[64];
+                dsalib_cache_t* cache = dsalib_cache_create(capacity, policies[p]);
+                double start = bench_now_ns();
+                for (size_t i = 0; i < requests; i++) {
+                    if (!dsalib_cache_get(cache, trace[i], NULL)) {
+                        dsalib_cache_put(cache, trace[i], trace[i]);
+                    }
+                }
+                double elapsed = bench_now_ns() - start;
+                snprintf(label, sizeof(label), "  %s, hit ratio %.4f", names[p], hit_ratio(dsalib_cache_stats(cache)));
+                bench_report(label, requests, elapsed);
+                dsalib_cache_destroy(cache);
+            }
+
+            for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+                char label[64];
+                replay_t r = {dsalib_sharded_cache_create(0, capacity, DSALIB_CACHE_S3FIFO), trace};
+                double start = bench_now_ns();
+                dsalib_parallel_for(requests, threads, replay_sharded, &r);
+                double elapsed = bench_now_ns() - start;
+                snprintf(label, sizeof(label), "  sharded, %zu threads, hit %.4f", threads,
+                         hit_ratio(dsalib_sharded_cache_stats(r.cache)));
+                bench_report(label, requests, elapsed);
+                dsalib_sharded_cache_destroy(r.cache);
+            }
+        }
+    }
+
+    free(trace);
+    return 0;
+}
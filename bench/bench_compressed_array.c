@@ -0,0 +1,78 @@
+#include "bench.h"
+
+#include <dsalib/containers/compressed_array.h>
+#include <dsalib/search/binary_search.h>
+
+#include <stdlib.h>
+
+/*
+ * Memory per value and query cost of the bit-packed compressed array versus
+ * the plain int array searched with dsalib_lower_bound().
+ * Usage: bench_compressed_array [elements] [max_gap]
+ */
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    int max_gap = argc > 2 ? atoi(argv[2]) : 1000;
+    size_t q = 1000000;
+    uint64_t rng = 0x31;
+
+    int* arr = malloc(n * sizeof(int));
+    int value = 0;
+    for (size_t i = 0; i < n; i++) {
+        value += (int)(bench_rand(&rng) % (uint64_t)max_gap);
+        arr[i] = value;
+    }
+    int* queries = malloc(q * sizeof(int));
+    for (size_t i = 0; i < q; i++) {
+        queries[i] = (int)(bench_rand(&rng) % (uint64_t)(value + 1));
+    }
+
+    double start = bench_now_ns();
+    dsalib_compressed_array_t* array = dsalib_compressed_array_create(arr, n);
+    double build = bench_now_ns() - start;
+    if (!array) return 1;
+
+    size_t packed = dsalib_compressed_array_memory(array);
+    printf("%zu values, gaps < %d\n", n, max_gap);
+    printf("%-32s %12.3f bytes/value\n", "int array", (double)sizeof(int));
+    printf("%-32s %12.3f bytes/value (%.2fx smaller)\n", "compressed_array", (double)packed / (double)n,
+           (double)(n * sizeof(int)) / (double)packed);
+    bench_report("build", n, build);
+
+    long long sum = 0;
+    start = bench_now_ns();
+    for (size_t i = 0; i < q; i++) {
+        sum += (long long)dsalib_lower_bound(arr, n, queries[i]);
+    }
+    bench_report("lower_bound (int array)", q, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < q; i++) {
+        sum -= (long long)dsalib_compressed_array_lower_bound(array, queries[i]);
+    }
+    bench_report("lower_bound (compressed)", q, bench_now_ns() - start);
+    if (sum != 0) {
+        fprintf(stderr, "results differ\n");
+        return 1;
+    }
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < q; i++) {
+        sum += dsalib_compressed_array_contains(array, queries[i]);
+    }
+    bench_report("contains (compressed)", q, bench_now_ns() - start);
+
+    int* decoded = malloc(n * sizeof(int));
+    start = bench_now_ns();
+    dsalib_compressed_array_decode(array, decoded);
+    bench_report("sequential decode", n, bench_now_ns() - start);
+    sum += decoded[n / 2];
+
+    bench_consume(sum);
+    dsalib_compressed_array_destroy(array);
+    free(decoded);
+    free(queries);
+    free(arr);
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include "bench.h"
+
+#include <dsalib/containers/btree_map.h>
+#include <dsalib/containers/concurrent_map.h>
+#include <dsalib/util/parallel.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+
+/*
+ * Mixed find/insert/erase throughput at several read ratios and 1..N
+ * threads: a btree_map behind one global mutex vs the sharded concurrent
+ * map. Keys are drawn uniformly from [0, 2 * keys), so lookups hit about
+ * half the time and the map size stays near keys.
+ * Usage: bench_concurrent_map [keys] [ops_per_thread] [max_threads]
+ */
+
+typedef struct {
+    dsalib_concurrent_map_t* map;
+    dsalib_btree_map_t* locked;
+    pthread_mutex_t lock;
+    size_t ops;
+    unsigned read_percent;
+    int key_range;
+} workload_t;
+
+static void run_sharded(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)begin;
+    (void)end;
+    workload_t* w = ctx;
+    uint64_t rng = 0x40 + worker * 0x9E3779B97F4A7C15ULL;
+    long long sum = 0;
+    for (size_t i = 0; i < w->ops; i++) {
+        uint64_t r = bench_rand(&rng);
+        int key = (int)((r >> 8) % (uint64_t)w->key_range);
+        unsigned dice = (unsigned)(r % 100);
+        int value;
+        if (dice < w->read_percent) {
+            if (dsalib_concurrent_map_find(w->map, key, &value)) sum += value;
+        } else if (dice % 2) {
+            dsalib_concurrent_map_insert(w->map, key, (int)i);
+        } else {
+            dsalib_concurrent_map_erase(w->map, key);
+        }
+    }
+    bench_consume(sum);
+}
+
+static void run_locked(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)begin;
+    (void)end;
+    workload_t* w = ctx;
+    uint64_t rng = 0x40 + worker * 0x9E3779B97F4A7C15ULL;
+    long long sum = 0;
+    for (size_t i = 0; i < w->ops; i++) {
+        uint64_t r = bench_rand(&rng);
+        int key = (int)((r >> 8) % (uint64_t)w->key_range);
+        unsigned dice = (unsigned)(r % 100);
+        int value;
+        pthread_mutex_lock(&w->lock);
+        if (dice < w->read_percent) {
+            if (dsalib_btree_map_find(w->locked, key, &value)) sum += value;
+        } else if (dice % 2) {
+            dsalib_btree_map_insert(w->locked, key, (int)i);
+        } else {
+            dsalib_btree_map_erase(w->locked, key);
+        }
+        pthread_mutex_unlock(&w->lock);
+    }
+    bench_consume(sum);
+}
+
+int main(int argc, char** argv) {
+    size_t keys = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    size_t ops = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 2000000;
+    size_t max_threads = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : dsalib_parallel_hardware_threads();
+    if (max_threads == 0) max_threads = 1;
+    uint64_t rng = 0x40;
+    unsigned read_percents[] = {100, 95, 50};
+
+    workload_t w;
+    w.ops = ops;
+    w.key_range = (int)(2 * keys);
+    pthread_mutex_init(&w.lock, NULL);
+
+    printf("%-32s %12s  %s\n", "strategy", "operations", "time");
+    for (int r = 0; r < 3; r++) {
+        w.read_percent = read_percents[r];
+        printf("%u%% reads\n", w.read_percent);
+        for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+            char label[64];
+
+            // Both maps start from the same half-full key set.
+            w.map = dsalib_concurrent_map_create(0, keys);
+            w.locked = dsalib_btree_map_create();
+            for (size_t i = 0; i < keys; i++) {
+                int key = (int)(bench_rand(&rng) % (uint64_t)w.key_range);
+                dsalib_concurrent_map_insert(w.map, key, key);
+                dsalib_btree_map_insert(w.locked, key, key);
+            }
+
+            double start = bench_now_ns();
+            dsalib_parallel_for(threads, threads, run_locked, &w);
+            snprintf(label, sizeof(label), "  btree_map + mutex, %zu threads", threads);
+            bench_report(label, ops * threads, bench_now_ns() - start);
+
+            start = bench_now_ns();
+            dsalib_parallel_for(threads, threads, run_sharded, &w);
+            snprintf(label, sizeof(label), "  concurrent_map, %zu threads", threads);
+            bench_report(label, ops * threads, bench_now_ns() - start);
+
+            dsalib_concurrent_map_destroy(w.map);
+            dsalib_btree_map_destroy(w.locked);
+        }
+    }
+
+    pthread_mutex_destroy(&w.lock);
+    return 0;
+}
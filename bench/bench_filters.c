@@ -0,0 +1,105 @@
+#include "bench.h"
+
+#include <dsalib/containers/bloom_filter.h>
+#include <dsalib/containers/cuckoo_filter.h>
+#include <dsalib/search/binary_search.h>
+#include <dsalib/search/linear_search.h>
+
+#include <stdlib.h>
+
+/*
+ * End-to-end lookup latency with and without a membership filter in front
+ * of dsalib_binary_search() (large sorted array) and dsalib_linear_search()
+ * (small unsorted array). Queries are 90% misses.
+ * Usage: bench_filters [keys] [queries]
+ */
+
+static int cmp_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    size_t q = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 10000000;
+    uint64_t rng = 0x29;
+
+    // Keys are even numbers; odd queries are guaranteed misses.
+    int* keys = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (int)(bench_rand(&rng) % 0x3FFFFFFF) * 2;
+    }
+    qsort(keys, n, sizeof(int), cmp_int);
+
+    int* queries = malloc(q * sizeof(int));
+    for (size_t i = 0; i < q; i++) {
+        uint64_t r = bench_rand(&rng);
+        queries[i] = r % 10 == 0 ? keys[(r >> 8) % n] : (int)((r >> 8) % 0x3FFFFFFF) * 2 + 1;
+    }
+
+    dsalib_bloom_filter_t* bloom = dsalib_bloom_filter_build(keys, n, 0.01);
+    dsalib_cuckoo_filter_t* cuckoo = dsalib_cuckoo_filter_build(keys, n, 0.01);
+
+    printf("%-32s %12s  %s\n", "lookup path", "queries", "time");
+    long long found = 0;
+    double start = bench_now_ns();
+    for (size_t i = 0; i < q; i++) {
+        found += dsalib_binary_search(keys, n, queries[i]) >= 0;
+    }
+    bench_report("binary_search", q, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < q; i++) {
+        if (dsalib_bloom_filter_contains(bloom, queries[i])) found += dsalib_binary_search(keys, n, queries[i]) >= 0;
+    }
+    bench_report("bloom + binary_search", q, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < q; i++) {
+        if (dsalib_cuckoo_filter_contains(cuckoo, queries[i])) found += dsalib_binary_search(keys, n, queries[i]) >= 0;
+    }
+    bench_report("cuckoo + binary_search", q, bench_now_ns() - start);
+
+    bool* maybe = malloc(q * sizeof(bool));
+    start = bench_now_ns();
+    dsalib_bloom_filter_contains_batch(bloom, queries, q, maybe);
+    for (size_t i = 0; i < q; i++) {
+        if (maybe[i]) found += dsalib_binary_search(keys, n, queries[i]) >= 0;
+    }
+    bench_report("bloom batch + binary_search", q, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    size_t positives = dsalib_cuckoo_filter_contains_batch(cuckoo, queries, q, maybe);
+    for (size_t i = 0; i < q; i++) {
+        if (maybe[i]) found += dsalib_binary_search(keys, n, queries[i]) >= 0;
+    }
+    bench_report("cuckoo batch + binary_search", q, bench_now_ns() - start);
+    printf("cuckoo positives: %zu of %zu queries\n", positives, q);
+
+    // Small unsorted array scanned linearly.
+    size_t small = n < 1000 ? n : 1000;
+    size_t small_q = q / 10;
+    dsalib_bloom_filter_t* small_bloom = dsalib_bloom_filter_build(keys, small, 0.01);
+    start = bench_now_ns();
+    for (size_t i = 0; i < small_q; i++) {
+        found += dsalib_linear_search(keys, small, queries[i]) >= 0;
+    }
+    bench_report("linear_search (1000 keys)", small_q, bench_now_ns() - start);
+    start = bench_now_ns();
+    for (size_t i = 0; i < small_q; i++) {
+        if (dsalib_bloom_filter_contains(small_bloom, queries[i])) {
+            found += dsalib_linear_search(keys, small, queries[i]) >= 0;
+        }
+    }
+    bench_report("bloom + linear_search", small_q, bench_now_ns() - start);
+    bench_consume(found);
+
+    dsalib_bloom_filter_destroy(small_bloom);
+    dsalib_bloom_filter_destroy(bloom);
+    dsalib_cuckoo_filter_destroy(cuckoo);
+    free(maybe);
+    free(queries);
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include "bench.h"
+
+#include <dsalib/search/linear_search.h>
+#include <dsalib/search/parallel_scan.h>
+#include <dsalib/util/parallel.h>
+
+#include <stdlib.h>
+
+/*
+ * Full scans of an n-int array (1 GiB by default): dsalib_linear_search()
+ * (the old single-threaded scan) vs the parallel scans at 1, 2, 4, ...
+ * threads, reported as GB/s of array read. The array is filled with the
+ * same chunk split the scans use, so pages land on the NUMA node of the
+ * worker that reads them. find looks for an absent value (whole array);
+ * find (3/4) stops at a match three quarters in.
+ * Usage: bench_parallel_scan [n] [max_threads]
+ */
+
+typedef struct {
+    int* arr;
+    size_t size;
+} fill_t;
+
+static void fill(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    fill_t* f = ctx;
+    uint64_t rng = 0x45 + begin;
+    size_t last = end * DSALIB_SCAN_CHUNK < f->size ? end * DSALIB_SCAN_CHUNK : f->size;
+    for (size_t i = begin * DSALIB_SCAN_CHUNK; i < last; i++) {
+        f->arr[i] = (int)(bench_rand(&rng) % 1000000000);
+    }
+}
+
+static bool is_negative(void* ctx, int value) {
+    (void)ctx;
+    return value < 0;
+}
+
+static void report(const char* label, size_t n, double elapsed_ns) {
+    printf("%-32s %12zu  %8.2f GB/s\n", label, n, (double)n * sizeof(int) / elapsed_ns);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : (size_t)1 << 28;
+    size_t max_threads = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : dsalib_parallel_hardware_threads();
+    if (max_threads == 0) max_threads = 1;
+    int* arr = malloc(n * sizeof(int));
+    fill_t f = {arr, n};
+    dsalib_parallel_for((n + DSALIB_SCAN_CHUNK - 1) / DSALIB_SCAN_CHUNK, max_threads, fill, &f);
+    int absent = -1;
+    int late = 1000000001;
+    arr[n / 4 * 3] = late;
+    long long checksum = 0;
+
+    printf("%-32s %12s  %s\n", "scan", "elements", "bandwidth");
+    double start = bench_now_ns();
+    checksum += dsalib_linear_search(arr, n, absent);
+    report("linear_search", n, bench_now_ns() - start);
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        printf("-- %zu threads\n", threads);
+        start = bench_now_ns();
+        checksum += dsalib_parallel_find(arr, n, absent, threads);
+        report("  find", n, bench_now_ns() - start);
+        start = bench_now_ns();
+        checksum += dsalib_parallel_find(arr, n, late, threads);
+        report("  find (3/4)", n / 4 * 3, bench_now_ns() - start);
+        start = bench_now_ns();
+        checksum += (long long)dsalib_parallel_count(arr, n, 42, threads);
+        report("  count", n, bench_now_ns() - start);
+        dsalib_minmax_t mm;
+        start = bench_now_ns();
+        dsalib_parallel_minmax(arr, n, threads, &mm);
+        report("  minmax", n, bench_now_ns() - start);
+        checksum += (long long)mm.min_index + (long long)mm.max_index;
+        start = bench_now_ns();
+        checksum += dsalib_parallel_find_if(arr, n, is_negative, NULL, threads);
+        report("  find_if (callback)", n, bench_now_ns() - start);
+    }
+
+    free(arr);
+    bench_consume(checksum);
+    return 0;
+}
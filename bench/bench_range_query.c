@@ -0,0 +1,113 @@
+#include "bench.h"
+
+#include <dsalib/search/range_query.h>
+#include <dsalib/util/parallel.h>
+
+#include <stdlib.h>
+
+/*
+ * Range queries over a random int array: range-min by scanning vs the
+ * sparse table, range-sum by summing vs the Fenwick tree (plus updates and
+ * lower_bound), and prefix scans: scalar loop vs SIMD vs 1..N threads.
+ * Usage: bench_range_query [size] [queries] [max_threads]
+ */
+
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 22;
+    size_t queries = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000000;
+    uint64_t rng = 0x38;
+
+    int* arr = malloc(size * sizeof(int));
+    for (size_t i = 0; i < size; i++) {
+        arr[i] = (int)(bench_rand(&rng) % 1000);
+    }
+    size_t* lefts = malloc(queries * sizeof(size_t));
+    size_t* rights = malloc(queries * sizeof(size_t));
+    for (size_t q = 0; q < queries; q++) {
+        size_t length = 1 + bench_rand(&rng) % 4096;
+        lefts[q] = bench_rand(&rng) % (size - length + 1);
+        rights[q] = lefts[q] + length;
+    }
+    long long checksum = 0;
+
+    printf("%zu elements, %zu queries of up to 4096 elements\n", size, queries);
+    printf("%-32s %12s  %s\n", "strategy", "queries", "time");
+
+    double start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        int min = arr[lefts[q]];
+        for (size_t i = lefts[q] + 1; i < rights[q]; i++) {
+            if (arr[i] < min) min = arr[i];
+        }
+        checksum += min;
+    }
+    bench_report("range min: scan", queries, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    dsalib_sparse_table_t* table = dsalib_sparse_table_create(arr, size, DSALIB_RANGE_MIN);
+    bench_report("range min: sparse table build", size, bench_now_ns() - start);
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        int min;
+        dsalib_sparse_table_query(table, lefts[q], rights[q], &min);
+        checksum += min;
+    }
+    bench_report("range min: sparse table", queries, bench_now_ns() - start);
+    dsalib_sparse_table_destroy(table);
+
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        long long sum = 0;
+        for (size_t i = lefts[q]; i < rights[q]; i++) {
+            sum += arr[i];
+        }
+        checksum += sum;
+    }
+    bench_report("range sum: scan", queries, bench_now_ns() - start);
+
+    dsalib_fenwick_t* fenwick = dsalib_fenwick_create(arr, size);
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        checksum += dsalib_fenwick_range_sum(fenwick, lefts[q], rights[q]);
+    }
+    bench_report("range sum: fenwick", queries, bench_now_ns() - start);
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        dsalib_fenwick_add(fenwick, lefts[q], 1);
+    }
+    bench_report("fenwick: point update", queries, bench_now_ns() - start);
+    long long total = dsalib_fenwick_prefix_sum(fenwick, size);
+    start = bench_now_ns();
+    for (size_t q = 0; q < queries; q++) {
+        checksum += (long long)dsalib_fenwick_lower_bound(fenwick, (long long)(bench_rand(&rng) % (uint64_t)total));
+    }
+    bench_report("fenwick: lower_bound", queries, bench_now_ns() - start);
+    dsalib_fenwick_destroy(fenwick);
+
+    long long* out = malloc(size * sizeof(long long));
+    start = bench_now_ns();
+    long long running = 0;
+    for (size_t i = 0; i < size; i++) {
+        running += arr[i];
+        out[i] = running;
+    }
+    bench_report("prefix scan: scalar loop", size, bench_now_ns() - start);
+    checksum += out[size - 1];
+
+    char label[64];
+    size_t max_threads = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : dsalib_parallel_hardware_threads();
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        start = bench_now_ns();
+        dsalib_prefix_sum_inclusive(arr, size, out, threads);
+        snprintf(label, sizeof(label), "prefix scan: SIMD, %zu threads", threads);
+        bench_report(label, size, bench_now_ns() - start);
+        checksum += out[size - 1];
+    }
+
+    bench_consume(checksum);
+    free(out);
+    free(lefts);
+    free(rights);
+    free(arr);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "bench.h"
+
+#include <dsalib/math/rpn.h>
+
+#include <stdlib.h>
+
+/*
+ * Rows/sec for one rule expression over columnar data: re-parsing the
+ * expression per row, compiled per-row evaluation, batched evaluation and
+ * a hand-written C loop as the ceiling.
+ * Usage: bench_rpn [rows]
+ */
+
+#define EXPRESSION "(price * qty + fee) / 100 - discount % 7"
+
+static void report_rows(const char* label, size_t rows, double elapsed_ns) {
+    printf("%-32s %12zu  %10.2f M rows/s\n", label, rows, elapsed_ns > 0 ? (double)rows * 1e3 / elapsed_ns : 0.0);
+}
+
+int main(int argc, char** argv) {
+    size_t rows = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 4000000;
+    uint64_t rng = 0x34;
+    const char* names[] = {"price", "qty", "fee", "discount"};
+    int* data[4];
+    for (int v = 0; v < 4; v++) {
+        data[v] = malloc(rows * sizeof(int));
+        for (size_t i = 0; i < rows; i++) {
+            data[v][i] = (int)(bench_rand(&rng) % 10000);
+        }
+    }
+    const int* columns[] = {data[0], data[1], data[2], data[3]};
+    int* out = malloc(rows * sizeof(int));
+    long long sum = 0;
+
+    printf("expression: %s\n", EXPRESSION);
+    printf("%-32s %12s  %s\n", "strategy", "rows", "throughput");
+
+    size_t reparse_rows = rows / 20;
+    double start = bench_now_ns();
+    for (size_t i = 0; i < reparse_rows; i++) {
+        dsalib_rpn_program_t* program = dsalib_rpn_compile_infix(EXPRESSION, names, 4);
+        int vars[] = {columns[0][i], columns[1][i], columns[2][i], columns[3][i]};
+        dsalib_rpn_eval(program, vars, &out[i]);
+        dsalib_rpn_destroy(program);
+        sum += out[i];
+    }
+    report_rows("compile every row", reparse_rows, bench_now_ns() - start);
+
+    dsalib_rpn_program_t* program = dsalib_rpn_compile_infix(EXPRESSION, names, 4);
+    start = bench_now_ns();
+    for (size_t i = 0; i < rows; i++) {
+        int vars[] = {columns[0][i], columns[1][i], columns[2][i], columns[3][i]};
+        dsalib_rpn_eval(program, vars, &out[i]);
+    }
+    report_rows("compiled, per row", rows, bench_now_ns() - start);
+    sum += out[rows / 2];
+
+    start = bench_now_ns();
+    sum += (long long)dsalib_rpn_eval_batch(program, columns, rows, out);
+    report_rows("compiled, batched", rows, bench_now_ns() - start);
+    sum += out[rows / 3];
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < rows; i++) {
+        out[i] = (columns[0][i] * columns[1][i] + columns[2][i]) / 100 - columns[3][i] % 7;
+    }
+    report_rows("hand-written C", rows, bench_now_ns() - start);
+    sum += out[rows / 4];
+
+    bench_consume(sum);
+    dsalib_rpn_destroy(program);
+    for (int v = 0; v < 4; v++) free(data[v]);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include "bench.h"
+
+#include <dsalib/search/select.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Quantiles and top-k over latency-like samples, sort-and-index (qsort)
+ * vs nth_element, multi_select for p50/p90/p99/p99.9 and streaming top-k.
+ * Sizes run from 1M by factors of 10 up to max_size.
+ * Usage: bench_select [max_size] [k]
+ */
+
+static int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/* Log-normal-ish latencies in microseconds: mostly small, with a long tail. */
+static void fill_latencies(int* arr, size_t size, uint64_t* rng) {
+    for (size_t i = 0; i < size; i++) {
+        uint64_t r = bench_rand(rng);
+        int base = 50 + (int)(r % 200);
+        int shift = (int)((r >> 32) % 64 == 0 ? (r >> 40) % 12 : 0);
+        arr[i] = base << shift;
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    size_t k = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 100;
+    uint64_t rng = 0x39;
+    double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+    long long checksum = 0;
+
+    printf("%-32s %12s  %s\n", "strategy", "elements", "time");
+    for (size_t size = 1000000; size <= max_size; size *= 10) {
+        int* samples = malloc(size * sizeof(int));
+        int* work = malloc(size * sizeof(int));
+        int* top = malloc(k * sizeof(int));
+        fill_latencies(samples, size, &rng);
+        size_t ranks[4];
+        for (int q = 0; q < 4; q++) {
+            ranks[q] = dsalib_quantile_rank(size, quantiles[q]);
+        }
+        printf("size %zu\n", size);
+
+        memcpy(work, samples, size * sizeof(int));
+        double start = bench_now_ns();
+        qsort(work, size, sizeof(int), compare_int);
+        for (int q = 0; q < 4; q++) {
+            checksum += work[ranks[q]];
+        }
+        bench_report("  qsort + index (4 quantiles)", size, bench_now_ns() - start);
+
+        memcpy(work, samples, size * sizeof(int));
+        start = bench_now_ns();
+        dsalib_nth_element(work, size, ranks[0]);
+        bench_report("  nth_element (p50)", size, bench_now_ns() - start);
+        checksum += work[ranks[0]];
+
+        memcpy(work, samples, size * sizeof(int));
+        start = bench_now_ns();
+        for (int q = 0; q < 4; q++) {
+            dsalib_nth_element(work, size, ranks[q]);
+            checksum += work[ranks[q]];
+        }
+        bench_report("  nth_element x4", size, bench_now_ns() - start);
+
+        memcpy(work, samples, size * sizeof(int));
+        start = bench_now_ns();
+        dsalib_multi_select(work, size, ranks, 4);
+        bench_report("  multi_select (4 quantiles)", size, bench_now_ns() - start);
+        checksum += work[ranks[3]];
+
+        dsalib_topk_t* topk = dsalib_topk_create(k);
+        start = bench_now_ns();
+        for (size_t i = 0; i < size; i++) {
+            dsalib_topk_push(topk, samples[i]);
+        }
+        bench_report("  top-k, push per element", size, bench_now_ns() - start);
+        dsalib_topk_reset(topk);
+        start = bench_now_ns();
+        dsalib_topk_push_array(topk, samples, size);
+        checksum += (long long)dsalib_topk_result(topk, top);
+        bench_report("  top-k, SIMD filtered", size, bench_now_ns() - start);
+        checksum += top[0];
+        dsalib_topk_destroy(topk);
+
+        free(samples);
+        free(work);
+        free(top);
+    }
+
+    bench_consume(checksum);
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include "bench.h"
+
+#include <dsalib/containers/sliding_window.h>
+
+#include <stdlib.h>
+
+/*
+ * Rolling minimum over a random stream for growing window lengths:
+ * rescanning every window (O(n*w)), the streaming monotonic deque and the
+ * whole-array van Herk/SIMD path. The last two should stay flat per
+ * element as the window grows.
+ * Usage: bench_sliding_window [elements]
+ */
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 4000000;
+    uint64_t rng = 0x37;
+    int* arr = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int)bench_rand(&rng);
+    }
+    int* out = malloc(n * sizeof(int));
+    long long checksum = 0;
+
+    printf("%-32s %12s  %s\n", "strategy", "elements", "time");
+    size_t windows[] = {4, 16, 64, 256, 1024, 4096};
+    for (size_t k = 0; k < sizeof(windows) / sizeof(windows[0]); k++) {
+        size_t window = windows[k];
+        printf("window %zu\n", window);
+
+        // The rescan is O(n*w); cap its work so large windows finish.
+        size_t scan_n = n;
+        if (scan_n > 200000000 / window) scan_n = 200000000 / window;
+        double start = bench_now_ns();
+        for (size_t i = 0; i + window <= scan_n; i++) {
+            int min = arr[i];
+            for (size_t j = 1; j < window; j++) {
+                if (arr[i + j] < min) min = arr[i + j];
+            }
+            out[i] = min;
+        }
+        bench_report("  rescan each window", scan_n, bench_now_ns() - start);
+        checksum += out[0];
+
+        dsalib_sliding_window_t* w = dsalib_sliding_window_create(window);
+        start = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            dsalib_sliding_window_push(w, arr[i]);
+            dsalib_sliding_window_min(w, &out[i]);
+        }
+        bench_report("  streaming deque", n, bench_now_ns() - start);
+        checksum += out[n / 2];
+        dsalib_sliding_window_destroy(w);
+
+        start = bench_now_ns();
+        size_t count = dsalib_sliding_min(arr, n, window, out);
+        bench_report("  array (van Herk / SIMD)", n, bench_now_ns() - start);
+        checksum += out[count / 2];
+    }
+
+    bench_consume(checksum);
+    free(arr);
+    free(out);
+    return 0;
+}
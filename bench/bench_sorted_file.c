@@ -0,0 +1,129 @@
+#include "bench.h"
+
+#include <dsalib/search/binary_search.h>
+#include <dsalib/search/sorted_file.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*
+ * Startup cost of the parse-and-sort path (text file -> array -> qsort)
+ * versus opening a memory-mapped dsalib sorted file, cold (page cache
+ * dropped with posix_fadvise) and warm, followed by a batch of lookups.
+ * Usage: bench_sorted_file [elements] [queries]
+ */
+
+#define TEXT_PATH "bench_sorted_file.txt"
+#define BINARY_PATH "bench_sorted_file.bin"
+
+static int cmp_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static void drop_page_cache(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return;
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+}
+
+static int* parse_and_sort(const char* path, size_t* size) {
+    FILE* in = fopen(path, "rb");
+    fseek(in, 0, SEEK_END);
+    long bytes = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    char* text = malloc((size_t)bytes + 1);
+    size_t got = fread(text, 1, (size_t)bytes, in);
+    text[got] = '\0';
+    fclose(in);
+
+    size_t capacity = 1024, n = 0;
+    int* arr = malloc(capacity * sizeof(int));
+    char* p = text;
+    char* end;
+    for (long value = strtol(p, &end, 10); end != p; value = strtol(p, &end, 10)) {
+        if (n == capacity) {
+            capacity *= 2;
+            arr = realloc(arr, capacity * sizeof(int));
+        }
+        arr[n++] = (int)value;
+        p = end;
+    }
+    free(text);
+    qsort(arr, n, sizeof(int), cmp_int);
+    *size = n;
+    return arr;
+}
+
+static void report_ms(const char* label, double elapsed_ns) {
+    printf("%-32s %12.3f ms\n", label, elapsed_ns / 1e6);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    size_t q = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 100000;
+    uint64_t rng = 0x30;
+
+    int* arr = malloc(n * sizeof(int));
+    FILE* text = fopen(TEXT_PATH, "w");
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int)(bench_rand(&rng) & 0x7FFFFFFF);
+        fprintf(text, "%d\n", arr[i]);
+    }
+    fclose(text);
+    qsort(arr, n, sizeof(int), cmp_int);
+    dsalib_sorted_file_options_t options = {256, 0.01};
+    if (!dsalib_sorted_file_write(BINARY_PATH, arr, n, &options)) {
+        fprintf(stderr, "cannot write %s\n", BINARY_PATH);
+        return 1;
+    }
+    int* queries = malloc(q * sizeof(int));
+    for (size_t i = 0; i < q; i++) {
+        queries[i] = (int)(bench_rand(&rng) & 0x7FFFFFFF);
+    }
+    free(arr);
+
+    printf("%zu elements, %zu lookups after startup\n", n, q);
+    long long found = 0;
+
+    drop_page_cache(TEXT_PATH);
+    double start = bench_now_ns();
+    size_t parsed = 0;
+    int* loaded = parse_and_sort(TEXT_PATH, &parsed);
+    report_ms("parse + sort (cold)", bench_now_ns() - start);
+    start = bench_now_ns();
+    for (size_t i = 0; i < q; i++) {
+        found += dsalib_binary_search(loaded, parsed, queries[i]) >= 0;
+    }
+    report_ms("  lookups", bench_now_ns() - start);
+    free(loaded);
+
+    const char* labels[] = {"mmap open (cold)", "mmap open (cold, verify)", "mmap open (warm)"};
+    int flags[] = {0, DSALIB_SORTED_FILE_VERIFY, DSALIB_SORTED_FILE_WILLNEED};
+    for (int run = 0; run < 3; run++) {
+        if (run < 2) drop_page_cache(BINARY_PATH);
+        start = bench_now_ns();
+        dsalib_sorted_file_t* file = dsalib_sorted_file_open(BINARY_PATH, flags[run]);
+        report_ms(labels[run], bench_now_ns() - start);
+        if (!file) {
+            fprintf(stderr, "cannot open %s\n", BINARY_PATH);
+            return 1;
+        }
+        start = bench_now_ns();
+        for (size_t i = 0; i < q; i++) {
+            found += dsalib_sorted_file_search(file, queries[i]) >= 0;
+        }
+        report_ms("  lookups", bench_now_ns() - start);
+        dsalib_sorted_file_close(file);
+    }
+    bench_consume(found);
+
+    remove(TEXT_PATH);
+    remove(BINARY_PATH);
+    free(queries);
+    return 0;
+}
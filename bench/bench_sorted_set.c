@@ -0,0 +1,70 @@
+#include "bench.h"
+
+#include <dsalib/search/binary_search.h>
+#include <dsalib/search/sorted_set.h>
+
+#include <stdlib.h>
+
+/*
+ * Intersection cost across size ratios: per-element dsalib_binary_search()
+ * (the old approach) vs. linear merge, galloping and the adaptive kernel.
+ * Usage: bench_sorted_set [large_size]
+ */
+
+static int* make_set(size_t size, int max_gap, uint64_t* rng) {
+    int* arr = malloc(size * sizeof(int));
+    int value = 0;
+    for (size_t i = 0; i < size; i++) {
+        value += 1 + (int)(bench_rand(rng) % (uint64_t)max_gap);
+        arr[i] = value;
+    }
+    return arr;
+}
+
+static size_t intersect_binary_search(const int* s, size_t ns, const int* l, size_t nl, int* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < ns; i++) {
+        if (dsalib_binary_search(l, nl, s[i]) >= 0) out[n++] = s[i];
+    }
+    return n;
+}
+
+typedef size_t (*intersect_fn)(const int*, size_t, const int*, size_t, int*);
+
+static void run(const char* label, intersect_fn fn, const int* s, size_t ns, const int* l, size_t nl, int* out) {
+    int reps = 5;
+    double best = 0;
+    for (int r = 0; r < reps; r++) {
+        double start = bench_now_ns();
+        bench_consume((long long)fn(s, ns, l, nl, out));
+        double elapsed = bench_now_ns() - start;
+        if (r == 0 || elapsed < best) best = elapsed;
+    }
+    bench_report(label, ns + nl, best);
+}
+
+int main(int argc, char** argv) {
+    size_t nl = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : (size_t)1 << 20;
+    size_t ratios[] = {1, 4, 16, 64, 256, 1024};
+    uint64_t rng = 0x9E3779B97F4A7C15ULL;
+
+    printf("%-32s %12s  %s\n", "kernel", "elements", "time");
+    for (size_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++) {
+        size_t ns = nl / ratios[r];
+        if (ns == 0) continue;
+        int* l = make_set(nl, 4, &rng);
+        int* s = make_set(ns, (int)(4 * ratios[r]), &rng);
+        int* out = malloc(ns * sizeof(int));
+
+        printf("-- ratio 1:%zu (small=%zu, large=%zu)\n", ratios[r], ns, nl);
+        run("binary_search per element", intersect_binary_search, s, ns, l, nl, out);
+        run("intersect_merge", dsalib_sorted_intersect_merge, s, ns, l, nl, out);
+        run("intersect_gallop", dsalib_sorted_intersect_gallop, s, ns, l, nl, out);
+        run("intersect (adaptive)", dsalib_sorted_intersect, s, ns, l, nl, out);
+
+        free(l);
+        free(s);
+        free(out);
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include "bench.h"
+
+#include <dsalib/util/string_utils.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Throughput (GB/s) of the string utilities against libc and byte-by-byte
+ * loops over a synthetic log file held in memory.
+ * Usage: bench_string_utils [megabytes]
+ */
+
+static void report_gbps(const char* label, size_t bytes, double elapsed_ns) {
+    printf("%-32s %12zu  %10.3f GB/s\n", label, bytes, elapsed_ns > 0 ? (double)bytes / elapsed_ns : 0.0);
+}
+
+static size_t split_lines_naive(const char* buf, size_t length, dsalib_string_span_t* spans) {
+    size_t count = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (buf[i] == '\n') {
+            spans[count].data = buf + start;
+            spans[count].length = i - start;
+            count++;
+            start = i + 1;
+        }
+    }
+    return count;
+}
+
+static size_t parse_ints_strtol(const char* buf, int* out, size_t max) {
+    size_t count = 0;
+    const char* p = buf;
+    while (count < max && *p) {
+        if ((*p >= '0' && *p <= '9') || (*p == '-' && p[1] >= '0' && p[1] <= '9')) {
+            char* end;
+            out[count++] = (int)strtol(p, &end, 10);
+            p = end;
+        } else {
+            p++;
+        }
+    }
+    return count;
+}
+
+int main(int argc, char** argv) {
+    size_t megabytes = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 128;
+    size_t capacity = megabytes << 20;
+    uint64_t rng = 0x33;
+
+    char* text = malloc(capacity + 128);
+    size_t length = 0;
+    size_t lines = 0;
+    while (length < capacity) {
+        length += (size_t)sprintf(text + length, "2026-10-18T12:%02d:%02d INFO request=%d latency_us=%d status=200\n",
+                                  (int)(bench_rand(&rng) % 60), (int)(bench_rand(&rng) % 60),
+                                  (int)(bench_rand(&rng) % 1000000), (int)(bench_rand(&rng) % 50000));
+        lines++;
+    }
+    text[length] = '\0';
+    printf("%zu bytes, %zu lines\n", length, lines);
+    printf("%-32s %12s  %s\n", "operation", "bytes", "throughput");
+
+    long long sink = 0;
+    double start = bench_now_ns();
+    sink += (long long)strlen(text);
+    report_gbps("strlen (libc)", length, bench_now_ns() - start);
+    start = bench_now_ns();
+    sink += (long long)dsalib_string_length(text);
+    report_gbps("string_length", length, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    sink += memchr(text, '#', length) != NULL;
+    report_gbps("memchr (libc)", length, bench_now_ns() - start);
+    start = bench_now_ns();
+    sink += dsalib_string_find_byte(text, length, '#') != NULL;
+    report_gbps("string_find_byte", length, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    sink += strstr(text, "status=500") != NULL;
+    report_gbps("strstr (libc)", length, bench_now_ns() - start);
+    start = bench_now_ns();
+    sink += dsalib_string_find(text, length, "status=500", 10) != NULL;
+    report_gbps("string_find", length, bench_now_ns() - start);
+
+    dsalib_string_span_t* spans = malloc(lines * sizeof(dsalib_string_span_t));
+    start = bench_now_ns();
+    sink += (long long)split_lines_naive(text, length, spans);
+    report_gbps("split lines (byte loop)", length, bench_now_ns() - start);
+    start = bench_now_ns();
+    sink += (long long)dsalib_string_split_lines(text, length, spans, lines);
+    report_gbps("string_split_lines", length, bench_now_ns() - start);
+
+    size_t max_values = lines * 8;
+    int* values = malloc(max_values * sizeof(int));
+    start = bench_now_ns();
+    sink += (long long)parse_ints_strtol(text, values, max_values);
+    report_gbps("parse ints (strtol)", length, bench_now_ns() - start);
+    start = bench_now_ns();
+    sink += (long long)dsalib_string_parse_ints(text, length, values, max_values, NULL);
+    report_gbps("string_parse_ints", length, bench_now_ns() - start);
+
+    bench_consume(sink);
+    free(values);
+    free(spans);
+    free(text);
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "bench.h"
+
+#include <dsalib/containers/timer_wheel.h>
+#include <dsalib/search/binary_search.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Millions of pending timeouts (1 tick = 1 ms, up to a 30 s horizon): a
+ * sorted array kept with dsalib_lower_bound() + memmove (the old approach)
+ * vs the timer wheel. Schedule and cancel are timed with `pending` timers
+ * already queued; expiry walks the clock forward 1 ms at a time until all
+ * fire. The sorted array only runs `ops` schedules/cancels because each
+ * one moves megabytes.
+ * Usage: bench_timer_wheel [pending] [ops]
+ */
+
+#define HORIZON 30000
+
+static int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static void count_fired(void* ctx, dsalib_timer_id_t timer, void* data) {
+    (void)timer;
+    (void)data;
+    (*(size_t*)ctx)++;
+}
+
+int main(int argc, char** argv) {
+    size_t pending = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 2000000;
+    size_t ops = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 5000;
+    uint64_t rng = 0x42;
+    int* expiries = malloc((pending + ops) * sizeof(int));
+    for (size_t i = 0; i < pending + ops; i++) {
+        expiries[i] = 1 + (int)(bench_rand(&rng) % HORIZON);
+    }
+    long long checksum = 0;
+
+    printf("%-32s %12s  %s\n", "strategy", "operations", "time");
+    printf("%zu pending timers\n", pending);
+
+    // Sorted array: [head, size) holds pending expiries in ascending order.
+    int* sorted = malloc((pending + ops) * sizeof(int));
+    memcpy(sorted, expiries, pending * sizeof(int));
+    qsort(sorted, pending, sizeof(int), compare_int);
+    size_t size = pending;
+    double start = bench_now_ns();
+    for (size_t i = 0; i < ops; i++) {
+        int expires = expiries[pending + i];
+        size_t pos = dsalib_lower_bound(sorted, size, expires);
+        memmove(sorted + pos + 1, sorted + pos, (size - pos) * sizeof(int));
+        sorted[pos] = expires;
+        size++;
+    }
+    bench_report("  sorted array, schedule", ops, bench_now_ns() - start);
+    start = bench_now_ns();
+    for (size_t i = 0; i < ops; i++) {
+        size_t pos = dsalib_lower_bound(sorted, size, expiries[pending + i]);
+        memmove(sorted + pos, sorted + pos + 1, (size - pos - 1) * sizeof(int));
+        size--;
+    }
+    bench_report("  sorted array, cancel", ops, bench_now_ns() - start);
+    start = bench_now_ns();
+    size_t head = 0;
+    for (int now = 1; now <= HORIZON; now++) {
+        while (head < size && sorted[head] <= now) {
+            checksum += sorted[head++];
+        }
+    }
+    bench_report("  sorted array, expire", size, bench_now_ns() - start);
+    free(sorted);
+
+    dsalib_timer_wheel_t* wheel = dsalib_timer_wheel_create(0, pending + ops);
+    dsalib_timer_id_t* ids = malloc(ops * sizeof(dsalib_timer_id_t));
+    start = bench_now_ns();
+    for (size_t i = 0; i < pending; i++) {
+        dsalib_timer_wheel_schedule(wheel, (uint64_t)expiries[i], NULL);
+    }
+    bench_report("  timer wheel, schedule (bulk)", pending, bench_now_ns() - start);
+    start = bench_now_ns();
+    for (size_t i = 0; i < ops; i++) {
+        ids[i] = dsalib_timer_wheel_schedule(wheel, (uint64_t)expiries[pending + i], NULL);
+    }
+    bench_report("  timer wheel, schedule", ops, bench_now_ns() - start);
+    start = bench_now_ns();
+    for (size_t i = 0; i < ops; i++) {
+        checksum += dsalib_timer_wheel_cancel(wheel, ids[i]);
+    }
+    bench_report("  timer wheel, cancel", ops, bench_now_ns() - start);
+    size_t fired = 0;
+    start = bench_now_ns();
+    for (uint64_t now = 1; now <= HORIZON; now++) {
+        dsalib_timer_wheel_advance(wheel, now, count_fired, &fired);
+    }
+    bench_report("  timer wheel, expire", fired, bench_now_ns() - start);
+    checksum += (long long)fired;
+
+    dsalib_timer_wheel_destroy(wheel);
+    free(ids);
+    free(expiries);
+    bench_consume(checksum);
+    return 0;
+}
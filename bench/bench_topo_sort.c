@@ -0,0 +1,88 @@
+#include "bench.h"
+
+#include <dsalib/graph/topo_sort.h>
+#include <dsalib/util/parallel.h>
+
+#include <stdlib.h>
+
+/*
+ * Topological sort of a random DAG: sequential Kahn vs the level-synchronous
+ * parallel sort at 1..N threads, then the DAG executor running a small
+ * amount of work per node.
+ * Usage: bench_topo_sort [nodes] [edges_per_node] [max_threads]
+ */
+
+/* Stand-in for per-node work: a short chain of hash rounds. */
+static void spin_task(void* ctx, uint32_t node) {
+    uint64_t x = node + 1;
+    for (int i = 0; i < 64; i++) {
+        x = bench_rand(&x) | 1;
+    }
+    if (x == 0) *(volatile int*)ctx = 1;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    size_t degree = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 4;
+    size_t max_threads = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : dsalib_parallel_hardware_threads();
+    if (max_threads == 0) max_threads = 1;
+    uint64_t rng = 0x35;
+
+    // Edges go from lower to higher rank under a random permutation, so the
+    // node ids carry no hint of the order.
+    uint32_t* rank = malloc(n * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++) {
+        rank[i] = (uint32_t)i;
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = bench_rand(&rng) % (i + 1);
+        uint32_t tmp = rank[i];
+        rank[i] = rank[j];
+        rank[j] = tmp;
+    }
+    size_t m = n * degree;
+    dsalib_edge_t* edges = malloc(m * sizeof(dsalib_edge_t));
+    for (size_t e = 0; e < m; e++) {
+        size_t a = bench_rand(&rng) % n;
+        size_t b = bench_rand(&rng) % n;
+        if (a == b) b = (b + 1) % n;
+        edges[e].u = rank[a < b ? a : b];
+        edges[e].v = rank[a < b ? b : a];
+    }
+    dsalib_csr_graph_t* graph = dsalib_csr_graph_create(n, edges, m);
+    free(edges);
+    free(rank);
+    uint32_t* order = malloc(n * sizeof(uint32_t));
+    int sink = 0;
+
+    printf("%zu nodes, %zu edges, up to %zu threads\n", n, m, max_threads);
+    printf("%-32s %12s  %s\n", "strategy", "nodes", "time");
+
+    double start = bench_now_ns();
+    size_t sorted = dsalib_topo_sort(graph, order);
+    bench_report("sequential kahn", n, bench_now_ns() - start);
+    bench_consume((long long)sorted + order[n / 2]);
+
+    size_t levels = 0;
+    char label[64];
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        start = bench_now_ns();
+        sorted = dsalib_topo_sort_parallel(graph, threads, order, &levels);
+        snprintf(label, sizeof(label), "level-sync, %zu threads", threads);
+        bench_report(label, n, bench_now_ns() - start);
+        bench_consume((long long)sorted + order[n / 2]);
+    }
+    printf("(%zu levels)\n", levels);
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        start = bench_now_ns();
+        bool ok = dsalib_dag_execute(graph, threads, spin_task, &sink);
+        snprintf(label, sizeof(label), "executor, %zu threads", threads);
+        bench_report(label, n, bench_now_ns() - start);
+        bench_consume(ok);
+    }
+
+    free(order);
+    dsalib_csr_graph_destroy(graph);
+    return sink;
+}
@@ -0,0 +1,82 @@
+#include "bench.h"
+
+#include <dsalib/containers/union_find.h>
+#include <dsalib/graph/mst.h>
+#include <dsalib/util/parallel.h>
+
+#include <stdlib.h>
+
+/*
+ * Random-union throughput for the sequential and lock-free union-find, and
+ * Kruskal MST over a random weighted graph.
+ * Usage: bench_union_find [elements] [unions] [max_threads]
+ * Defaults: 10M elements, 100M unions, all online CPUs.
+ */
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    size_t m = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 100000000;
+    size_t max_threads = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : dsalib_parallel_hardware_threads();
+    uint64_t rng = 0x27;
+
+    dsalib_edge_t* edges = malloc(m * sizeof(dsalib_edge_t));
+    if (!edges) {
+        fprintf(stderr, "cannot allocate %zu edges\n", m);
+        return 1;
+    }
+    for (size_t i = 0; i < m; i++) {
+        edges[i].u = (uint32_t)(bench_rand(&rng) % n);
+        edges[i].v = (uint32_t)(bench_rand(&rng) % n);
+    }
+
+    printf("%-32s %12s  %s\n", "operation", "unions", "time");
+
+    dsalib_union_find_t* uf = dsalib_union_find_create(n);
+    double start = bench_now_ns();
+    for (size_t i = 0; i < m; i++) {
+        dsalib_union_find_union(uf, edges[i].u, edges[i].v);
+    }
+    bench_report("sequential union", m, bench_now_ns() - start);
+    size_t expected_sets = dsalib_union_find_count_sets(uf);
+    dsalib_union_find_destroy(uf);
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        dsalib_concurrent_union_find_t* cuf = dsalib_concurrent_union_find_create(n);
+        start = bench_now_ns();
+        dsalib_concurrent_union_find_union_edges(cuf, edges, m, threads);
+        double elapsed = bench_now_ns() - start;
+        char label[64];
+        snprintf(label, sizeof(label), "lock-free union, %zu threads", threads);
+        bench_report(label, m, elapsed);
+        if (dsalib_concurrent_union_find_count_sets(cuf) != expected_sets) {
+            fprintf(stderr, "set count mismatch\n");
+            return 1;
+        }
+        dsalib_concurrent_union_find_destroy(cuf);
+    }
+
+    uint32_t* labels = malloc(n * sizeof(uint32_t));
+    start = bench_now_ns();
+    size_t components = dsalib_connected_components(n, edges, m, max_threads, labels);
+    bench_report("connected_components", m, bench_now_ns() - start);
+    bench_consume((long long)components);
+    free(labels);
+    free(edges);
+
+    size_t mst_vertices = n / 10 ? n / 10 : 1;
+    size_t mst_edges = m / 10;
+    dsalib_weighted_edge_t* weighted = malloc(mst_edges * sizeof(dsalib_weighted_edge_t));
+    dsalib_weighted_edge_t* tree = malloc(mst_vertices * sizeof(dsalib_weighted_edge_t));
+    for (size_t i = 0; i < mst_edges; i++) {
+        weighted[i].u = (uint32_t)(bench_rand(&rng) % mst_vertices);
+        weighted[i].v = (uint32_t)(bench_rand(&rng) % mst_vertices);
+        weighted[i].weight = (int)(bench_rand(&rng) % 1000000);
+    }
+    long long total = 0;
+    start = bench_now_ns();
+    bench_consume((long long)dsalib_mst_kruskal(mst_vertices, weighted, mst_edges, tree, &total));
+    bench_report("mst_kruskal (per edge)", mst_edges, bench_now_ns() - start);
+    free(weighted);
+    free(tree);
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include "bench.h"
+
+#include <dsalib/containers/stack.h>
+#include <dsalib/containers/vector.h>
+
+#include <stdlib.h>
+
+/*
+ * Short-lived small vectors: dsalib_stack_t (two mallocs per instance)
+ * versus a stack-declared dsalib_vector_t (no malloc below 16 ints), and
+ * push_back cost of the 2x and 1.5x growth policies for one large vector.
+ * Usage: bench_vector [iterations]
+ */
+
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 2000000;
+    long long sum = 0;
+
+    printf("%-32s %12s  %s\n", "case", "elements", "time");
+    for (int length = 2; length <= 32; length *= 2) {
+        printf("-- %d elements per vector\n", length);
+        double start = bench_now_ns();
+        for (size_t it = 0; it < iterations; it++) {
+            dsalib_stack_t* stack = dsalib_stack_create(0);
+            for (int i = 0; i < length; i++) {
+                dsalib_stack_push(stack, (int)it + i);
+            }
+            sum += stack->data[length - 1];
+            dsalib_stack_destroy(stack);
+        }
+        bench_report("stack (heap)", iterations * (size_t)length, bench_now_ns() - start);
+
+        start = bench_now_ns();
+        for (size_t it = 0; it < iterations; it++) {
+            dsalib_vector_t vec;
+            dsalib_vector_init(&vec, sizeof(int), DSALIB_VECTOR_GROW_2X);
+            for (int i = 0; i < length; i++) {
+                int value = (int)it + i;
+                dsalib_vector_push_back(&vec, &value);
+            }
+            sum += *(int*)dsalib_vector_at(&vec, (size_t)length - 1);
+            dsalib_vector_release(&vec);
+        }
+        bench_report("vector (inline buffer)", iterations * (size_t)length, bench_now_ns() - start);
+    }
+
+    size_t n = iterations * 8;
+    const char* labels[] = {"push_back 2x growth", "push_back 1.5x growth"};
+    dsalib_vector_growth_t policies[] = {DSALIB_VECTOR_GROW_2X, DSALIB_VECTOR_GROW_1_5X};
+    printf("-- one vector of %zu ints\n", n);
+    for (int p = 0; p < 2; p++) {
+        dsalib_vector_t vec;
+        dsalib_vector_init(&vec, sizeof(int), policies[p]);
+        double start = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            int value = (int)i;
+            dsalib_vector_push_back(&vec, &value);
+        }
+        bench_report(labels[p], n, bench_now_ns() - start);
+        printf("%-32s %12zu  (%.0f%% unused)\n", "  final capacity", dsalib_vector_capacity(&vec),
+               100.0 * (double)(dsalib_vector_capacity(&vec) - n) / (double)dsalib_vector_capacity(&vec));
+        dsalib_vector_release(&vec);
+    }
+
+    bench_consume(sum);
+    return 0;
+}
@@ -0,0 +1,85 @@
+#ifndef DSALIB_BLOOM_FILTER_H
+#define DSALIB_BLOOM_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of 32-bit words per filter block (256 bits).
+ */
+#define DSALIB_BLOOM_BLOCK_WORDS 8
+
+/**
+ * @brief Cache-line blocked ("split block") Bloom filter over int keys.
+ *
+ * An approximate-membership filter meant to run before dsalib_linear_search()
+ * or dsalib_binary_search(): contains() == false means the key is definitely
+ * absent, so the search can be skipped; true means "maybe present".
+ *
+ * Each key maps to a single 256-bit block (8 words, 32-byte aligned, so a
+ * block never straddles a cache line) and sets one bit in each of the 8
+ * words. A lookup therefore costs exactly one cache miss, and the 8 bit
+ * tests are done at once with SSE2/AVX2 when available.
+ *
+ * Time Complexities:
+ * - Add: O(1)
+ * - Contains: O(1), one cache line
+ *
+ * Space: roughly 10-11 bits per key at a 1% false-positive rate.
+ */
+typedef struct {
+    uint32_t* blocks;    // num_blocks * DSALIB_BLOOM_BLOCK_WORDS words
+    uint32_t num_blocks; // Number of 256-bit blocks
+} dsalib_bloom_filter_t;
+
+/**
+ * @brief Creates an empty filter sized for a target false-positive rate.
+ *
+ * @param expected_keys Number of keys that will be added
+ * @param fpr Target false-positive rate in (0, 1), e.g. 0.01
+ * @return Pointer to the new filter, or NULL on invalid arguments or
+ *         allocation failure
+ */
+dsalib_bloom_filter_t* dsalib_bloom_filter_create(size_t expected_keys, double fpr);
+
+/**
+ * @brief Creates a filter containing every element of arr.
+ *
+ * @return Pointer to the new filter, or NULL on invalid arguments or
+ *         allocation failure
+ */
+dsalib_bloom_filter_t* dsalib_bloom_filter_build(const int* arr, size_t size, double fpr);
+
+/**
+ * @brief Destroys the filter. Handles NULL gracefully.
+ */
+void dsalib_bloom_filter_destroy(dsalib_bloom_filter_t* filter);
+
+/**
+ * @brief Adds key to the filter (no-op if filter is NULL).
+ */
+void dsalib_bloom_filter_add(dsalib_bloom_filter_t* filter, int key);
+
+/**
+ * @brief Tests key for membership.
+ *
+ * @return false if key was definitely never added (or filter is NULL),
+ *         true if it may have been added
+ */
+bool dsalib_bloom_filter_contains(const dsalib_bloom_filter_t* filter, int key);
+
+/**
+ * @brief Tests many keys, prefetching blocks ahead of the checks.
+ *
+ * @param keys Keys to test
+ * @param size Number of keys
+ * @param out Receives one result per key (may be NULL to only count)
+ * @return Number of keys that may be present
+ */
+size_t dsalib_bloom_filter_contains_batch(const dsalib_bloom_filter_t* filter,
+                                          const int* keys,
+                                          size_t size,
+                                          bool* out);
+
+#endif // DSALIB_BLOOM_FILTER_H
@@ -0,0 +1,130 @@
+#ifndef DSALIB_BTREE_MAP_H
+#define DSALIB_BTREE_MAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Maximum number of keys per node.
+ *
+ * 16 ints fill exactly one 64-byte cache line, so searching a node touches a
+ * single line of keys. Nodes themselves are allocated 64-byte aligned.
+ */
+#define DSALIB_BTREE_MAP_FANOUT 16
+
+/**
+ * @brief Opaque B+-tree node (internal layout lives in btree_map.c).
+ */
+typedef struct dsalib_btree_map_node dsalib_btree_map_node_t;
+
+/**
+ * @brief Ordered int -> int map implemented as an in-memory B+-tree.
+ *
+ * Compared with a node-per-key binary search tree, each node holds up to
+ * DSALIB_BTREE_MAP_FANOUT keys in a contiguous, cache-line-sized array that
+ * is searched with dsalib_lower_bound(). All values live in the leaves, and
+ * the leaves are linked left to right so range scans walk memory
+ * sequentially instead of chasing parent pointers.
+ *
+ * Insertion and deletion rebalance top-down (nodes are split or refilled on
+ * the way down), so a failed allocation never leaves the tree inconsistent.
+ *
+ * Time Complexities (B = fanout):
+ * - Insert / Erase / Find: O(log_B n) node visits, O(log n) comparisons
+ * - Range scan: O(log_B n + k) for k results
+ * - Bulk load: O(n)
+ */
+typedef struct {
+    dsalib_btree_map_node_t* root; // Always allocated; a leaf when height == 1
+    size_t size;                   // Number of keys stored
+    size_t height;                 // Number of levels (1 = root is a leaf)
+} dsalib_btree_map_t;
+
+/**
+ * @brief Cursor over the leaf chain, produced by dsalib_btree_map_seek().
+ */
+typedef struct {
+    const dsalib_btree_map_node_t* leaf; // Current leaf (NULL when exhausted)
+    size_t index;                        // Position inside the leaf
+} dsalib_btree_map_iter_t;
+
+/**
+ * @brief Creates an empty map.
+ *
+ * @return Pointer to the new map, or NULL if allocation fails
+ */
+dsalib_btree_map_t* dsalib_btree_map_create(void);
+
+/**
+ * @brief Builds a map from keys sorted in strictly ascending order.
+ *
+ * Leaves are packed nearly full and the inner levels are built bottom-up,
+ * which is much faster than n individual inserts.
+ *
+ * @param keys Sorted, duplicate-free keys
+ * @param values Values matching keys (must not be NULL when n > 0)
+ * @param n Number of entries
+ * @return Pointer to the new map, or NULL if the input is not strictly
+ *         ascending, a pointer is NULL, or allocation fails
+ */
+dsalib_btree_map_t* dsalib_btree_map_bulk_load(const int* keys, const int* values, size_t n);
+
+/**
+ * @brief Destroys the map and frees every node. Handles NULL gracefully.
+ */
+void dsalib_btree_map_destroy(dsalib_btree_map_t* map);
+
+/**
+ * @brief Inserts key -> value, overwriting the value if key exists.
+ *
+ * @return true on success, false if map is NULL or allocation fails
+ */
+bool dsalib_btree_map_insert(dsalib_btree_map_t* map, int key, int value);
+
+/**
+ * @brief Looks up key.
+ *
+ * @param value Optional; receives the value when found
+ * @return true if key is present, false otherwise or if map is NULL
+ */
+bool dsalib_btree_map_find(const dsalib_btree_map_t* map, int key, int* value);
+
+/**
+ * @brief Removes key from the map.
+ *
+ * @return true if key was present and removed, false otherwise
+ */
+bool dsalib_btree_map_erase(dsalib_btree_map_t* map, int key);
+
+/**
+ * @brief Returns the number of keys (0 if map is NULL).
+ */
+size_t dsalib_btree_map_size(const dsalib_btree_map_t* map);
+
+/**
+ * @brief Positions a cursor at the first key >= key (lower_bound).
+ *
+ * @return Cursor; exhausted immediately if no such key exists or map is NULL
+ */
+dsalib_btree_map_iter_t dsalib_btree_map_seek(const dsalib_btree_map_t* map, int key);
+
+/**
+ * @brief Reads the entry under the cursor and advances it.
+ *
+ * @param key Optional; receives the key
+ * @param value Optional; receives the value
+ * @return true if an entry was read, false when the cursor is exhausted
+ */
+bool dsalib_btree_map_iter_next(dsalib_btree_map_iter_t* it, int* key, int* value);
+
+/**
+ * @brief Copies all entries with lo <= key < hi, in ascending key order.
+ *
+ * @param keys Output buffer for keys (may be NULL)
+ * @param values Output buffer for values (may be NULL)
+ * @param max Capacity of the output buffers
+ * @return Number of entries copied (at most max)
+ */
+size_t dsalib_btree_map_range(const dsalib_btree_map_t* map, int lo, int hi, int* keys, int* values, size_t max);
+
+#endif // DSALIB_BTREE_MAP_H
@@ -0,0 +1,198 @@
+#ifndef DSALIB_CACHE_H
+#define DSALIB_CACHE_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Eviction policy of a cache.
+ */
+typedef enum {
+    DSALIB_CACHE_LRU,   // Evict the least recently used key
+    DSALIB_CACHE_CLOCK, // Second chance: one reference bit per slot, swept by a hand
+    DSALIB_CACHE_S3FIFO // Small/main FIFOs plus a ghost queue (scan resistant)
+} dsalib_cache_policy_t;
+
+/**
+ * @brief Hit/miss/eviction counters.
+ */
+typedef struct {
+    uint64_t hits;      // get() calls that found the key
+    uint64_t misses;    // get() calls that did not
+    uint64_t evictions; // Keys dropped to make room
+} dsalib_cache_stats_t;
+
+/**
+ * @brief One cache slot; defined in cache.c.
+ */
+typedef struct dsalib_cache_entry dsalib_cache_entry_t;
+
+/**
+ * @brief Intrusive FIFO/recency list threaded through the entry array.
+ */
+typedef struct {
+    uint32_t head; // Newest entry index, or UINT32_MAX if empty
+    uint32_t tail; // Oldest entry index, or UINT32_MAX if empty
+    size_t size;   // Number of entries on the list
+} dsalib_cache_list_t;
+
+/**
+ * @brief Fixed-capacity int -> int cache with O(1) operations (C-Cache).
+ *
+ * All entries live in one array allocated at creation; the hash index
+ * (chained through the entries) and the eviction queues link entries by
+ * 32-bit index, so get/put/erase never allocate.
+ *
+ * Policies:
+ * - LRU: a recency list; a hit moves the entry to the front and the back
+ *   is evicted.
+ * - CLOCK: the entry array is the ring. A hit only sets a reference bit;
+ *   eviction sweeps a hand past referenced slots, clearing their bits, so
+ *   a hit writes one byte instead of relinking a list.
+ * - S3-FIFO: new keys enter a small FIFO (10% of capacity). Keys evicted
+ *   from it unreferenced are remembered in a ghost FIFO (key only, no
+ *   value) while referenced ones move to the main FIFO, which reinserts
+ *   referenced keys (2-bit frequency) instead of evicting them. A miss on
+ *   a ghost key goes straight to main. One-hit wonders and scans therefore
+ *   never reach main.
+ *
+ * Time Complexities (expected):
+ * - Get / Put / Erase: O(1) (CLOCK and S3-FIFO evictions are amortized
+ *   O(1))
+ *
+ * Space: 24 bytes per entry plus a 4-byte hash bucket; S3-FIFO keeps
+ * up to 0.9 * capacity extra ghost entries.
+ */
+typedef struct {
+    dsalib_cache_entry_t* entries; // capacity slots, then the S3-FIFO ghost slots
+    uint32_t* buckets;             // Hash chain heads
+    size_t bucket_mask;            // Number of buckets - 1
+    size_t capacity;               // Maximum number of cached keys
+    size_t count;                  // Number of cached keys (ghosts excluded)
+    dsalib_cache_policy_t policy;  // Eviction policy
+    dsalib_cache_list_t small;     // S3-FIFO small queue
+    dsalib_cache_list_t main;      // LRU recency list / S3-FIFO main queue
+    dsalib_cache_list_t ghost;     // S3-FIFO ghost queue
+    size_t small_capacity;         // S3-FIFO small queue target size
+    size_t ghost_capacity;         // S3-FIFO ghost queue limit
+    uint32_t free_list;            // Unused entries, linked through next
+    uint32_t hand;                 // CLOCK hand
+    dsalib_cache_stats_t stats;    // Counters since creation
+} dsalib_cache_t;
+
+/**
+ * @brief Creates an empty cache.
+ *
+ * @param capacity Maximum number of keys (at least 1, below 2^31)
+ * @param policy Eviction policy
+ * @return Pointer to the new cache, or NULL on invalid arguments or
+ *         allocation failure
+ */
+dsalib_cache_t* dsalib_cache_create(size_t capacity, dsalib_cache_policy_t policy);
+
+/**
+ * @brief Destroys the cache. Handles NULL gracefully.
+ */
+void dsalib_cache_destroy(dsalib_cache_t* cache);
+
+/**
+ * @brief Looks up key and records a hit or a miss.
+ *
+ * @param value Optional; receives the value on a hit
+ * @return true on a hit, false on a miss or if cache is NULL
+ */
+bool dsalib_cache_get(dsalib_cache_t* cache, int key, int* value);
+
+/**
+ * @brief Inserts or updates key, evicting another key if the cache is full.
+ *
+ * Updating an existing key counts as an access for the policy.
+ *
+ * @return true on success, false if cache is NULL
+ */
+bool dsalib_cache_put(dsalib_cache_t* cache, int key, int value);
+
+/**
+ * @brief Removes key without counting an eviction.
+ *
+ * @return true if key was cached and removed, false otherwise
+ */
+bool dsalib_cache_erase(dsalib_cache_t* cache, int key);
+
+/**
+ * @brief Returns the number of cached keys (0 if cache is NULL).
+ */
+size_t dsalib_cache_size(const dsalib_cache_t* cache);
+
+/**
+ * @brief Returns the counters (all zero if cache is NULL).
+ */
+dsalib_cache_stats_t dsalib_cache_stats(const dsalib_cache_t* cache);
+
+/**
+ * @brief One shard of a sharded cache, padded to its own cache line.
+ */
+typedef struct {
+    _Alignas(64) pthread_mutex_t lock; // Guards cache
+    dsalib_cache_t* cache;             // Single-threaded cache of this shard
+} dsalib_sharded_cache_shard_t;
+
+/**
+ * @brief Thread-safe cache made of independently locked shards.
+ *
+ * Keys are spread over a power-of-two number of shards by the upper bits
+ * of dsalib_hash_int(), so threads touching different shards never
+ * contend. Each shard evicts on its own with capacity / num_shards slots,
+ * which approximates the global policy when keys are spread evenly.
+ */
+typedef struct {
+    dsalib_sharded_cache_shard_t* shards; // num_shards shards
+    size_t num_shards;                    // Power of two
+} dsalib_sharded_cache_t;
+
+/**
+ * @brief Creates an empty sharded cache.
+ *
+ * @param num_shards Number of shards, rounded up to a power of two (0
+ *        selects 16)
+ * @param capacity Total number of keys, split evenly (rounded up) over the
+ *        shards
+ * @return Pointer to the new cache, or NULL on invalid arguments or
+ *         allocation failure
+ */
+dsalib_sharded_cache_t* dsalib_sharded_cache_create(size_t num_shards, size_t capacity,
+                                                    dsalib_cache_policy_t policy);
+
+/**
+ * @brief Destroys the cache. Handles NULL gracefully.
+ */
+void dsalib_sharded_cache_destroy(dsalib_sharded_cache_t* cache);
+
+/**
+ * @brief Thread-safe dsalib_cache_get().
+ */
+bool dsalib_sharded_cache_get(dsalib_sharded_cache_t* cache, int key, int* value);
+
+/**
+ * @brief Thread-safe dsalib_cache_put().
+ */
+bool dsalib_sharded_cache_put(dsalib_sharded_cache_t* cache, int key, int value);
+
+/**
+ * @brief Thread-safe dsalib_cache_erase().
+ */
+bool dsalib_sharded_cache_erase(dsalib_sharded_cache_t* cache, int key);
+
+/**
+ * @brief Returns the number of cached keys over all shards.
+ */
+size_t dsalib_sharded_cache_size(dsalib_sharded_cache_t* cache);
+
+/**
+ * @brief Returns the counters summed over all shards.
+ */
+dsalib_cache_stats_t dsalib_sharded_cache_stats(dsalib_sharded_cache_t* cache);
+
+#endif // DSALIB_CACHE_H
@@ -0,0 +1,111 @@
+#ifndef DSALIB_COMPRESSED_ARRAY_H
+#define DSALIB_COMPRESSED_ARRAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of values per compressed block.
+ */
+#define DSALIB_COMPRESSED_ARRAY_BLOCK 128
+
+/**
+ * @brief Read-only sorted int array stored as bit-packed deltas.
+ *
+ * The input is cut into blocks of DSALIB_COMPRESSED_ARRAY_BLOCK values. Each
+ * block stores the differences between consecutive values, packed with the
+ * smallest bit width b that fits the block's largest difference, so a block
+ * costs 16 * b bytes instead of 512. Deltas are laid out in four interleaved
+ * 32-bit lanes (value i lives in lane i % 4), which lets SSE2 unpack four
+ * values per instruction and rebuild them with an in-register prefix sum.
+ *
+ * A skip index of block maxima (one int per block, searched with
+ * dsalib_lower_bound()) selects the single block a query has to decode, so
+ * lookups never decompress more than 128 values.
+ *
+ * Time Complexities (n values, B = 128):
+ * - Create: O(n)
+ * - Lower bound / Contains: O(log(n / B) + B)
+ * - Get: O(B)
+ * - Sequential decode: O(n)
+ *
+ * Space: b / 8 bytes per value plus 16 bytes of metadata per block.
+ */
+typedef struct {
+    uint32_t* words;     // Packed deltas of all blocks, back to back
+    size_t* offsets;     // num_blocks + 1 word offsets into words
+    int* block_first;    // First value of each block
+    int* block_max;      // Last (largest) value of each block: the skip index
+    size_t num_blocks;   // Number of blocks
+    size_t size;         // Number of values
+} dsalib_compressed_array_t;
+
+/**
+ * @brief Compresses a sorted array.
+ *
+ * @param arr Array sorted in ascending order (duplicates allowed; may be
+ *            NULL if size == 0)
+ * @param size Number of elements
+ * @return Pointer to the compressed array, or NULL if arr is NULL, not
+ *         sorted, or allocation fails
+ */
+dsalib_compressed_array_t* dsalib_compressed_array_create(const int* arr, size_t size);
+
+/**
+ * @brief Destroys the compressed array. Handles NULL gracefully.
+ */
+void dsalib_compressed_array_destroy(dsalib_compressed_array_t* array);
+
+/**
+ * @brief Returns the number of values (0 if array is NULL).
+ */
+size_t dsalib_compressed_array_size(const dsalib_compressed_array_t* array);
+
+/**
+ * @brief Returns the heap bytes used by the compressed representation,
+ *        including the skip index (0 if array is NULL).
+ */
+size_t dsalib_compressed_array_memory(const dsalib_compressed_array_t* array);
+
+/**
+ * @brief Decodes one block into out.
+ *
+ * @param block Block index (< num_blocks)
+ * @param out Buffer of at least DSALIB_COMPRESSED_ARRAY_BLOCK ints
+ * @return Number of values in the block (the last block may be short), or
+ *         0 on invalid arguments
+ */
+size_t dsalib_compressed_array_decode_block(const dsalib_compressed_array_t* array, size_t block, int* out);
+
+/**
+ * @brief Decodes every value, in order, into out.
+ *
+ * @param out Buffer of at least size ints
+ * @return Number of values written
+ */
+size_t dsalib_compressed_array_decode(const dsalib_compressed_array_t* array, int* out);
+
+/**
+ * @brief Returns the value at position index.
+ *
+ * @param value Receives the value
+ * @return true on success, false if index is out of range or a pointer is NULL
+ */
+bool dsalib_compressed_array_get(const dsalib_compressed_array_t* array, size_t index, int* value);
+
+/**
+ * @brief Index of the first value >= target, same contract as
+ *        dsalib_lower_bound().
+ *
+ * @return Index of the first value >= target, or size if none (0 if array
+ *         is NULL)
+ */
+size_t dsalib_compressed_array_lower_bound(const dsalib_compressed_array_t* array, int target);
+
+/**
+ * @brief Tests whether target is present.
+ */
+bool dsalib_compressed_array_contains(const dsalib_compressed_array_t* array, int target);
+
+#endif // DSALIB_COMPRESSED_ARRAY_H
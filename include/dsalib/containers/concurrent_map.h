@@ -0,0 +1,121 @@
+#ifndef DSALIB_CONCURRENT_MAP_H
+#define DSALIB_CONCURRENT_MAP_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Open-addressing table of one shard; defined in concurrent_map.c.
+ */
+typedef struct dsalib_concurrent_map_table dsalib_concurrent_map_table_t;
+
+/**
+ * @brief One shard: a linear-probing table, its writer lock and its
+ *        sequence counter. Padded to a cache line so shards do not share
+ *        lines.
+ */
+typedef struct {
+    _Alignas(64) atomic_uint sequence;             // Odd while a writer moves entries
+    _Atomic(dsalib_concurrent_map_table_t*) table; // Current table
+    atomic_size_t count;                           // Keys in this shard
+    pthread_mutex_t lock;                          // Serializes writers of this shard
+    dsalib_concurrent_map_table_t* retired;        // Outgrown tables; guarded by lock
+} dsalib_concurrent_map_shard_t;
+
+/**
+ * @brief Thread-safe int -> int hash map (C-ConcurrentMap).
+ *
+ * Keys are hashed with dsalib_hash_int(); the upper 32 bits pick one of a
+ * power-of-two number of shards and the low bits the home slot in that
+ * shard's linear-probing table. Writers to different shards never contend
+ * (lock striping); writers to one shard take its mutex.
+ *
+ * Lookups take no lock and write no shared memory. Each shard is a
+ * seqlock: an erase, which shifts entries back along the probe sequence,
+ * makes the shard's sequence odd for the duration, and a reader that saw
+ * an odd or changed sequence simply retries. Inserting a new key fills an
+ * empty slot and publishes it with a release store, and updating the
+ * value of an existing key is a single atomic store; neither disturbs
+ * readers.
+ *
+ * Growing is per shard and RCU-style: the writer builds a table of twice
+ * the capacity off to the side and publishes it with one atomic pointer
+ * store, so readers and writers of every other shard keep running and
+ * readers of the growing shard keep using the old table until they
+ * finish. Outgrown tables are kept on the shard's retired list instead of
+ * being freed while a reader might still hold them; since capacities
+ * double, they never add up to more than the live table. They are freed
+ * by dsalib_concurrent_map_reclaim() or on destroy.
+ *
+ * Erase uses backward-shift deletion, so there are no tombstones and a
+ * table never needs a cleanup rehash.
+ *
+ * Time Complexities (expected):
+ * - Find / Insert / Erase: O(1)
+ * - Size: O(number of shards)
+ */
+typedef struct {
+    dsalib_concurrent_map_shard_t* shards; // num_shards shards
+    size_t num_shards;                     // Power of two
+} dsalib_concurrent_map_t;
+
+/**
+ * @brief Creates an empty map.
+ *
+ * @param num_shards Number of shards, rounded up to a power of two (0
+ *        selects 64)
+ * @param initial_capacity Expected number of keys, spread over the shards
+ *        to size their first tables (0 for the minimum)
+ * @return Pointer to the new map, or NULL on allocation failure
+ */
+dsalib_concurrent_map_t* dsalib_concurrent_map_create(size_t num_shards, size_t initial_capacity);
+
+/**
+ * @brief Destroys the map. Handles NULL gracefully.
+ *
+ * Must not run concurrently with any other operation on the map.
+ */
+void dsalib_concurrent_map_destroy(dsalib_concurrent_map_t* map);
+
+/**
+ * @brief Inserts key -> value, overwriting the value if key exists.
+ *
+ * @return true on success, false if map is NULL or allocation fails
+ */
+bool dsalib_concurrent_map_insert(dsalib_concurrent_map_t* map, int key, int value);
+
+/**
+ * @brief Looks up key without taking a lock.
+ *
+ * @param value Optional; receives the value when found
+ * @return true if key is present, false otherwise or if map is NULL
+ */
+bool dsalib_concurrent_map_find(const dsalib_concurrent_map_t* map, int key, int* value);
+
+/**
+ * @brief Removes key from the map.
+ *
+ * @return true if key was present and removed, false otherwise
+ */
+bool dsalib_concurrent_map_erase(dsalib_concurrent_map_t* map, int key);
+
+/**
+ * @brief Returns the number of keys (0 if map is NULL).
+ *
+ * Shards are counted one after another, so under concurrent writes the
+ * result is approximate.
+ */
+size_t dsalib_concurrent_map_size(const dsalib_concurrent_map_t* map);
+
+/**
+ * @brief Frees the tables retired by growth.
+ *
+ * Must only be called while no lookup is running (for example between
+ * phases of a workload); writers are allowed.
+ */
+void dsalib_concurrent_map_reclaim(dsalib_concurrent_map_t* map);
+
+#endif // DSALIB_CONCURRENT_MAP_H
@@ -0,0 +1,98 @@
+#ifndef DSALIB_CUCKOO_FILTER_H
+#define DSALIB_CUCKOO_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Cuckoo filter over int keys: approximate membership with deletes.
+ *
+ * Stores a short fingerprint of each key in one of two candidate buckets
+ * (partial-key cuckoo hashing). Each bucket holds 4 fingerprints packed
+ * into one 64-bit word, so a lookup reads at most two words and compares all
+ * four slots at once with SWAR (SIMD-within-a-register) bit tricks.
+ *
+ * Unlike the Bloom filter, keys can be removed again. Only remove keys that
+ * were actually added, otherwise another key's fingerprint may be deleted.
+ *
+ * Time Complexities:
+ * - Contains / Remove: O(1), two buckets
+ * - Add: O(1) expected; bounded number of relocations when nearly full
+ *
+ * Fingerprints use 4..16 bits derived from the requested false-positive
+ * rate (f = ceil(log2(8 / fpr))); each slot occupies 16 bits in memory.
+ */
+typedef struct {
+    uint64_t* buckets;         // 4 x 16-bit slots per bucket, 0 = empty
+    size_t num_buckets;        // Power of two
+    size_t count;              // Number of stored fingerprints
+    unsigned fingerprint_bits; // 4 .. 16
+    bool has_victim;           // A fingerprint that could not be placed
+    uint16_t victim_fingerprint;
+    size_t victim_bucket;
+} dsalib_cuckoo_filter_t;
+
+/**
+ * @brief Creates an empty filter able to hold about capacity keys.
+ *
+ * Buckets are sized for a 95% load factor.
+ *
+ * @param capacity Expected maximum number of keys
+ * @param fpr Target false-positive rate in (0, 1)
+ * @return Pointer to the new filter, or NULL on invalid arguments or
+ *         allocation failure
+ */
+dsalib_cuckoo_filter_t* dsalib_cuckoo_filter_create(size_t capacity, double fpr);
+
+/**
+ * @brief Creates a filter containing every element of arr.
+ *
+ * @return Pointer to the new filter, or NULL on invalid arguments,
+ *         allocation failure, or if the filter overflows
+ */
+dsalib_cuckoo_filter_t* dsalib_cuckoo_filter_build(const int* arr, size_t size, double fpr);
+
+/**
+ * @brief Destroys the filter. Handles NULL gracefully.
+ */
+void dsalib_cuckoo_filter_destroy(dsalib_cuckoo_filter_t* filter);
+
+/**
+ * @brief Adds key. Adding the same key twice stores it twice.
+ *
+ * @return true on success, false if filter is NULL or full
+ */
+bool dsalib_cuckoo_filter_add(dsalib_cuckoo_filter_t* filter, int key);
+
+/**
+ * @brief Removes one copy of a previously added key.
+ *
+ * @return true if a matching fingerprint was removed
+ */
+bool dsalib_cuckoo_filter_remove(dsalib_cuckoo_filter_t* filter, int key);
+
+/**
+ * @brief Tests key for membership.
+ *
+ * @return false if key is definitely absent, true if it may be present
+ */
+bool dsalib_cuckoo_filter_contains(const dsalib_cuckoo_filter_t* filter, int key);
+
+/**
+ * @brief Tests many keys, prefetching buckets ahead of the checks.
+ *
+ * @param out Receives one result per key (may be NULL to only count)
+ * @return Number of keys that may be present
+ */
+size_t dsalib_cuckoo_filter_contains_batch(const dsalib_cuckoo_filter_t* filter,
+                                           const int* keys,
+                                           size_t size,
+                                           bool* out);
+
+/**
+ * @brief Returns the number of stored keys (0 if filter is NULL).
+ */
+size_t dsalib_cuckoo_filter_size(const dsalib_cuckoo_filter_t* filter);
+
+#endif // DSALIB_CUCKOO_FILTER_H
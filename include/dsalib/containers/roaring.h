@@ -0,0 +1,124 @@
+#ifndef DSALIB_ROARING_H
+#define DSALIB_ROARING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Largest cardinality kept in an array container; beyond it an 8 KiB
+ *        bitmap is smaller.
+ */
+#define DSALIB_ROARING_ARRAY_MAX 4096
+
+/**
+ * @brief One chunk of 2^16 values; defined in roaring.c.
+ */
+typedef struct dsalib_roaring_container dsalib_roaring_container_t;
+
+/**
+ * @brief Compressed set of non-negative ints, roaring-bitmap style (C-Roaring).
+ *
+ * For sparse or clustered sets where a dsalib_bitset_t over the whole
+ * universe would be mostly zero words. Values are split by their high 16
+ * bits into chunks; each non-empty chunk is stored as whichever container
+ * is smaller:
+ * - up to 4096 values: a sorted uint16_t array of the low 16 bits (2 bytes
+ *   per value)
+ * - more: a 65536-bit bitmap (8 KiB)
+ * Empty chunks cost nothing. The chunk keys are a sorted array searched by
+ * binary search. Containers switch representation as they cross the
+ * threshold, so the choice always matches the current contents.
+ *
+ * And / or combine two sets container by container: bitmaps word by word,
+ * arrays by merging, and an array against a bitmap by probing the bitmap.
+ *
+ * Time Complexities (c = chunks, k = values in the affected container):
+ * - Add / Remove: O(log c + k) for an array container, O(log c) for a bitmap
+ * - Contains: O(log c + log k)
+ * - And / Or: O(total container sizes)
+ * - From array / To array: O(n + c)
+ */
+typedef struct {
+    uint16_t* keys;                         // High 16 bits of each chunk, ascending
+    dsalib_roaring_container_t* containers; // Container of each chunk
+    size_t num_containers;                  // Non-empty chunks
+    size_t capacity;                        // Allocated slots in keys / containers
+    size_t cardinality;                     // Number of values
+} dsalib_roaring_t;
+
+/**
+ * @brief Creates an empty set.
+ *
+ * @return Pointer to the new set, or NULL on allocation failure
+ */
+dsalib_roaring_t* dsalib_roaring_create(void);
+
+/**
+ * @brief Creates a set holding the values of a sorted array.
+ *
+ * @param arr Non-negative values in ascending order, duplicates allowed
+ *            (may be NULL if size == 0)
+ * @return Pointer to the new set, or NULL if arr is NULL, not sorted,
+ *         holds a negative value, or allocation fails
+ */
+dsalib_roaring_t* dsalib_roaring_from_array(const int* arr, size_t size);
+
+/**
+ * @brief Destroys the set. Handles NULL gracefully.
+ */
+void dsalib_roaring_destroy(dsalib_roaring_t* set);
+
+/**
+ * @brief Adds value to the set.
+ *
+ * @return true if value was added, false if it was already present, is
+ *         negative, set is NULL, or allocation fails
+ */
+bool dsalib_roaring_add(dsalib_roaring_t* set, int value);
+
+/**
+ * @brief Removes value from the set.
+ *
+ * @return true if value was present, false otherwise
+ */
+bool dsalib_roaring_remove(dsalib_roaring_t* set, int value);
+
+/**
+ * @brief Returns whether value is in the set (false if set is NULL).
+ */
+bool dsalib_roaring_contains(const dsalib_roaring_t* set, int value);
+
+/**
+ * @brief Returns the number of values (0 if set is NULL).
+ */
+size_t dsalib_roaring_cardinality(const dsalib_roaring_t* set);
+
+/**
+ * @brief Returns the heap bytes used by the set (0 if set is NULL).
+ */
+size_t dsalib_roaring_memory(const dsalib_roaring_t* set);
+
+/**
+ * @brief Computes a ∩ b into a new set.
+ *
+ * @return Pointer to the new set, or NULL if either is NULL or allocation
+ *         fails
+ */
+dsalib_roaring_t* dsalib_roaring_and(const dsalib_roaring_t* a, const dsalib_roaring_t* b);
+
+/**
+ * @brief Computes a ∪ b into a new set. Same contract as
+ *        dsalib_roaring_and().
+ */
+dsalib_roaring_t* dsalib_roaring_or(const dsalib_roaring_t* a, const dsalib_roaring_t* b);
+
+/**
+ * @brief Writes all values in ascending order.
+ *
+ * @param out Room for dsalib_roaring_cardinality() elements
+ * @return Number of elements written (0 if either pointer is NULL)
+ */
+size_t dsalib_roaring_to_array(const dsalib_roaring_t* set, int* out);
+
+#endif // DSALIB_ROARING_H
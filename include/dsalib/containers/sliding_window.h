@@ -0,0 +1,138 @@
+#ifndef DSALIB_SLIDING_WINDOW_H
+#define DSALIB_SLIDING_WINDOW_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Streaming sliding-window min/max/sum over int data (C-Window).
+ *
+ * The last window values live in a ring buffer, like dsalib_queue_t but
+ * sized at creation. Two monotonic deques of positions sit next to it: the
+ * min deque keeps positions whose values increase from front to back, the
+ * max deque positions whose values decrease. A pushed value first drops
+ * every entry behind it that it beats, so each position enters and leaves
+ * a deque once, and the front of each deque is the window's min or max.
+ * The running sum adds the new value and subtracts the one falling out.
+ *
+ * Until window values have been pushed, queries cover everything pushed
+ * so far.
+ *
+ * Time Complexities:
+ * - Push: O(1) amortized
+ * - Min/Max/Sum: O(1)
+ *
+ * Space Complexity: O(window)
+ */
+typedef struct {
+    int* values;       // Ring of the last window values, indexed by position & mask
+    size_t* min_queue; // Positions with increasing values; front is the min
+    size_t* max_queue; // Positions with decreasing values; front is the max
+    size_t mask;       // Ring capacity - 1 (capacity is a power of two >= window)
+    size_t window;     // Window length
+    size_t pushed;     // Values pushed so far (the next position)
+    size_t min_head;   // Front of min_queue (counter, indexed & mask)
+    size_t min_tail;   // One past the back of min_queue
+    size_t max_head;   // Front of max_queue
+    size_t max_tail;   // One past the back of max_queue
+    long long sum;     // Exact sum of the values in the window
+} dsalib_sliding_window_t;
+
+/**
+ * @brief Creates an empty window.
+ *
+ * @param window Number of most recent values covered (1 .. UINT32_MAX, so
+ *        the 64-bit running sum cannot overflow)
+ * @return Pointer to the new window, or NULL on invalid size or allocation
+ *         failure
+ */
+dsalib_sliding_window_t* dsalib_sliding_window_create(size_t window);
+
+/**
+ * @brief Destroys the window. Handles NULL gracefully.
+ */
+void dsalib_sliding_window_destroy(dsalib_sliding_window_t* w);
+
+/**
+ * @brief Forgets every pushed value.
+ */
+void dsalib_sliding_window_reset(dsalib_sliding_window_t* w);
+
+/**
+ * @brief Appends a value, evicting the oldest one once the window is full.
+ *
+ * @return false if w is NULL
+ */
+bool dsalib_sliding_window_push(dsalib_sliding_window_t* w, int value);
+
+/**
+ * @brief Returns the number of values currently in the window.
+ */
+size_t dsalib_sliding_window_count(const dsalib_sliding_window_t* w);
+
+/**
+ * @brief Stores the smallest value in the window.
+ *
+ * @return false if w is NULL or empty
+ */
+bool dsalib_sliding_window_min(const dsalib_sliding_window_t* w, int* min);
+
+/**
+ * @brief Stores the largest value in the window.
+ *
+ * @return false if w is NULL or empty
+ */
+bool dsalib_sliding_window_max(const dsalib_sliding_window_t* w, int* max);
+
+/**
+ * @brief Returns the exact sum of the window (0 if w is NULL).
+ */
+long long dsalib_sliding_window_sum(const dsalib_sliding_window_t* w);
+
+/**
+ * @brief Stores the window sum as an int.
+ *
+ * A sum outside the int range is clamped to INT_MIN/INT_MAX, as safe_add()
+ * from dsalib/math/add.h does, and reported by returning false.
+ *
+ * @return true if the sum fits in an int, false on overflow or NULL
+ *         arguments
+ */
+bool dsalib_sliding_window_sum_int(const dsalib_sliding_window_t* w, int* sum);
+
+/**
+ * @brief Minimum of every window of an array: out[i] = min(arr[i .. i+window)).
+ *
+ * Windows of up to 8 values take the minimum of shifted SSE2 loads, four
+ * outputs at a time. Longer windows use the van Herk/Gil-Werman scheme:
+ * the array is cut into blocks of window values, and each output combines
+ * a suffix minimum of one block with a prefix minimum of the next. That
+ * costs three comparisons per element whatever the window length, with
+ * no data-dependent branches, and the combine step is vectorized.
+ *
+ * Time Complexity: O(n)
+ * Space Complexity: O(window) scratch
+ *
+ * @param arr Input array
+ * @param n Number of elements
+ * @param window Window length (>= 1)
+ * @param out Output buffer of n - window + 1 entries
+ * @return Number of outputs written (n - window + 1), or 0 on NULL
+ *         arguments, window == 0, window > n or allocation failure
+ */
+size_t dsalib_sliding_min(const int* arr, size_t n, size_t window, int* out);
+
+/**
+ * @brief Maximum of every window of an array; see dsalib_sliding_min().
+ */
+size_t dsalib_sliding_max(const int* arr, size_t n, size_t window, int* out);
+
+/**
+ * @brief Exact sum of every window of an array, updated in O(1) per
+ *        output.
+ *
+ * @return Number of outputs written, as for dsalib_sliding_min()
+ */
+size_t dsalib_sliding_sum(const int* arr, size_t n, size_t window, long long* out);
+
+#endif // DSALIB_SLIDING_WINDOW_H
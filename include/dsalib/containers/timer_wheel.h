@@ -0,0 +1,136 @@
+#ifndef DSALIB_TIMER_WHEEL_H
+#define DSALIB_TIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of wheels and slots per wheel (8 bits of the tick each).
+ */
+#define DSALIB_TIMER_WHEEL_LEVELS 4
+#define DSALIB_TIMER_WHEEL_SLOTS 256
+
+/**
+ * @brief Identifies a scheduled timer; never 0 for a valid timer.
+ *
+ * Packs a pool index with a generation counter, so cancelling a timer
+ * that already fired (or was cancelled) is detected instead of hitting
+ * whichever timer reused its slot.
+ */
+typedef uint64_t dsalib_timer_id_t;
+
+/**
+ * @brief Called once for every expired timer.
+ *
+ * @param ctx User context passed to dsalib_timer_wheel_advance()
+ * @param timer The expired timer (already released; cancelling it fails)
+ * @param data Pointer given to dsalib_timer_wheel_schedule()
+ */
+typedef void (*dsalib_timer_fn)(void* ctx, dsalib_timer_id_t timer, void* data);
+
+/**
+ * @brief Timer node in the pool; defined in timer_wheel.c.
+ */
+typedef struct dsalib_timer_node dsalib_timer_node_t;
+
+/**
+ * @brief 64-byte block of node indices; defined in timer_wheel.c.
+ */
+typedef struct dsalib_timer_block dsalib_timer_block_t;
+
+/**
+ * @brief Hierarchical timing wheel for large numbers of timeouts (C-TimerWheel).
+ *
+ * Time is an integer tick count chosen by the caller (e.g. milliseconds).
+ * Four wheels of 256 slots cover 2^8, 2^16, 2^24 and 2^32 ticks ahead; a
+ * timer goes into the coarsest wheel it needs, in the slot selected by
+ * the matching 8 bits of its expiry, like a power-of-two ring buffer
+ * indexed with a mask.
+ *
+ * A slot holds the indices of its timers in a chain of 64-byte blocks
+ * rather than a linked list through the timers themselves, so firing or
+ * cascading a slot reads each block once and can fetch its 14 timers in
+ * parallel instead of chasing one cache miss after another. Cancel moves
+ * the slot's last index into the hole. Timer nodes and blocks come from
+ * pools that grow in schedule (enough blocks are kept in reserve for the
+ * worst case), so advance never allocates and cannot fail.
+ *
+ * Advancing to a tick whose low 8 bits are zero first empties the next
+ * slot of the wheel above ("cascading") into the finer wheels; a timer is
+ * moved at most once per level. Expiries beyond 2^32 ticks are parked in
+ * the last slot in range and re-placed when it cascades. A bitmap of
+ * non-empty slots per wheel lets advance jump straight to the next tick
+ * that fires or cascades anything, so idle stretches cost nothing.
+ *
+ * Time Complexities:
+ * - Schedule / Cancel: O(1)
+ * - Advance: O(timers fired + timers cascaded + slots visited); empty
+ *   ticks are skipped
+ */
+typedef struct {
+    dsalib_timer_node_t* nodes;   // Node pool; grown by doubling
+    size_t capacity;              // Number of nodes in the pool
+    size_t count;                 // Pending timers
+    uint32_t free_list;           // Unused nodes
+    dsalib_timer_block_t* blocks; // Block pool; grown by doubling
+    size_t num_blocks;            // Number of blocks in the pool
+    uint32_t free_blocks;         // Unused blocks
+    uint64_t now;                 // Last tick processed
+    uint32_t slots[DSALIB_TIMER_WHEEL_LEVELS * DSALIB_TIMER_WHEEL_SLOTS];         // Newest block of each slot
+    uint64_t occupied[DSALIB_TIMER_WHEEL_LEVELS * DSALIB_TIMER_WHEEL_SLOTS / 64]; // Non-empty slot bitmap
+} dsalib_timer_wheel_t;
+
+/**
+ * @brief Creates an empty wheel.
+ *
+ * @param now Current tick; timers expire relative to it
+ * @param initial_capacity Number of pending timers to make room for (the
+ *        pool grows beyond it as needed)
+ * @return Pointer to the new wheel, or NULL on allocation failure
+ */
+dsalib_timer_wheel_t* dsalib_timer_wheel_create(uint64_t now, size_t initial_capacity);
+
+/**
+ * @brief Destroys the wheel without firing pending timers. Handles NULL
+ *        gracefully.
+ */
+void dsalib_timer_wheel_destroy(dsalib_timer_wheel_t* wheel);
+
+/**
+ * @brief Schedules a timer to fire when the wheel advances to expires.
+ *
+ * An expiry at or before the current tick is treated as due at the next
+ * tick.
+ *
+ * @param data Passed back to the callback
+ * @return Timer id, or 0 if wheel is NULL or allocation fails
+ */
+dsalib_timer_id_t dsalib_timer_wheel_schedule(dsalib_timer_wheel_t* wheel, uint64_t expires, void* data);
+
+/**
+ * @brief Cancels a pending timer.
+ *
+ * @return true if the timer was pending, false if it already fired, was
+ *         cancelled, or the id is invalid
+ */
+bool dsalib_timer_wheel_cancel(dsalib_timer_wheel_t* wheel, dsalib_timer_id_t timer);
+
+/**
+ * @brief Advances to tick now, firing every timer with expiry <= now.
+ *
+ * Timers fire in expiry order (in no particular order within a tick).
+ * The callback may schedule and cancel timers; a timer it schedules for
+ * the current tick or earlier is due at the next tick.
+ *
+ * @param fn Callback, may be NULL to drop expired timers silently
+ * @return Number of timers fired
+ */
+size_t dsalib_timer_wheel_advance(dsalib_timer_wheel_t* wheel, uint64_t now, dsalib_timer_fn fn, void* ctx);
+
+/**
+ * @brief Returns the number of pending timers (0 if wheel is NULL).
+ */
+size_t dsalib_timer_wheel_size(const dsalib_timer_wheel_t* wheel);
+
+#endif // DSALIB_TIMER_WHEEL_H
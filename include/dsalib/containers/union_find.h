@@ -0,0 +1,178 @@
+#ifndef DSALIB_UNION_FIND_H
+#define DSALIB_UNION_FIND_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Disjoint set (union-find) over the elements 0 .. count-1.
+ *
+ * Array-backed: parent[i] is the parent of element i (roots point to
+ * themselves) and size[r] is the number of elements in the set rooted at r.
+ * Elements are stored as 32-bit indices to halve the memory traffic, so at
+ * most UINT32_MAX elements are supported.
+ *
+ * - find() uses path halving: every visited node is re-pointed to its
+ *   grandparent, flattening the tree without a second pass.
+ * - union() uses union by size: the smaller tree is linked below the root
+ *   of the larger one.
+ *
+ * Time Complexities (α = inverse Ackermann function):
+ * - Find: O(α(n)) amortized
+ * - Union: O(α(n)) amortized
+ * - Connected: O(α(n)) amortized
+ * - Count sets: O(1)
+ */
+typedef struct {
+    uint32_t* parent; // parent[i] == i for roots
+    uint32_t* size;   // Set size, valid for roots only
+    size_t count;     // Number of elements
+    size_t sets;      // Current number of disjoint sets
+} dsalib_union_find_t;
+
+/**
+ * @brief Creates a union-find where every element is its own set.
+ *
+ * @param count Number of elements (1 .. UINT32_MAX)
+ * @return Pointer to the new structure, or NULL if count is out of range
+ *         or allocation fails
+ */
+dsalib_union_find_t* dsalib_union_find_create(size_t count);
+
+/**
+ * @brief Frees the union-find. Handles NULL gracefully.
+ */
+void dsalib_union_find_destroy(dsalib_union_find_t* uf);
+
+/**
+ * @brief Returns the representative (root) of the set containing x.
+ *
+ * @return Root index, or SIZE_MAX if uf is NULL or x is out of range
+ */
+size_t dsalib_union_find_find(dsalib_union_find_t* uf, size_t x);
+
+/**
+ * @brief Merges the sets containing x and y.
+ *
+ * @return true if two different sets were merged, false if x and y were
+ *         already in the same set or an argument is invalid
+ */
+bool dsalib_union_find_union(dsalib_union_find_t* uf, size_t x, size_t y);
+
+/**
+ * @brief Checks whether x and y belong to the same set.
+ *
+ * @return true if connected, false otherwise or on invalid arguments
+ */
+bool dsalib_union_find_connected(dsalib_union_find_t* uf, size_t x, size_t y);
+
+/**
+ * @brief Returns the number of elements in the set containing x (0 on error).
+ */
+size_t dsalib_union_find_set_size(dsalib_union_find_t* uf, size_t x);
+
+/**
+ * @brief Returns the current number of disjoint sets (0 if uf is NULL).
+ */
+size_t dsalib_union_find_count_sets(const dsalib_union_find_t* uf);
+
+/**
+ * @brief Lock-free union-find for concurrent unions from many threads.
+ *
+ * The parent array is updated with compare-and-swap only. Union by size is
+ * not possible without locks (size and parent cannot change in one atomic
+ * step), so roots are linked by a fixed pseudo-random priority derived from
+ * the index instead, which keeps the expected tree depth logarithmic.
+ * find() performs path halving with CAS; losing a race only means the
+ * shortcut is skipped.
+ *
+ * All operations may be called concurrently. Once every union has returned,
+ * find() reflects the final partition.
+ */
+typedef struct {
+    _Atomic uint32_t* parent; // parent[i] == i for roots
+    size_t count;             // Number of elements
+    atomic_size_t sets;       // Current number of disjoint sets
+} dsalib_concurrent_union_find_t;
+
+/**
+ * @brief An undirected edge (u, v) between element indices.
+ */
+typedef struct {
+    uint32_t u;
+    uint32_t v;
+} dsalib_edge_t;
+
+/**
+ * @brief Creates a concurrent union-find with count singleton sets.
+ *
+ * @return Pointer to the new structure, or NULL on invalid count or
+ *         allocation failure
+ */
+dsalib_concurrent_union_find_t* dsalib_concurrent_union_find_create(size_t count);
+
+/**
+ * @brief Frees the structure. Must not race with other operations.
+ */
+void dsalib_concurrent_union_find_destroy(dsalib_concurrent_union_find_t* uf);
+
+/**
+ * @brief Thread-safe find with CAS-based path halving.
+ *
+ * @return Root index, or SIZE_MAX on invalid arguments
+ */
+size_t dsalib_concurrent_union_find_find(dsalib_concurrent_union_find_t* uf, size_t x);
+
+/**
+ * @brief Thread-safe union.
+ *
+ * @return true if this call merged two different sets
+ */
+bool dsalib_concurrent_union_find_union(dsalib_concurrent_union_find_t* uf, size_t x, size_t y);
+
+/**
+ * @brief Thread-safe connectivity check.
+ */
+bool dsalib_concurrent_union_find_connected(dsalib_concurrent_union_find_t* uf, size_t x, size_t y);
+
+/**
+ * @brief Returns the current number of disjoint sets (0 if uf is NULL).
+ */
+size_t dsalib_concurrent_union_find_count_sets(const dsalib_concurrent_union_find_t* uf);
+
+/**
+ * @brief Applies union(u, v) for every edge using num_threads worker threads.
+ *
+ * The edge array is split into equal contiguous chunks, one per thread.
+ * Edges with out-of-range endpoints are ignored.
+ *
+ * @param num_threads Number of threads (0 or 1 runs on the calling thread)
+ * @return true on success, false on invalid arguments
+ */
+bool dsalib_concurrent_union_find_union_edges(dsalib_concurrent_union_find_t* uf,
+                                              const dsalib_edge_t* edges,
+                                              size_t num_edges,
+                                              size_t num_threads);
+
+/**
+ * @brief Labels the connected components of an undirected graph in parallel.
+ *
+ * After the call, labels[i] == labels[j] iff i and j are connected; each
+ * label is the index of its component's representative.
+ *
+ * @param count Number of vertices
+ * @param edges Edge list
+ * @param num_edges Number of edges
+ * @param num_threads Number of worker threads
+ * @param labels Output array with room for count entries
+ * @return Number of connected components, or 0 on error
+ */
+size_t dsalib_connected_components(size_t count,
+                                   const dsalib_edge_t* edges,
+                                   size_t num_edges,
+                                   size_t num_threads,
+                                   uint32_t* labels);
+
+#endif // DSALIB_UNION_FIND_H
@@ -0,0 +1,201 @@
+#ifndef DSALIB_VECTOR_H
+#define DSALIB_VECTOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Bytes of element storage embedded in every vector.
+ *
+ * 64 bytes hold 16 ints or 8 pointers/doubles before the first malloc.
+ */
+#define DSALIB_VECTOR_INLINE_BYTES 64
+
+/**
+ * @brief Capacity growth policy used when a vector runs out of room.
+ */
+typedef enum {
+    DSALIB_VECTOR_GROW_2X = 0, // Double (fewest reallocations)
+    DSALIB_VECTOR_GROW_1_5X    // Grow by half (less slack, lets freed blocks be reused)
+} dsalib_vector_growth_t;
+
+/**
+ * @brief Generic growable array ("C-Vector") with a small-buffer optimization.
+ *
+ * Elements are stored by value as elem_size-byte blobs copied with memcpy.
+ * Up to DSALIB_VECTOR_INLINE_BYTES / elem_size elements live inside the
+ * struct itself, so a vector declared on the stack (see dsalib_vector_init())
+ * that stays short never touches the heap. Once it outgrows the inline
+ * buffer, elements move to a malloc'ed buffer that grows by the selected
+ * policy.
+ *
+ * The struct never points into itself (data is found through
+ * dsalib_vector_data()), so a vector may be copied or moved with plain
+ * assignment as long as only one copy is used afterwards.
+ *
+ * Time Complexities:
+ * - Push back: O(1) amortized
+ * - Pop back / Swap remove / At: O(1)
+ * - Insert / Erase range: O(n) (one memmove)
+ * - Adopt / Detach: O(1) for heap buffers
+ */
+typedef struct {
+    void* heap;                    // Heap buffer, or NULL while using inline storage
+    size_t size;                   // Number of elements
+    size_t capacity;               // Capacity in elements
+    size_t elem_size;              // Size of one element in bytes
+    dsalib_vector_growth_t growth; // Growth policy
+    _Alignas(16) unsigned char inline_data[DSALIB_VECTOR_INLINE_BYTES]; // Small buffer
+} dsalib_vector_t;
+
+/**
+ * @brief Initializes a vector in caller-provided storage (e.g. on the stack).
+ *
+ * @param vec Vector to initialize
+ * @param elem_size Size of one element in bytes (must be > 0)
+ * @param growth Growth policy
+ * @return true on success, false if vec is NULL or elem_size is 0
+ */
+bool dsalib_vector_init(dsalib_vector_t* vec, size_t elem_size, dsalib_vector_growth_t growth);
+
+/**
+ * @brief Frees the heap buffer (if any) and leaves vec empty and reusable.
+ *        Handles NULL gracefully.
+ */
+void dsalib_vector_release(dsalib_vector_t* vec);
+
+/**
+ * @brief Allocates and initializes a vector on the heap.
+ *
+ * @return Pointer to the new vector, or NULL if elem_size is 0 or
+ *         allocation fails
+ */
+dsalib_vector_t* dsalib_vector_create(size_t elem_size, dsalib_vector_growth_t growth);
+
+/**
+ * @brief Destroys a vector made by dsalib_vector_create(). Handles NULL
+ *        gracefully.
+ */
+void dsalib_vector_destroy(dsalib_vector_t* vec);
+
+/**
+ * @brief Returns the number of elements (0 if vec is NULL).
+ */
+size_t dsalib_vector_size(const dsalib_vector_t* vec);
+
+/**
+ * @brief Returns the capacity in elements (0 if vec is NULL).
+ */
+size_t dsalib_vector_capacity(const dsalib_vector_t* vec);
+
+/**
+ * @brief Returns true while the elements live in the inline buffer.
+ */
+bool dsalib_vector_is_inline(const dsalib_vector_t* vec);
+
+/**
+ * @brief Returns a pointer to the first element (NULL if vec is NULL).
+ *
+ * The pointer is invalidated by any operation that grows the vector, and by
+ * moving the vector while it is inline.
+ */
+void* dsalib_vector_data(dsalib_vector_t* vec);
+
+/**
+ * @brief Returns a pointer to element index, or NULL if out of range.
+ */
+void* dsalib_vector_at(dsalib_vector_t* vec, size_t index);
+
+/**
+ * @brief Ensures room for at least capacity elements.
+ *
+ * @return true on success, false if vec is NULL or allocation fails
+ */
+bool dsalib_vector_reserve(dsalib_vector_t* vec, size_t capacity);
+
+/**
+ * @brief Shrinks the capacity to the size, moving back inline if it fits.
+ *
+ * @return true on success, false if vec is NULL or allocation fails
+ */
+bool dsalib_vector_shrink_to_fit(dsalib_vector_t* vec);
+
+/**
+ * @brief Removes all elements, keeping the capacity.
+ */
+void dsalib_vector_clear(dsalib_vector_t* vec);
+
+/**
+ * @brief Appends a copy of *elem.
+ *
+ * @return true on success, false if a pointer is NULL or allocation fails
+ */
+bool dsalib_vector_push_back(dsalib_vector_t* vec, const void* elem);
+
+/**
+ * @brief Removes the last element.
+ *
+ * @param out Optional; receives the removed element
+ * @return true on success, false if the vector is empty or NULL
+ */
+bool dsalib_vector_pop_back(dsalib_vector_t* vec, void* out);
+
+/**
+ * @brief Inserts count elements from elems before position index.
+ *
+ * @param index Insertion point (<= size)
+ * @param elems Elements to copy (must not overlap the vector's storage)
+ * @return true on success, false on invalid arguments or allocation failure
+ *         (the vector is unchanged on failure)
+ */
+bool dsalib_vector_insert(dsalib_vector_t* vec, size_t index, const void* elems, size_t count);
+
+/**
+ * @brief Erases count elements starting at index, preserving order.
+ *
+ * @return true on success, false if the range is out of bounds or vec is NULL
+ */
+bool dsalib_vector_erase(dsalib_vector_t* vec, size_t index, size_t count);
+
+/**
+ * @brief Removes element index in O(1) by moving the last element into its
+ *        place (does not preserve order).
+ *
+ * @param out Optional; receives the removed element
+ * @return true on success, false if index is out of range or vec is NULL
+ */
+bool dsalib_vector_swap_remove(dsalib_vector_t* vec, size_t index, void* out);
+
+/**
+ * @brief Takes ownership of a malloc'ed buffer without copying it.
+ *
+ * The vector's previous contents are released.
+ *
+ * @param buffer Buffer from malloc/realloc holding size elements
+ * @param size Number of elements in buffer
+ * @param capacity Number of elements buffer has room for (>= size)
+ * @return true on success, false on invalid arguments (buffer is then still
+ *         owned by the caller)
+ */
+bool dsalib_vector_adopt(dsalib_vector_t* vec, void* buffer, size_t size, size_t capacity);
+
+/**
+ * @brief Hands the element buffer to the caller and leaves vec empty.
+ *
+ * A heap buffer is returned as is; inline elements are copied into a new
+ * exactly-sized allocation. The caller must free() the result.
+ *
+ * @param size Optional; receives the number of elements
+ * @param capacity Optional; receives the buffer capacity in elements
+ * @return The buffer, or NULL if vec is NULL, empty, or allocation fails
+ */
+void* dsalib_vector_detach(dsalib_vector_t* vec, size_t* size, size_t* capacity);
+
+/**
+ * @brief Exchanges the contents of two vectors with the same element size.
+ *
+ * @return true on success, false if a pointer is NULL or element sizes differ
+ */
+bool dsalib_vector_swap(dsalib_vector_t* a, dsalib_vector_t* b);
+
+#endif // DSALIB_VECTOR_H
@@ -0,0 +1,191 @@
+#ifndef DSALIB_ASTAR_H
+#define DSALIB_ASTAR_H
+
+#include "dsalib/graph/csr.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Returned by the searches when the target cannot be reached (or
+ *        on invalid arguments).
+ */
+#define DSALIB_SEARCH_UNREACHABLE (-1LL)
+
+/**
+ * @brief Grid move costs before scaling by the entered cell's cost; 14/10
+ *        approximates sqrt(2) in integers.
+ */
+#define DSALIB_GRID_COST_STRAIGHT 10
+#define DSALIB_GRID_COST_DIAGONAL 14
+
+/**
+ * @brief Occupancy / cost grid searched as an implicit graph.
+ *
+ * Cell (x, y) is node y * width + x. Entering a cell costs its value times
+ * DSALIB_GRID_COST_STRAIGHT (or _DIAGONAL); 0 marks a wall. With diagonal
+ * moves enabled a diagonal step may not cut the corner of a wall.
+ */
+typedef struct {
+    const uint8_t* cells; // width * height entry costs, row-major; 0 = blocked
+    uint32_t width;       // Cells per row
+    uint32_t height;      // Number of rows
+    bool diagonal;        // 8-connected if true, 4-connected otherwise
+} dsalib_grid_t;
+
+/**
+ * @brief Heuristic estimate of the cost from node to goal.
+ *
+ * Must never overestimate the true cost (admissible) for the searches to
+ * return shortest paths. A consistent heuristic (h(u) <= cost(u, v) + h(v))
+ * also guarantees no node is expanded twice; an inconsistent one still
+ * gives correct results, with nodes reopened as needed.
+ *
+ * @param ctx User context passed to the search
+ */
+typedef long long (*dsalib_heuristic_fn)(void* ctx, uint32_t node, uint32_t goal);
+
+/**
+ * @brief Search side (node records and open set); defined in astar.c.
+ */
+typedef struct dsalib_search_side dsalib_search_side_t;
+
+/**
+ * @brief Reusable scratch space for point-to-point searches (C-AStar).
+ *
+ * Holds one record per node (distance, parent, heuristic, heap position)
+ * and a 4-ary heap of open nodes indexed by those positions, so an
+ * improved distance is a decrease-key in place rather than a duplicate
+ * entry. Records carry the generation of the query that last touched
+ * them, and every query starts by bumping the generation: stale records
+ * are recognized on sight, so starting a new query costs O(1) and a whole
+ * query O(touched nodes) instead of re-zeroing arrays sized for the graph.
+ * The stamps are only cleared when the 32-bit generation wraps.
+ *
+ * A state is not thread-safe; give each thread its own and reuse it for
+ * all of that thread's queries. The backward side is allocated by the
+ * first bidirectional query.
+ *
+ * Space: 48 bytes per node per search direction.
+ */
+typedef struct {
+    size_t capacity;                // Largest node count the state can search
+    uint32_t generation;            // Stamp of the current query
+    dsalib_search_side_t* sides[2]; // Forward and backward sides (backward may be NULL)
+    uint32_t source;                // Last query's source
+    uint32_t target;                // Last query's target
+    uint32_t meet;                  // Where the two sides met (target for A*)
+    bool bidirectional;             // Last query used both sides
+    bool found;                     // Last query reached the target
+    size_t expanded;                // Nodes removed from the open set by the last query
+} dsalib_search_state_t;
+
+/**
+ * @brief Creates search state for graphs of up to capacity nodes.
+ *
+ * @return Pointer to the new state, or NULL if capacity is 0 or above
+ *         UINT32_MAX, or allocation fails
+ */
+dsalib_search_state_t* dsalib_search_state_create(size_t capacity);
+
+/**
+ * @brief Destroys the state. Handles NULL gracefully.
+ */
+void dsalib_search_state_destroy(dsalib_search_state_t* state);
+
+/**
+ * @brief Manhattan distance on a dsalib_grid_t (ctx), scaled by
+ *        DSALIB_GRID_COST_STRAIGHT. Admissible for 4-connected grids.
+ */
+long long dsalib_heuristic_manhattan(void* ctx, uint32_t node, uint32_t goal);
+
+/**
+ * @brief Octile distance on a dsalib_grid_t (ctx): diagonal steps first,
+ *        then straight ones. Admissible for 8-connected grids.
+ */
+long long dsalib_heuristic_octile(void* ctx, uint32_t node, uint32_t goal);
+
+/**
+ * @brief A* from source to target on a grid.
+ *
+ * The built-in heuristics are recognized and evaluated inline instead of
+ * through the function pointer. Ties on f = g + h go to the node closer to
+ * the goal, which keeps the search narrow on open ground.
+ *
+ * @param heuristic Estimate to the target, or NULL for plain Dijkstra
+ * @param ctx Passed to heuristic (the built-ins expect the grid)
+ * @param state Search state with capacity >= width * height
+ * @return Cost of the shortest path, or DSALIB_SEARCH_UNREACHABLE if there
+ *         is none, an endpoint is a wall or out of range, or an argument
+ *         is invalid
+ */
+long long dsalib_astar_grid(const dsalib_grid_t* grid,
+                            uint32_t source,
+                            uint32_t target,
+                            dsalib_heuristic_fn heuristic,
+                            void* ctx,
+                            dsalib_search_state_t* state);
+
+/**
+ * @brief A* from source to target on a weighted CSR graph.
+ *
+ * @param weights Non-negative weight of each edge, parallel to
+ *        graph->targets, or NULL for unit weights
+ * @param heuristic Estimate to the target, or NULL for plain Dijkstra
+ * @return Same as dsalib_astar_grid()
+ */
+long long dsalib_astar_csr(const dsalib_csr_graph_t* graph,
+                           const int* weights,
+                           uint32_t source,
+                           uint32_t target,
+                           dsalib_heuristic_fn heuristic,
+                           void* ctx,
+                           dsalib_search_state_t* state);
+
+/**
+ * @brief Bidirectional Dijkstra on a grid.
+ *
+ * Searches forward from source and backward from target, always expanding
+ * the side with the smaller tentative distance, and stops once the two
+ * open sets' minima add up to at least the best meeting path found. Each
+ * side covers a ball of about half the radius, roughly half the nodes of
+ * one Dijkstra search on a grid, without needing a heuristic.
+ *
+ * @return Same as dsalib_astar_grid()
+ */
+long long dsalib_bidirectional_dijkstra_grid(const dsalib_grid_t* grid,
+                                             uint32_t source,
+                                             uint32_t target,
+                                             dsalib_search_state_t* state);
+
+/**
+ * @brief Bidirectional Dijkstra on a weighted CSR graph.
+ *
+ * The backward side walks the transpose (see dsalib_csr_graph_transpose()).
+ *
+ * @param weights Forward edge weights, or NULL for unit weights
+ * @param reverse Transpose of graph, or NULL if graph is symmetric (every
+ *        edge u -> v has a twin v -> u of the same weight)
+ * @param reverse_weights Weights parallel to reverse->targets (ignored
+ *        when reverse is NULL)
+ * @return Same as dsalib_astar_grid()
+ */
+long long dsalib_bidirectional_dijkstra_csr(const dsalib_csr_graph_t* graph,
+                                            const int* weights,
+                                            const dsalib_csr_graph_t* reverse,
+                                            const int* reverse_weights,
+                                            uint32_t source,
+                                            uint32_t target,
+                                            dsalib_search_state_t* state);
+
+/**
+ * @brief Writes the path found by the state's last query.
+ *
+ * @param out Room for the path (source first, target last), or NULL to
+ *        only get its length
+ * @return Number of nodes on the path, or 0 if the last query found none
+ */
+size_t dsalib_search_path(const dsalib_search_state_t* state, uint32_t* out);
+
+#endif // DSALIB_ASTAR_H
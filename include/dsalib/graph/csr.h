@@ -0,0 +1,71 @@
+#ifndef DSALIB_CSR_H
+#define DSALIB_CSR_H
+
+#include "dsalib/containers/union_find.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Directed graph in compressed sparse row (CSR) form.
+ *
+ * The successors of node u are targets[offsets[u] .. offsets[u + 1]), so
+ * walking a node's out-edges is a sequential scan of one array instead of
+ * a linked-list traversal. The graph is immutable once built.
+ *
+ * Space: (num_nodes + 1) offsets plus one 32-bit target per edge.
+ */
+typedef struct {
+    size_t num_nodes;  // Nodes are 0 .. num_nodes-1
+    size_t num_edges;  // Number of directed edges
+    size_t* offsets;   // num_nodes + 1 entries; offsets[num_nodes] == num_edges
+    uint32_t* targets; // Edge targets, grouped by source node
+} dsalib_csr_graph_t;
+
+/**
+ * @brief Builds a CSR graph from a list of directed edges u -> v.
+ *
+ * Edges keep their input order within each source node (counting sort).
+ *
+ * @param num_nodes Number of nodes (1 .. UINT32_MAX)
+ * @param edges Edge list (may be NULL if num_edges == 0)
+ * @param num_edges Number of edges
+ * @return Pointer to the new graph, or NULL if num_nodes is out of range, an
+ *         endpoint is >= num_nodes, or allocation fails
+ */
+dsalib_csr_graph_t* dsalib_csr_graph_create(size_t num_nodes, const dsalib_edge_t* edges, size_t num_edges);
+
+/**
+ * @brief Builds the transpose (every edge u -> v becomes v -> u).
+ *
+ * Per-edge data laid out parallel to targets is carried along: weights[i]
+ * belongs to the edge at targets[i], and transposed_weights receives the
+ * same weights in the order of the new graph's targets.
+ *
+ * @param weights Per-edge weights, or NULL
+ * @param transposed_weights Output with room for num_edges weights
+ *        (ignored when weights is NULL)
+ * @return Pointer to the new graph, or NULL if graph is NULL, weights is
+ *         given without transposed_weights, or allocation fails
+ */
+dsalib_csr_graph_t* dsalib_csr_graph_transpose(const dsalib_csr_graph_t* graph, const int* weights, int* transposed_weights);
+
+/**
+ * @brief Destroys the graph. Handles NULL gracefully.
+ */
+void dsalib_csr_graph_destroy(dsalib_csr_graph_t* graph);
+
+/**
+ * @brief Returns the number of out-edges of node (0 if out of range).
+ */
+size_t dsalib_csr_graph_out_degree(const dsalib_csr_graph_t* graph, size_t node);
+
+/**
+ * @brief Returns a pointer to node's successors and stores their count.
+ *
+ * @return Pointer into targets, or NULL if graph is NULL or node is out of
+ *         range
+ */
+const uint32_t* dsalib_csr_graph_successors(const dsalib_csr_graph_t* graph, size_t node, size_t* count);
+
+#endif // DSALIB_CSR_H
@@ -0,0 +1,81 @@
+#ifndef DSALIB_FLOYD_WARSHALL_H
+#define DSALIB_FLOYD_WARSHALL_H
+
+#include "dsalib/graph/mst.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Distance of an unreachable pair.
+ */
+#define DSALIB_FLOYD_WARSHALL_INF INT_MAX
+
+/**
+ * @brief All-pairs shortest paths on a dense distance matrix (C-APSP).
+ *
+ * dist is an n x n row-major int matrix: dist[i * n + j] is the length of
+ * the shortest known path from i to j, DSALIB_FLOYD_WARSHALL_INF if there
+ * is none. Path lengths are added with saturation, as safe_add() from
+ * dsalib/math/add.h does, and INF plus any weight stays INF, so long paths
+ * clamp at INT_MAX/INT_MIN instead of wrapping (a path clamped to INT_MAX
+ * reads as unreachable).
+ *
+ * Negative edge weights are allowed. A negative cycle shows up as a
+ * negative diagonal entry, and both solvers report it by returning false.
+ */
+
+/**
+ * @brief Fills dist from a directed edge list.
+ *
+ * The diagonal is set to 0, every other entry to INF, and then each edge
+ * u -> v lowers dist[u * n + v] to its weight (the lightest of parallel
+ * edges wins). Edges with an endpoint >= n are skipped.
+ *
+ * @param dist Output matrix of n * n entries
+ * @param n Number of vertices
+ * @param edges Edge list (may be NULL if edge_count == 0)
+ * @param edge_count Number of edges
+ * @return false if dist is NULL (or edges is NULL with edge_count > 0)
+ */
+bool dsalib_floyd_warshall_init(int* dist, size_t n, const dsalib_weighted_edge_t* edges, size_t edge_count);
+
+/**
+ * @brief Textbook Floyd-Warshall: the k-i-j triple loop over the whole
+ *        matrix.
+ *
+ * Kept as the reference for dsalib_floyd_warshall(); every relaxation
+ * streams a full row of the matrix, so for n beyond a few hundred each k
+ * step goes to main memory.
+ *
+ * Time Complexity: O(n^3)
+ * Space Complexity: O(1) extra
+ *
+ * @return true on success, false on NULL dist or a negative cycle
+ */
+bool dsalib_floyd_warshall_naive(int* dist, size_t n);
+
+/**
+ * @brief Cache-blocked Floyd-Warshall.
+ *
+ * The matrix is split into 64 x 64 tiles (16 KB each, so the three tiles a
+ * step touches fit in L2). For each diagonal tile kb the algorithm runs
+ * three phases: the diagonal tile against itself, then the tiles in row
+ * and column kb against the diagonal tile, then every remaining tile
+ * against its row and column tiles. Tiles within phases two and three are
+ * independent and are spread over num_threads threads. The min-plus inner
+ * loop runs four lanes at a time with SSE2.
+ *
+ * Gives the same matrix as dsalib_floyd_warshall_naive(), except where
+ * negative weights meet saturated partial sums or a negative cycle.
+ *
+ * Time Complexity: O(n^3)
+ * Space Complexity: O(1) extra
+ *
+ * @param num_threads Number of worker threads (0 is treated as 1)
+ * @return true on success, false on NULL dist or a negative cycle
+ */
+bool dsalib_floyd_warshall(int* dist, size_t n, size_t num_threads);
+
+#endif // DSALIB_FLOYD_WARSHALL_H
@@ -0,0 +1,43 @@
+#ifndef DSALIB_MST_H
+#define DSALIB_MST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief A weighted undirected edge (u, v) for minimum spanning trees.
+ */
+typedef struct {
+    uint32_t u;
+    uint32_t v;
+    int weight;
+} dsalib_weighted_edge_t;
+
+/**
+ * @brief Computes a minimum spanning forest with Kruskal's algorithm.
+ *
+ * Edges are sorted by weight (in place) and added greedily whenever they
+ * connect two different components of a dsalib_union_find_t.
+ *
+ * Time Complexity: O(E log E)
+ * Space Complexity: O(V)
+ *
+ * @param vertex_count Number of vertices (indices 0 .. vertex_count-1)
+ * @param edges Edge list; reordered by weight on return
+ * @param edge_count Number of edges
+ * @param out Output buffer with room for vertex_count - 1 edges
+ * @param total_weight Optional; receives the sum of the chosen weights
+ * @return Number of edges written to out (vertex_count - 1 when the graph is
+ *         connected, fewer for a forest), or 0 on invalid arguments
+ *
+ * Requirements:
+ * - Edges with an endpoint >= vertex_count are skipped
+ * - Ties between equal weights are broken by the sort order (not stable)
+ */
+size_t dsalib_mst_kruskal(size_t vertex_count,
+                          dsalib_weighted_edge_t* edges,
+                          size_t edge_count,
+                          dsalib_weighted_edge_t* out,
+                          long long* total_weight);
+
+#endif // DSALIB_MST_H
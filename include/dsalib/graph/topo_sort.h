@@ -0,0 +1,76 @@
+#ifndef DSALIB_TOPO_SORT_H
+#define DSALIB_TOPO_SORT_H
+
+#include "dsalib/graph/csr.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Topological sorting and DAG scheduling (C-TopoSort).
+ *
+ * All functions use Kahn's algorithm: a node becomes ready once every
+ * predecessor has been emitted. When the graph has a cycle, the nodes on
+ * or behind it never become ready, so fewer than num_nodes nodes are
+ * ordered; that is how cycles are reported.
+ */
+
+/**
+ * @brief Sequential topological sort (Kahn's algorithm).
+ *
+ * The output array doubles as the FIFO queue of ready nodes, so no extra
+ * queue is allocated.
+ *
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V) for the in-degree counters
+ *
+ * @param graph Directed graph
+ * @param order Output buffer of graph->num_nodes node ids
+ * @return Number of nodes written to order: num_nodes if the graph is a
+ *         DAG, fewer if it has a cycle, 0 on invalid arguments
+ */
+size_t dsalib_topo_sort(const dsalib_csr_graph_t* graph, uint32_t* order);
+
+/**
+ * @brief Parallel level-synchronous topological sort.
+ *
+ * Each round expands the current frontier (nodes whose predecessors are all
+ * emitted) on num_threads threads. Successor in-degrees are decremented
+ * with atomic fetch-and-subtract; the thread that brings a counter to zero
+ * appends that node to the next frontier. Within a level the order is
+ * unspecified, but every node still follows all of its predecessors.
+ * Levels too small to be worth splitting run on the calling thread.
+ *
+ * @param num_threads Number of worker threads (0 is treated as 1)
+ * @param num_levels Optional; receives the number of levels (the length of
+ *        the longest path, in nodes)
+ * @return Number of nodes written to order, as for dsalib_topo_sort()
+ */
+size_t dsalib_topo_sort_parallel(const dsalib_csr_graph_t* graph,
+                                 size_t num_threads,
+                                 uint32_t* order,
+                                 size_t* num_levels);
+
+/**
+ * @brief Task callback run once per node by dsalib_dag_execute().
+ */
+typedef void (*dsalib_dag_task_fn)(void* ctx, uint32_t node);
+
+/**
+ * @brief Runs task(ctx, node) for every node, each as soon as all of its
+ *        predecessors' tasks have returned.
+ *
+ * Unlike the level-synchronous sort there is no barrier between levels: a
+ * worker that finishes a task immediately continues with a successor it
+ * made ready, and idle workers pick up the remaining ready nodes from a
+ * shared queue. Tasks run concurrently on up to num_threads threads, so
+ * they must be thread-safe with respect to each other.
+ *
+ * @param num_threads Number of worker threads (0 is treated as 1)
+ * @return true if every node ran, false on invalid arguments or if the
+ *         graph has a cycle (nodes on or behind the cycle are not run)
+ */
+bool dsalib_dag_execute(const dsalib_csr_graph_t* graph, size_t num_threads, dsalib_dag_task_fn task, void* ctx);
+
+#endif // DSALIB_TOPO_SORT_H
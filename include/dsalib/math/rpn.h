@@ -0,0 +1,138 @@
+#ifndef DSALIB_RPN_H
+#define DSALIB_RPN_H
+
+#include "dsalib/containers/stack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Rows evaluated together by dsalib_rpn_eval_batch().
+ */
+#define DSALIB_RPN_BATCH 256
+
+/**
+ * @brief Bytecode operations.
+ *
+ * The *_CONST forms take their right operand from the instruction's
+ * argument instead of the stack; the compiler emits them whenever an
+ * operator's right operand is a literal.
+ */
+typedef enum {
+    DSALIB_RPN_PUSH_CONST, // Push arg
+    DSALIB_RPN_PUSH_VAR,   // Push variable number arg
+    DSALIB_RPN_ADD,
+    DSALIB_RPN_SUB,
+    DSALIB_RPN_MUL,
+    DSALIB_RPN_DIV,
+    DSALIB_RPN_MOD,
+    DSALIB_RPN_NEG,
+    DSALIB_RPN_ADD_CONST,
+    DSALIB_RPN_SUB_CONST,
+    DSALIB_RPN_MUL_CONST,
+    DSALIB_RPN_DIV_CONST,
+    DSALIB_RPN_MOD_CONST
+} dsalib_rpn_op_t;
+
+/**
+ * @brief One bytecode instruction (8 bytes).
+ */
+typedef struct {
+    int32_t op;  // dsalib_rpn_op_t
+    int32_t arg; // Constant or variable number, if the op takes one
+} dsalib_rpn_instr_t;
+
+/**
+ * @brief An integer expression compiled once and evaluated many times
+ *        (C-RPN).
+ *
+ * Expressions are compiled from RPN ("price qty * 100 /") or infix
+ * ("price * qty / 100") into a flat bytecode program. Literal operands are
+ * folded into their operator and constant subexpressions are evaluated at
+ * compile time. The compiler also computes the deepest stack the program
+ * can reach, and the program keeps a dsalib_stack_t preallocated to that
+ * depth, so evaluation indexes the stack directly without per-push
+ * capacity checks.
+ *
+ * Arithmetic is on int and saturates at INT_MIN/INT_MAX like safe_add()
+ * from dsalib/math/add.h; division or modulo by zero makes evaluation fail.
+ *
+ * The program owns its evaluation stack and evaluation writes to it, which
+ * is why the eval functions take a non-const program: a single program
+ * must not be evaluated from several threads at once.
+ */
+typedef struct {
+    dsalib_rpn_instr_t* code; // Instructions
+    size_t length;            // Number of instructions
+    size_t max_depth;         // Deepest stack the program reaches
+    size_t num_vars;          // Number of variables the program may read
+    dsalib_stack_t* stack;    // max_depth * DSALIB_RPN_BATCH evaluation slots
+} dsalib_rpn_program_t;
+
+/**
+ * @brief Compiles a whitespace-separated RPN expression.
+ *
+ * Tokens are int literals (a leading '-' makes a literal negative), the
+ * operators + - * / % and variable names, which resolve to their index in
+ * names.
+ *
+ * @param expression RPN expression, e.g. "a b + 2 *"
+ * @param names Variable names (may be NULL if num_vars == 0)
+ * @param num_vars Number of names
+ * @return Compiled program, or NULL on unknown tokens, literal overflow,
+ *         missing or extra operands, or allocation failure
+ */
+dsalib_rpn_program_t* dsalib_rpn_compile(const char* expression, const char* const* names, size_t num_vars);
+
+/**
+ * @brief Compiles an infix expression with + - * / %, unary minus and
+ *        parentheses, using the usual precedence (shunting-yard).
+ *
+ * @return Compiled program, or NULL on a malformed expression (see
+ *         dsalib_rpn_compile())
+ */
+dsalib_rpn_program_t* dsalib_rpn_compile_infix(const char* expression, const char* const* names, size_t num_vars);
+
+/**
+ * @brief Destroys a program. Handles NULL gracefully.
+ */
+void dsalib_rpn_destroy(dsalib_rpn_program_t* program);
+
+/**
+ * @brief Evaluates the program for one row.
+ *
+ * @param vars Variable values, indexed like the names given at compile
+ *        time (may be NULL if the program has no variables)
+ * @param result Receives the value
+ * @return true on success, false on division by zero or NULL arguments
+ */
+bool dsalib_rpn_eval(dsalib_rpn_program_t* program, const int* vars, int* result);
+
+/**
+ * @brief Evaluates the program over columnar input.
+ *
+ * Rows are processed DSALIB_RPN_BATCH at a time: each instruction runs
+ * over the whole batch before the next one is decoded, so interpretation
+ * overhead is paid once per batch instead of once per row, and the inner
+ * loops are simple enough for the compiler to vectorize.
+ *
+ * @param columns columns[v] holds rows values of variable v
+ * @param rows Number of rows
+ * @param out Receives rows results; rows that divide by zero get 0
+ * @return Number of rows evaluated without error (0 on NULL arguments)
+ */
+size_t dsalib_rpn_eval_batch(dsalib_rpn_program_t* program,
+                             const int* const* columns,
+                             size_t rows,
+                             int* out);
+
+/**
+ * @brief One-shot helper: compiles and evaluates a constant RPN expression.
+ *
+ * @return true on success, false if the expression is malformed, uses
+ *         variables, or divides by zero
+ */
+bool dsalib_rpn_evaluate(const char* expression, int* result);
+
+#endif // DSALIB_RPN_H
@@ -0,0 +1,89 @@
+#ifndef DSALIB_PARALLEL_SCAN_H
+#define DSALIB_PARALLEL_SCAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Elements per work unit (256 KiB of ints).
+ */
+#define DSALIB_SCAN_CHUNK (64 * 1024)
+
+/**
+ * @brief Multi-threaded scans over large unsorted int arrays (C-Scan).
+ *
+ * A single core cannot pull a multi-gigabyte array through at the
+ * memory's full bandwidth; these split the array across num_threads
+ * threads with dsalib_parallel_for(). The array is cut into chunks of
+ * DSALIB_SCAN_CHUNK elements and each worker scans one contiguous run of
+ * chunks, the same split a parallel fill of the array would use, so under
+ * first-touch page placement a worker mostly reads memory local to its
+ * NUMA node. Within a chunk the comparisons run 8 ints at a time with AVX2
+ * or 4 with SSE2.
+ *
+ * The find variants keep dsalib_linear_search()'s contract of returning
+ * the FIRST matching index. Workers publish matches to a shared atomic
+ * minimum and check it before each chunk: a worker stops as soon as its
+ * next chunk starts past a match already found, and the lowest match wins.
+ *
+ * num_threads of 0 is treated as 1; it is also capped at the number of
+ * chunks, so small arrays run on the calling thread.
+ *
+ * Time Complexities (n elements, p threads):
+ * - Find / Find if: O(n / p), less when a match stops the scan early
+ * - Count / Min-max: O(n / p)
+ */
+
+/**
+ * @brief Predicate for dsalib_parallel_find_if(); called concurrently from
+ *        several threads.
+ */
+typedef bool (*dsalib_scan_predicate_fn)(void* ctx, int value);
+
+/**
+ * @brief Result of dsalib_parallel_minmax().
+ */
+typedef struct {
+    int min;          // Smallest value
+    int max;          // Largest value
+    size_t min_index; // First index holding min
+    size_t max_index; // First index holding max
+} dsalib_minmax_t;
+
+/**
+ * @brief Parallel dsalib_linear_search(): finds the first index of target.
+ *
+ * @param arr Array to search (may be NULL if size == 0)
+ * @param num_threads Number of worker threads
+ * @return Index of the first occurrence, or -1 if not found or arr is NULL
+ */
+long long dsalib_parallel_find(const int* arr, size_t size, int target, size_t num_threads);
+
+/**
+ * @brief Finds the first index whose value satisfies pred.
+ *
+ * The predicate is called through a pointer, so this scans without SIMD.
+ * Elements past the first match may or may not be tested.
+ *
+ * @param ctx Passed to pred
+ * @return Index of the first match, or -1 if none or arr / pred is NULL
+ */
+long long dsalib_parallel_find_if(const int* arr, size_t size, dsalib_scan_predicate_fn pred, void* ctx,
+                                  size_t num_threads);
+
+/**
+ * @brief Counts the elements equal to target.
+ *
+ * @return Number of occurrences (0 if arr is NULL)
+ */
+size_t dsalib_parallel_count(const int* arr, size_t size, int target, size_t num_threads);
+
+/**
+ * @brief Finds the minimum and maximum and their first indices in one pass.
+ *
+ * @param out Receives the result
+ * @return true on success, false if arr or out is NULL or size == 0
+ */
+bool dsalib_parallel_minmax(const int* arr, size_t size, size_t num_threads, dsalib_minmax_t* out);
+
+#endif // DSALIB_PARALLEL_SCAN_H
@@ -0,0 +1,162 @@
+#ifndef DSALIB_RANGE_QUERY_H
+#define DSALIB_RANGE_QUERY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Range queries over int arrays (C-Range).
+ *
+ * Inputs are plain (const int* arr, size_t size) arrays, as for
+ * dsalib_lower_bound(), and ranges are half-open index intervals
+ * [left, right). Sums are computed in long long so they cannot overflow
+ * for arrays shorter than 2^32 elements.
+ *
+ * - Sparse table: static range min or max in O(1) per query.
+ * - Fenwick tree: point updates and prefix sums in O(log n), plus a search
+ *   for the first prefix sum reaching a target.
+ * - Prefix scan: inclusive/exclusive prefix sums, SIMD within a thread and
+ *   split across threads for large arrays.
+ */
+
+/**
+ * @brief Which extreme a sparse table answers.
+ */
+typedef enum {
+    DSALIB_RANGE_MIN,
+    DSALIB_RANGE_MAX
+} dsalib_range_kind_t;
+
+/**
+ * @brief Static sparse table for range-minimum or range-maximum queries.
+ *
+ * Level k holds the extreme of every run of 2^k elements, so any range is
+ * covered by two (possibly overlapping) runs of the largest power of two
+ * that fits: two loads and one comparison per query. Levels are stored
+ * back to back, level k at table + k * size, and each level is built from
+ * the previous one with SSE2.
+ *
+ * Time Complexities:
+ * - Build: O(n log n)
+ * - Query: O(1)
+ *
+ * Space Complexity: O(n log n)
+ */
+typedef struct {
+    int* table;               // num_levels rows of size entries
+    size_t size;              // Number of elements
+    size_t num_levels;        // floor(log2(size)) + 1
+    dsalib_range_kind_t kind; // Min or max
+} dsalib_sparse_table_t;
+
+/**
+ * @brief Builds a sparse table over a copy of arr.
+ *
+ * @return Pointer to the new table, or NULL if arr is NULL, size is 0 or
+ *         allocation fails
+ */
+dsalib_sparse_table_t* dsalib_sparse_table_create(const int* arr, size_t size, dsalib_range_kind_t kind);
+
+/**
+ * @brief Destroys the table. Handles NULL gracefully.
+ */
+void dsalib_sparse_table_destroy(dsalib_sparse_table_t* table);
+
+/**
+ * @brief Stores the min (or max) of arr[left .. right).
+ *
+ * @return false if table or result is NULL or the range is empty or out of
+ *         bounds
+ */
+bool dsalib_sparse_table_query(const dsalib_sparse_table_t* table, size_t left, size_t right, int* result);
+
+/**
+ * @brief Fenwick (binary indexed) tree over a mutable int array.
+ *
+ * tree[i] (1-based) holds the sum of the i & -i elements ending at
+ * element i - 1, so a prefix sum adds O(log n) entries and an update
+ * touches O(log n) entries.
+ *
+ * Time Complexities:
+ * - Build: O(n)
+ * - Add / Prefix sum / Lower bound: O(log n)
+ *
+ * Space Complexity: O(n)
+ */
+typedef struct {
+    long long* tree; // size + 1 entries; tree[0] is unused
+    size_t size;     // Number of elements
+} dsalib_fenwick_t;
+
+/**
+ * @brief Creates a tree over arr, or over size zeros if arr is NULL.
+ *
+ * @return Pointer to the new tree, or NULL if size is 0 or allocation fails
+ */
+dsalib_fenwick_t* dsalib_fenwick_create(const int* arr, size_t size);
+
+/**
+ * @brief Destroys the tree. Handles NULL gracefully.
+ */
+void dsalib_fenwick_destroy(dsalib_fenwick_t* fenwick);
+
+/**
+ * @brief Adds delta to element index.
+ *
+ * @return false if fenwick is NULL or index is out of range
+ */
+bool dsalib_fenwick_add(dsalib_fenwick_t* fenwick, size_t index, long long delta);
+
+/**
+ * @brief Returns the sum of the first count elements (count is clamped to
+ *        the size; 0 if fenwick is NULL).
+ */
+long long dsalib_fenwick_prefix_sum(const dsalib_fenwick_t* fenwick, size_t count);
+
+/**
+ * @brief Returns the sum of elements [left, right) (0 for empty or invalid
+ *        ranges).
+ */
+long long dsalib_fenwick_range_sum(const dsalib_fenwick_t* fenwick, size_t left, size_t right);
+
+/**
+ * @brief Finds the first index whose inclusive prefix sum is >= target.
+ *
+ * Descends the implicit tree from the largest power of two instead of
+ * binary searching over prefix_sum(), so it costs one O(log n) walk. Like
+ * dsalib_lower_bound() it requires the searched sequence (here the prefix
+ * sums) to be non-decreasing, i.e. no negative elements.
+ *
+ * @return Smallest i with prefix_sum(i + 1) >= target, 0 if target <= 0,
+ *         or size if no prefix reaches target (or fenwick is NULL)
+ */
+size_t dsalib_fenwick_lower_bound(const dsalib_fenwick_t* fenwick, long long target);
+
+/**
+ * @brief Inclusive prefix sums: out[i] = arr[0] + ... + arr[i].
+ *
+ * Each thread scans four elements per step with SSE2: the lanes are
+ * widened to 64 bits, summed in-register with two shifted adds and offset
+ * by the running total. With num_threads > 1 and a large array, the array
+ * is split into chunks; a first parallel pass sums each chunk, the chunk
+ * totals are scanned, and a second parallel pass scans every chunk from
+ * its starting offset.
+ *
+ * Time Complexity: O(n)
+ *
+ * @param arr Input array
+ * @param size Number of elements
+ * @param out Output buffer of size entries
+ * @param num_threads Number of worker threads (0 is treated as 1)
+ * @return false if arr or out is NULL
+ */
+bool dsalib_prefix_sum_inclusive(const int* arr, size_t size, long long* out, size_t num_threads);
+
+/**
+ * @brief Exclusive prefix sums: out[0] = 0, out[i] = arr[0] + ... + arr[i-1].
+ *
+ * Same contract and strategy as dsalib_prefix_sum_inclusive().
+ */
+bool dsalib_prefix_sum_exclusive(const int* arr, size_t size, long long* out, size_t num_threads);
+
+#endif // DSALIB_RANGE_QUERY_H
@@ -0,0 +1,128 @@
+#ifndef DSALIB_SELECT_H
+#define DSALIB_SELECT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Selection and order statistics on int arrays (C-Select).
+ *
+ * Answers "which value has rank r" (p50, p99, ...) without sorting the
+ * whole array. The selection functions rearrange the array in place, the
+ * way dsalib_lower_bound() callers already pass (int* arr, size_t size);
+ * ranks are 0-based positions in sorted order.
+ *
+ * Partitioning is three-way (less / equal / greater than the pivot), so
+ * arrays full of duplicates, common for latency samples, finish in one
+ * pass. Pivots are the median of three samples; if partitioning keeps
+ * going badly (more than 2 log2(n) rounds) the remaining range switches to
+ * median-of-medians pivots, which bounds the worst case at O(n).
+ *
+ * Time Complexities:
+ * - nth_element: O(n) expected and worst case
+ * - multi_select: O(n log m) for m ranks
+ * - Top-k push: O(1) for filtered elements, O(log k) otherwise
+ */
+
+/**
+ * @brief Partially sorts arr so that arr[rank] holds the value it would have
+ *        after a full sort, with no larger values before it and no smaller
+ *        values after it.
+ *
+ * @param arr Array to rearrange
+ * @param size Number of elements
+ * @param rank 0-based rank to select (< size)
+ * @return false if arr is NULL or rank >= size
+ */
+bool dsalib_nth_element(int* arr, size_t size, size_t rank);
+
+/**
+ * @brief Selects several ranks at once.
+ *
+ * After the call arr[ranks[i]] holds the value of rank ranks[i] for every
+ * i, and the array is partitioned around each of them. The recursion only
+ * descends into partitions that still contain a requested rank, so
+ * selecting p50, p90, p99 and p99.9 costs little more than one selection.
+ *
+ * @param ranks Ranks in ascending order (duplicates allowed)
+ * @param num_ranks Number of ranks
+ * @return false if arr or ranks is NULL, ranks are not ascending or a rank
+ *         is >= size
+ */
+bool dsalib_multi_select(int* arr, size_t size, const size_t* ranks, size_t num_ranks);
+
+/**
+ * @brief Returns the rank of quantile q (0.0 .. 1.0) in an array of size
+ *        elements, using the nearest-rank definition rounded down:
+ *        floor(q * (size - 1)). q is clamped to [0, 1]; returns 0 if size
+ *        is 0.
+ */
+size_t dsalib_quantile_rank(size_t size, double q);
+
+/**
+ * @brief Streaming top-k: keeps the k largest values seen so far.
+ *
+ * The values live in a binary min-heap of at most k entries, so the heap's
+ * root is the smallest value still in the top k: the threshold a new value
+ * must beat. Once the heap is full most values of a large stream fall
+ * below the threshold; dsalib_topk_push_array() compares them against it in
+ * blocks of 16 (four SSE2 vectors per test) and only touches the heap for
+ * the blocks that contain a candidate.
+ *
+ * Space Complexity: O(k)
+ */
+typedef struct {
+    int* heap;    // Min-heap of the current top values
+    size_t k;     // Capacity
+    size_t count; // Values currently held (<= k)
+} dsalib_topk_t;
+
+/**
+ * @brief Creates an empty top-k tracker.
+ *
+ * @return Pointer to the new tracker, or NULL if k is 0 or allocation fails
+ */
+dsalib_topk_t* dsalib_topk_create(size_t k);
+
+/**
+ * @brief Destroys the tracker. Handles NULL gracefully.
+ */
+void dsalib_topk_destroy(dsalib_topk_t* topk);
+
+/**
+ * @brief Forgets every value.
+ */
+void dsalib_topk_reset(dsalib_topk_t* topk);
+
+/**
+ * @brief Offers one value.
+ *
+ * @return true if the value entered the top k, false otherwise (or if topk
+ *         is NULL)
+ */
+bool dsalib_topk_push(dsalib_topk_t* topk, int value);
+
+/**
+ * @brief Offers every element of arr, filtering against the current
+ *        threshold with SIMD.
+ *
+ * @return false if topk or arr is NULL
+ */
+bool dsalib_topk_push_array(dsalib_topk_t* topk, const int* arr, size_t size);
+
+/**
+ * @brief Stores the smallest value in the top k (the admission threshold).
+ *
+ * @return false if topk or threshold is NULL or nothing was pushed yet
+ */
+bool dsalib_topk_threshold(const dsalib_topk_t* topk, int* threshold);
+
+/**
+ * @brief Copies the current top values into out in descending order.
+ *
+ * @param out Output buffer with room for k elements
+ * @return Number of values written (0 if topk or out is NULL)
+ */
+size_t dsalib_topk_result(const dsalib_topk_t* topk, int* out);
+
+#endif // DSALIB_SELECT_H
@@ -0,0 +1,150 @@
+#ifndef DSALIB_SORTED_FILE_H
+#define DSALIB_SORTED_FILE_H
+
+#include "dsalib/containers/bloom_filter.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Versioned binary file format for sorted int arrays, designed to be
+ *        memory-mapped and searched in place.
+ *
+ * Layout (all integers little/native endian, checked on open):
+ *
+ *   offset 0      dsalib_sorted_file_header_t   (64 bytes)
+ *   offset 64     dsalib_sorted_file_section_t  x section_count
+ *   page aligned  section payloads, each starting on a 4096-byte boundary
+ *
+ * Sections:
+ * - DSALIB_SORTED_FILE_SECTION_ARRAY: the sorted int array itself (required)
+ * - DSALIB_SORTED_FILE_SECTION_FENCES: every fence_stride-th key, a small
+ *   top-level index searched before the array so that the final
+ *   dsalib_lower_bound() call only touches one stride of the mapping
+ * - DSALIB_SORTED_FILE_SECTION_BLOOM: the blocks of a dsalib_bloom_filter_t
+ *   so that misses are rejected without touching the array at all
+ *
+ * Because payloads are page aligned and stored exactly as in memory, opening
+ * a file is an mmap() plus header validation: no parsing, no copies. Every
+ * section carries a 64-bit checksum that open() can optionally verify.
+ */
+
+#define DSALIB_SORTED_FILE_MAGIC "DSASORT"
+#define DSALIB_SORTED_FILE_VERSION 1
+#define DSALIB_SORTED_FILE_ALIGNMENT 4096
+
+/** Section kinds. */
+#define DSALIB_SORTED_FILE_SECTION_ARRAY 1
+#define DSALIB_SORTED_FILE_SECTION_FENCES 2
+#define DSALIB_SORTED_FILE_SECTION_BLOOM 3
+
+/** Flags for dsalib_sorted_file_open(); combine with |. */
+#define DSALIB_SORTED_FILE_VERIFY 0x1   // Verify all section checksums (reads the whole file)
+#define DSALIB_SORTED_FILE_WILLNEED 0x2 // madvise(MADV_WILLNEED): start readahead now
+#define DSALIB_SORTED_FILE_HUGEPAGE 0x4 // madvise(MADV_HUGEPAGE) where supported
+#define DSALIB_SORTED_FILE_POPULATE 0x8 // Pre-fault the mapping (MAP_POPULATE) where supported
+
+/**
+ * @brief On-disk file header (64 bytes).
+ */
+typedef struct {
+    char magic[8];          // DSALIB_SORTED_FILE_MAGIC, NUL padded
+    uint32_t version;       // DSALIB_SORTED_FILE_VERSION
+    uint32_t endian_tag;    // 0x01020304 as written by the producer
+    uint64_t file_size;     // Total file size in bytes
+    uint32_t section_count; // Entries in the section table
+    uint32_t reserved;
+    uint64_t table_checksum; // Checksum of the section table
+    uint8_t padding[24];
+} dsalib_sorted_file_header_t;
+
+/**
+ * @brief On-disk section table entry (40 bytes).
+ */
+typedef struct {
+    uint32_t kind;     // DSALIB_SORTED_FILE_SECTION_*
+    uint32_t reserved;
+    uint64_t offset;   // Payload offset from the start of the file
+    uint64_t bytes;    // Payload size in bytes
+    uint64_t param;    // Kind-specific: element count, fence stride, block count
+    uint64_t checksum; // Checksum of the payload
+} dsalib_sorted_file_section_t;
+
+/**
+ * @brief Options for dsalib_sorted_file_write().
+ */
+typedef struct {
+    size_t fence_stride; // Keys per fence (0 = no fence section)
+    double bloom_fpr;    // Bloom filter false-positive rate (0 = no bloom section)
+} dsalib_sorted_file_options_t;
+
+/**
+ * @brief A read-only, memory-mapped sorted file.
+ *
+ * All pointers point into the mapping; they stay valid until close().
+ */
+typedef struct {
+    void* mapping;              // Start of the mapping
+    size_t mapping_size;        // Length of the mapping
+    const int* data;            // Sorted array
+    size_t size;                // Number of elements in data
+    const int* fences;          // Every fence_stride-th key, or NULL
+    size_t fence_count;         // Number of fences
+    size_t fence_stride;        // Keys per fence
+    dsalib_bloom_filter_t bloom; // View of the bloom section (read-only)
+    bool has_bloom;             // Whether bloom is valid
+} dsalib_sorted_file_t;
+
+/**
+ * @brief Writes a sorted array (and optional indexes) to path.
+ *
+ * @param path Destination file (created or truncated)
+ * @param arr Sorted array (may be NULL if size == 0)
+ * @param size Number of elements
+ * @param options Optional indexes to build; NULL writes the array only
+ * @return true on success, false on invalid arguments, unsorted input or
+ *         I/O error
+ */
+bool dsalib_sorted_file_write(const char* path,
+                              const int* arr,
+                              size_t size,
+                              const dsalib_sorted_file_options_t* options);
+
+/**
+ * @brief Memory-maps a file written by dsalib_sorted_file_write().
+ *
+ * @param path File to open
+ * @param flags Combination of DSALIB_SORTED_FILE_* flags
+ * @return Pointer to the opened file, or NULL on I/O error, unsupported
+ *         version, foreign endianness, malformed layout or checksum mismatch
+ */
+dsalib_sorted_file_t* dsalib_sorted_file_open(const char* path, int flags);
+
+/**
+ * @brief Unmaps the file. Handles NULL gracefully.
+ */
+void dsalib_sorted_file_close(dsalib_sorted_file_t* file);
+
+/**
+ * @brief lower_bound over the mapped array, using the fence index if present.
+ *
+ * @return Index of the first element >= target, or size if none
+ *         (0 if file is NULL)
+ */
+size_t dsalib_sorted_file_lower_bound(const dsalib_sorted_file_t* file, int target);
+
+/**
+ * @brief Finds target in the mapped array, rejecting misses through the
+ *        bloom section first when present.
+ *
+ * @return Index of target if found, -1 otherwise
+ */
+int dsalib_sorted_file_search(const dsalib_sorted_file_t* file, int target);
+
+/**
+ * @brief Computes the 64-bit checksum used for sections.
+ */
+uint64_t dsalib_sorted_file_checksum(const void* data, size_t bytes);
+
+#endif // DSALIB_SORTED_FILE_H
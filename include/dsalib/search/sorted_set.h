@@ -0,0 +1,91 @@
+#ifndef DSALIB_SORTED_SET_H
+#define DSALIB_SORTED_SET_H
+
+#include <stddef.h>
+
+/**
+ * @brief Set operations over SORTED int arrays (posting lists).
+ *
+ * All kernels write into caller-provided output buffers and never allocate.
+ * Inputs are the same kind of arrays dsalib_lower_bound() searches: sorted in
+ * ascending order. Intersection, union and difference additionally expect
+ * each input to be free of duplicates (a set); k-way merge keeps duplicates.
+ *
+ * The adaptive kernels pick a strategy from the size ratio of the inputs:
+ * - Similar sizes: linear merge, with SIMD 4x4 block comparisons when the
+ *   target supports SSE2.
+ * - Skewed sizes (ratio >= DSALIB_SORTED_SET_GALLOP_RATIO): galloping, i.e.
+ *   an exponential probe followed by dsalib_lower_bound() on the large input
+ *   for every element of the small one.
+ *
+ * Time Complexities (n = small input, m = large input):
+ * - Merge strategy: O(n + m)
+ * - Galloping strategy: O(n log(m / n))
+ * - K-way merge: O(N log k) for N total elements
+ */
+
+/**
+ * @brief Size ratio at which the adaptive kernels switch to galloping.
+ */
+#define DSALIB_SORTED_SET_GALLOP_RATIO 32
+
+/**
+ * @brief Computes the intersection a ∩ b (adaptive strategy).
+ *
+ * @param a First sorted, duplicate-free array (may be NULL if na == 0)
+ * @param na Number of elements in a
+ * @param b Second sorted, duplicate-free array (may be NULL if nb == 0)
+ * @param nb Number of elements in b
+ * @param out Output buffer with room for min(na, nb) elements
+ * @return Number of elements written to out (0 if any pointer is NULL)
+ */
+size_t dsalib_sorted_intersect(const int* a, size_t na, const int* b, size_t nb, int* out);
+
+/**
+ * @brief Intersection using a plain linear merge (SIMD blocks when available).
+ *
+ * Same contract as dsalib_sorted_intersect(); exposed for benchmarking.
+ */
+size_t dsalib_sorted_intersect_merge(const int* a, size_t na, const int* b, size_t nb, int* out);
+
+/**
+ * @brief Intersection by galloping through the larger input.
+ *
+ * Same contract as dsalib_sorted_intersect(); exposed for benchmarking.
+ */
+size_t dsalib_sorted_intersect_gallop(const int* a, size_t na, const int* b, size_t nb, int* out);
+
+/**
+ * @brief Computes the union a ∪ b.
+ *
+ * Elements present in both inputs are written once.
+ *
+ * @param out Output buffer with room for na + nb elements
+ * @return Number of elements written to out (0 if any pointer is NULL)
+ */
+size_t dsalib_sorted_union(const int* a, size_t na, const int* b, size_t nb, int* out);
+
+/**
+ * @brief Computes the difference a \ b (elements of a not present in b).
+ *
+ * @param out Output buffer with room for na elements
+ * @return Number of elements written to out (0 if any pointer is NULL)
+ */
+size_t dsalib_sorted_difference(const int* a, size_t na, const int* b, size_t nb, int* out);
+
+/**
+ * @brief Merges k sorted arrays into one sorted array.
+ *
+ * Duplicates are kept; equal values are emitted in list order. Uses a binary
+ * min-heap of list cursors stored in the caller's workspace.
+ *
+ * @param lists Array of k pointers to sorted arrays
+ * @param sizes Array of k element counts
+ * @param k Number of lists
+ * @param work Workspace with room for 2 * k size_t values
+ * @param out Output buffer with room for the sum of all sizes
+ * @return Number of elements written to out (0 if any pointer is NULL)
+ */
+size_t dsalib_sorted_merge_k(const int* const* lists, const size_t* sizes, size_t k, size_t* work, int* out);
+
+#endif // DSALIB_SORTED_SET_H
@@ -0,0 +1,41 @@
+#ifndef DSALIB_HASH_H
+#define DSALIB_HASH_H
+
+#include <stdint.h>
+
+/**
+ * @brief Integer hashing shared by the hash-based containers.
+ *
+ * These are header-only (static inline) because they sit on the hot path of
+ * every probe. The mixer is the splitmix64 finalizer: every input bit
+ * affects every output bit, so both the low bits (bucket index) and the high
+ * bits (fingerprints, block selection) are usable.
+ */
+
+/**
+ * @brief Mixes a 64-bit value into a well-distributed 64-bit hash.
+ */
+static inline uint64_t dsalib_hash_u64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * @brief Hashes an int key.
+ */
+static inline uint64_t dsalib_hash_int(int key) {
+    return dsalib_hash_u64((uint64_t)(uint32_t)key);
+}
+
+/**
+ * @brief Maps a 32-bit hash uniformly onto [0, range) without a division.
+ */
+static inline uint32_t dsalib_hash_reduce(uint32_t hash, uint32_t range) {
+    return (uint32_t)(((uint64_t)hash * range) >> 32);
+}
+
+#endif // DSALIB_HASH_H
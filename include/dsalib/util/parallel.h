@@ -0,0 +1,45 @@
+#ifndef DSALIB_PARALLEL_H
+#define DSALIB_PARALLEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Minimal fork-join helper used by the multi-threaded algorithms.
+ *
+ * dsalib_parallel_for() splits the index range [0, n) into num_threads
+ * contiguous chunks of (almost) equal size and runs fn once per chunk.
+ * Chunk 0 runs on the calling thread, the others on POSIX threads; the call
+ * returns after every chunk has finished. If a thread cannot be created its
+ * chunk runs on the calling thread instead (as do all chunks if the
+ * bookkeeping cannot be allocated), so the work always completes with the
+ * same chunks and workers; chunks must therefore never wait on each other.
+ */
+
+/**
+ * @brief Work callback for one chunk.
+ *
+ * @param ctx User context passed to dsalib_parallel_for()
+ * @param begin First index of the chunk (inclusive)
+ * @param end Last index of the chunk (exclusive)
+ * @param worker Chunk number in [0, num_threads)
+ */
+typedef void (*dsalib_parallel_fn)(void* ctx, size_t begin, size_t end, size_t worker);
+
+/**
+ * @brief Runs fn over [0, n) on num_threads threads.
+ *
+ * @param n Size of the index range
+ * @param num_threads Number of chunks/threads (0 is treated as 1; clamped to n)
+ * @param fn Work callback (must not be NULL)
+ * @param ctx User context forwarded to fn
+ * @return false if fn is NULL, true otherwise
+ */
+bool dsalib_parallel_for(size_t n, size_t num_threads, dsalib_parallel_fn fn, void* ctx);
+
+/**
+ * @brief Returns the number of online CPUs (at least 1).
+ */
+size_t dsalib_parallel_hardware_threads(void);
+
+#endif // DSALIB_PARALLEL_H
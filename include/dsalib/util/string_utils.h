@@ -0,0 +1,106 @@
+#ifndef DSALIB_STRING_UTILS_H
+#define DSALIB_STRING_UTILS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Scanning and parsing helpers for large text buffers (C-StringUtils).
+ *
+ * All functions work on (pointer, length) buffers that need not be
+ * NUL-terminated, and never copy the text: splitting produces spans that
+ * point into the input. Byte scans compare 16 bytes per SSE2 instruction
+ * (64 per loop iteration) when available, with a scalar fallback.
+ */
+
+/**
+ * @brief A non-owning view of length bytes starting at data.
+ */
+typedef struct {
+    const char* data; // First byte (points into the scanned buffer)
+    size_t length;    // Number of bytes
+} dsalib_string_span_t;
+
+/**
+ * @brief strlen() for a NUL-terminated string, 16 bytes at a time.
+ *
+ * @return Length of s, or 0 if s is NULL
+ */
+size_t dsalib_string_length(const char* s);
+
+/**
+ * @brief memchr(): finds the first occurrence of c in buf[0, length).
+ *
+ * @return Pointer to the first match, or NULL if absent or buf is NULL
+ */
+const char* dsalib_string_find_byte(const char* buf, size_t length, char c);
+
+/**
+ * @brief Counts the occurrences of c in buf[0, length).
+ */
+size_t dsalib_string_count_byte(const char* buf, size_t length, char c);
+
+/**
+ * @brief Finds the first occurrence of needle in haystack (memmem()).
+ *
+ * Candidate positions are found by matching the needle's first and last
+ * bytes 16 positions at a time; only those are confirmed with memcmp().
+ *
+ * @return Pointer to the first match, haystack if needle_length is 0, or
+ *         NULL if absent or a pointer is NULL
+ */
+const char* dsalib_string_find(const char* haystack,
+                               size_t haystack_length,
+                               const char* needle,
+                               size_t needle_length);
+
+/**
+ * @brief Splits buf at every delim into spans.
+ *
+ * Every delimiter ends a field, so n delimiters always yield n + 1 fields
+ * (possibly empty). At most max_spans spans are written; the return value
+ * is the full field count, so a call with max_spans = 0 sizes the array.
+ *
+ * @param spans Output array (may be NULL if max_spans is 0)
+ * @return Total number of fields in buf (0 if buf is NULL)
+ */
+size_t dsalib_string_split(const char* buf,
+                           size_t length,
+                           char delim,
+                           dsalib_string_span_t* spans,
+                           size_t max_spans);
+
+/**
+ * @brief Splits buf into lines.
+ *
+ * Like dsalib_string_split() with '\n', except that a trailing '\r' is
+ * removed from each line and a final newline does not start an empty line.
+ *
+ * @return Total number of lines in buf (0 if buf is NULL or empty)
+ */
+size_t dsalib_string_split_lines(const char* buf, size_t length, dsalib_string_span_t* spans, size_t max_spans);
+
+/**
+ * @brief Parses a whole span as a decimal int with an optional sign.
+ *
+ * @return true on success, false if the span is empty, contains anything
+ *         else, overflows int, or a pointer is NULL
+ */
+bool dsalib_string_parse_int(dsalib_string_span_t span, int* value);
+
+/**
+ * @brief Parses every decimal int in buf, treating any other bytes as
+ *        separators, e.g. for bulk-loading arrays and containers.
+ *
+ * A '-' directly before a digit makes the number negative. Parsing stops
+ * when max values were stored or at a number that overflows int.
+ *
+ * @param out Output array
+ * @param max Capacity of out
+ * @param consumed Optional; receives the number of bytes processed, i.e.
+ *        where to resume after stopping early
+ * @return Number of values stored
+ */
+size_t dsalib_string_parse_ints(const char* buf, size_t length, int* out, size_t max, size_t* consumed);
+
+#endif // DSALIB_STRING_UTILS_H
@@ -0,0 +1,302 @@
+#include "dsalib/containers/bitset.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define WORDS_PER_BLOCK (DSALIB_BITSET_BLOCK_BITS / 64)
+
+enum { OP_AND, OP_OR, OP_XOR, OP_ANDNOT };
+
+/*
+ * Words actually allocated: a multiple of 4 (one AVX2 vector), so the SIMD
+ * loops need no tail. The padding stays zero like the bits past size.
+ */
+static size_t padded_words(size_t num_words) {
+    size_t padded = (num_words + 3) & ~(size_t)3;
+    return padded ? padded : 4;
+}
+
+static size_t num_blocks(const dsalib_bitset_t* bits) {
+    return (bits->num_words + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK;
+}
+
+static inline size_t popcount64(uint64_t w) {
+    return (size_t)__builtin_popcountll(w);
+}
+
+#if defined(__SSE2__) && !defined(__POPCNT__)
+/* Per-byte population counts of a vector (no popcnt instruction needed). */
+static inline __m128i popcount_bytes(__m128i v) {
+    const __m128i m1 = _mm_set1_epi8(0x55);
+    const __m128i m2 = _mm_set1_epi8(0x33);
+    const __m128i m4 = _mm_set1_epi8(0x0f);
+    v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+    v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+    return _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+}
+#endif
+
+/* Set bits in words[0, n) (& other[0, n) when other is not NULL); n is even. */
+static size_t popcount_words(const uint64_t* words, const uint64_t* other, size_t n) {
+#if defined(__SSE2__) && !defined(__POPCNT__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i total = zero;
+    for (size_t i = 0; i < n; i += 2) {
+        __m128i v = _mm_load_si128((const __m128i*)(words + i));
+        if (other) v = _mm_and_si128(v, _mm_load_si128((const __m128i*)(other + i)));
+        total = _mm_add_epi64(total, _mm_sad_epu8(popcount_bytes(v), zero));
+    }
+    return (size_t)(_mm_cvtsi128_si64(total) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(total, total)));
+#else
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        count += popcount64(other ? words[i] & other[i] : words[i]);
+    }
+    return count;
+#endif
+}
+
+/* Position of the k-th set bit of w (k < popcount(w)). */
+static size_t select64(uint64_t w, size_t k) {
+    size_t shift = 0;
+    for (;;) {
+        size_t c = popcount64((w >> shift) & 0xFF);
+        if (k < c) break;
+        k -= c;
+        shift += 8;
+    }
+    uint64_t byte = (w >> shift) & 0xFF;
+    while (k--) byte &= byte - 1;
+    return shift + (size_t)__builtin_ctzll(byte);
+}
+
+static inline void combine(uint64_t* dst, const uint64_t* src, size_t n, int op) {
+#if defined(__AVX2__)
+    for (size_t i = 0; i < n; i += 4) {
+        __m256i a = _mm256_load_si256((const __m256i*)(dst + i));
+        __m256i b = _mm256_load_si256((const __m256i*)(src + i));
+        switch (op) {
+        case OP_AND: a = _mm256_and_si256(a, b); break;
+        case OP_OR: a = _mm256_or_si256(a, b); break;
+        case OP_XOR: a = _mm256_xor_si256(a, b); break;
+        default: a = _mm256_andnot_si256(b, a); break;
+        }
+        _mm256_store_si256((__m256i*)(dst + i), a);
+    }
+#elif defined(__SSE2__)
+    for (size_t i = 0; i < n; i += 2) {
+        __m128i a = _mm_load_si128((const __m128i*)(dst + i));
+        __m128i b = _mm_load_si128((const __m128i*)(src + i));
+        switch (op) {
+        case OP_AND: a = _mm_and_si128(a, b); break;
+        case OP_OR: a = _mm_or_si128(a, b); break;
+        case OP_XOR: a = _mm_xor_si128(a, b); break;
+        default: a = _mm_andnot_si128(b, a); break;
+        }
+        _mm_store_si128((__m128i*)(dst + i), a);
+    }
+#else
+    for (size_t i = 0; i < n; i++) {
+        switch (op) {
+        case OP_AND: dst[i] &= src[i]; break;
+        case OP_OR: dst[i] |= src[i]; break;
+        case OP_XOR: dst[i] ^= src[i]; break;
+        default: dst[i] &= ~src[i]; break;
+        }
+    }
+#endif
+}
+
+static bool apply(dsalib_bitset_t* dst, const dsalib_bitset_t* src, int op) {
+    if (!dst || !src || dst->size != src->size) return false;
+    combine(dst->words, src->words, padded_words(dst->num_words), op);
+    dst->index_valid = false;
+    return true;
+}
+
+dsalib_bitset_t* dsalib_bitset_create(size_t size) {
+    dsalib_bitset_t* bits = malloc(sizeof(dsalib_bitset_t));
+    if (!bits) return NULL;
+    bits->size = size;
+    bits->num_words = (size + 63) / 64;
+    bits->index = NULL;
+    bits->index_valid = false;
+    size_t bytes = padded_words(bits->num_words) * sizeof(uint64_t);
+    bits->words = aligned_alloc(32, bytes);
+    if (!bits->words) {
+        free(bits);
+        return NULL;
+    }
+    memset(bits->words, 0, bytes);
+    return bits;
+}
+
+dsalib_bitset_t* dsalib_bitset_from_array(const int* arr, size_t size, size_t universe) {
+    if (!arr && size > 0) return NULL;
+    dsalib_bitset_t* bits = dsalib_bitset_create(universe);
+    if (!bits) return NULL;
+    for (size_t i = 0; i < size; i++) {
+        if (arr[i] < 0 || (size_t)arr[i] >= universe) {
+            dsalib_bitset_destroy(bits);
+            return NULL;
+        }
+        bits->words[(size_t)arr[i] / 64] |= (uint64_t)1 << ((size_t)arr[i] % 64);
+    }
+    return bits;
+}
+
+void dsalib_bitset_destroy(dsalib_bitset_t* bits) {
+    if (!bits) return;
+    free(bits->words);
+    free(bits->index);
+    free(bits);
+}
+
+void dsalib_bitset_set(dsalib_bitset_t* bits, size_t i) {
+    if (!bits || i >= bits->size) return;
+    bits->words[i / 64] |= (uint64_t)1 << (i % 64);
+    bits->index_valid = false;
+}
+
+void dsalib_bitset_clear(dsalib_bitset_t* bits, size_t i) {
+    if (!bits || i >= bits->size) return;
+    bits->words[i / 64] &= ~((uint64_t)1 << (i % 64));
+    bits->index_valid = false;
+}
+
+bool dsalib_bitset_test(const dsalib_bitset_t* bits, size_t i) {
+    if (!bits || i >= bits->size) return false;
+    return (bits->words[i / 64] >> (i % 64)) & 1;
+}
+
+void dsalib_bitset_reset(dsalib_bitset_t* bits) {
+    if (!bits) return;
+    memset(bits->words, 0, padded_words(bits->num_words) * sizeof(uint64_t));
+    bits->index_valid = false;
+}
+
+bool dsalib_bitset_and(dsalib_bitset_t* dst, const dsalib_bitset_t* src) {
+    return apply(dst, src, OP_AND);
+}
+
+bool dsalib_bitset_or(dsalib_bitset_t* dst, const dsalib_bitset_t* src) {
+    return apply(dst, src, OP_OR);
+}
+
+bool dsalib_bitset_xor(dsalib_bitset_t* dst, const dsalib_bitset_t* src) {
+    return apply(dst, src, OP_XOR);
+}
+
+bool dsalib_bitset_andnot(dsalib_bitset_t* dst, const dsalib_bitset_t* src) {
+    return apply(dst, src, OP_ANDNOT);
+}
+
+size_t dsalib_bitset_count(const dsalib_bitset_t* bits) {
+    if (!bits) return 0;
+    if (bits->index_valid) return (size_t)bits->index[num_blocks(bits)];
+    return popcount_words(bits->words, NULL, padded_words(bits->num_words));
+}
+
+size_t dsalib_bitset_and_count(const dsalib_bitset_t* a, const dsalib_bitset_t* b) {
+    if (!a || !b || a->size != b->size) return 0;
+    return popcount_words(a->words, b->words, padded_words(a->num_words));
+}
+
+size_t dsalib_bitset_next_set(const dsalib_bitset_t* bits, size_t from) {
+    if (!bits) return 0;
+    if (from >= bits->size) return bits->size;
+    size_t word = from / 64;
+    uint64_t w = bits->words[word] & (~(uint64_t)0 << (from % 64));
+    while (!w) {
+        if (++word == bits->num_words) return bits->size;
+        w = bits->words[word];
+    }
+    return word * 64 + (size_t)__builtin_ctzll(w);
+}
+
+bool dsalib_bitset_build_index(dsalib_bitset_t* bits) {
+    if (!bits) return false;
+    size_t blocks = num_blocks(bits);
+    if (!bits->index) {
+        bits->index = malloc((blocks + 1) * sizeof(uint64_t));
+        if (!bits->index) return false;
+    }
+    uint64_t count = 0;
+    for (size_t b = 0; b < blocks; b++) {
+        bits->index[b] = count;
+        // The padding guarantees 8 readable words only up to the last vector.
+        size_t end = (b + 1) * WORDS_PER_BLOCK;
+        size_t limit = padded_words(bits->num_words);
+        count += popcount_words(bits->words + b * WORDS_PER_BLOCK, NULL,
+                                (end < limit ? end : limit) - b * WORDS_PER_BLOCK);
+    }
+    bits->index[blocks] = count;
+    bits->index_valid = true;
+    return true;
+}
+
+size_t dsalib_bitset_rank(const dsalib_bitset_t* bits, size_t i) {
+    if (!bits) return 0;
+    if (i >= bits->size) return dsalib_bitset_count(bits);
+    size_t word = i / 64;
+    size_t first = 0;
+    size_t count = 0;
+    if (bits->index_valid) {
+        first = word / WORDS_PER_BLOCK * WORDS_PER_BLOCK;
+        count = (size_t)bits->index[word / WORDS_PER_BLOCK];
+    }
+    for (size_t w = first; w < word; w++) {
+        count += popcount64(bits->words[w]);
+    }
+    return count + popcount64(bits->words[word] & (((uint64_t)1 << (i % 64)) - 1));
+}
+
+bool dsalib_bitset_select(const dsalib_bitset_t* bits, size_t k, size_t* pos) {
+    if (!bits) return false;
+    size_t word = 0;
+    if (bits->index_valid) {
+        size_t blocks = num_blocks(bits);
+        if (k >= bits->index[blocks]) return false;
+        // Last block whose starting rank is <= k.
+        size_t lo = 0, hi = blocks - 1;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo + 1) / 2;
+            if (bits->index[mid] <= k) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        k -= (size_t)bits->index[lo];
+        word = lo * WORDS_PER_BLOCK;
+    }
+    for (; word < bits->num_words; word++) {
+        size_t c = popcount64(bits->words[word]);
+        if (k < c) {
+            if (pos) *pos = word * 64 + select64(bits->words[word], k);
+            return true;
+        }
+        k -= c;
+    }
+    return false;
+}
+
+size_t dsalib_bitset_to_array(const dsalib_bitset_t* bits, int* out) {
+    if (!bits || !out) return 0;
+    size_t n = 0;
+    for (size_t word = 0; word < bits->num_words; word++) {
+        uint64_t w = bits->words[word];
+        int base = (int)(word * 64);
+        while (w) {
+            out[n++] = base + __builtin_ctzll(w);
+            w &= w - 1;
+        }
+    }
+    return n;
+}
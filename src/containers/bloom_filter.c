@@ -0,0 +1,156 @@
+#include "dsalib/containers/bloom_filter.h"
+
+#include "dsalib/util/hash.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define BLOCK_BYTES (DSALIB_BLOOM_BLOCK_WORDS * sizeof(uint32_t))
+#define PREFETCH_DISTANCE 8
+
+/* Odd multipliers selecting one bit per word (from the Parquet SBBF spec). */
+static const uint32_t SALT[DSALIB_BLOOM_BLOCK_WORDS] = {
+    0x47b6137bU,
+    0x44974d91U,
+    0x8824ad5bU,
+    0xa2b7289dU,
+    0x705495c7U,
+    0x2df1424bU,
+    0x9efc4947U,
+    0x5c6bfb31U,
+};
+
+/*
+ * Expected false-positive rate when blocks hold on average `load` keys.
+ * Block loads are Poisson distributed; a block with l keys answers a
+ * random probe positively with probability (1 - (31/32)^l)^8.
+ */
+static double expected_fpr(double load) {
+    double fpr = 0.0;
+    double pmf = exp(-load);
+    double limit = load + 10.0 * sqrt(load) + 10.0;
+    for (int l = 0; l <= (int)limit; l++) {
+        fpr += pmf * pow(1.0 - pow(31.0 / 32.0, l), DSALIB_BLOOM_BLOCK_WORDS);
+        pmf *= load / (l + 1);
+    }
+    return fpr;
+}
+
+dsalib_bloom_filter_t* dsalib_bloom_filter_create(size_t expected_keys, double fpr) {
+    if (!(fpr > 0.0 && fpr < 1.0)) return NULL;
+    if (expected_keys == 0) expected_keys = 1;
+
+    // Start from the unblocked estimate m = -8n / ln(1 - p^(1/8)), then grow
+    // until the uneven block loads are accounted for as well.
+    double bits = -8.0 * (double)expected_keys / log(1.0 - pow(fpr, 1.0 / 8.0));
+    double blocks = ceil(bits / (8.0 * BLOCK_BYTES));
+    while (expected_fpr((double)expected_keys / blocks) > fpr) {
+        blocks = ceil(blocks * 1.02);
+    }
+    if (blocks > (double)UINT32_MAX) return NULL;
+
+    dsalib_bloom_filter_t* filter = malloc(sizeof(dsalib_bloom_filter_t));
+    if (!filter) return NULL;
+    filter->num_blocks = blocks < 1.0 ? 1 : (uint32_t)blocks;
+    filter->blocks = aligned_alloc(BLOCK_BYTES, filter->num_blocks * BLOCK_BYTES);
+    if (!filter->blocks) {
+        free(filter);
+        return NULL;
+    }
+    memset(filter->blocks, 0, filter->num_blocks * BLOCK_BYTES);
+    return filter;
+}
+
+dsalib_bloom_filter_t* dsalib_bloom_filter_build(const int* arr, size_t size, double fpr) {
+    if (size > 0 && !arr) return NULL;
+    dsalib_bloom_filter_t* filter = dsalib_bloom_filter_create(size, fpr);
+    if (!filter) return NULL;
+    for (size_t i = 0; i < size; i++) {
+        dsalib_bloom_filter_add(filter, arr[i]);
+    }
+    return filter;
+}
+
+void dsalib_bloom_filter_destroy(dsalib_bloom_filter_t* filter) {
+    if (!filter) return;
+    free(filter->blocks);
+    free(filter);
+}
+
+/* High half of the hash picks the block, low half the bits inside it. */
+static uint32_t* block_for(const dsalib_bloom_filter_t* filter, uint64_t hash) {
+    return filter->blocks + (size_t)dsalib_hash_reduce((uint32_t)(hash >> 32), filter->num_blocks) *
+                                DSALIB_BLOOM_BLOCK_WORDS;
+}
+
+void dsalib_bloom_filter_add(dsalib_bloom_filter_t* filter, int key) {
+    if (!filter) return;
+    uint64_t hash = dsalib_hash_int(key);
+    uint32_t* block = block_for(filter, hash);
+    uint32_t low = (uint32_t)hash;
+    for (int i = 0; i < DSALIB_BLOOM_BLOCK_WORDS; i++) {
+        block[i] |= 1U << ((low * SALT[i]) >> 27);
+    }
+}
+
+static bool block_check(const uint32_t* block, uint32_t low) {
+#if defined(__AVX2__)
+    __m256i salts = _mm256_loadu_si256((const __m256i*)SALT);
+    __m256i shift = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)low), salts), 27);
+    __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+    __m256i bits = _mm256_load_si256((const __m256i*)block);
+    return _mm256_testc_si256(bits, mask);
+#elif defined(__SSE2__)
+    // SSE2 has no per-lane variable shift, so the masks are built scalar.
+    uint32_t mask[DSALIB_BLOOM_BLOCK_WORDS];
+    for (int i = 0; i < DSALIB_BLOOM_BLOCK_WORDS; i++) {
+        mask[i] = 1U << ((low * SALT[i]) >> 27);
+    }
+    __m128i m0 = _mm_loadu_si128((const __m128i*)mask);
+    __m128i m1 = _mm_loadu_si128((const __m128i*)(mask + 4));
+    __m128i b0 = _mm_load_si128((const __m128i*)block);
+    __m128i b1 = _mm_load_si128((const __m128i*)(block + 4));
+    __m128i eq = _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(b0, m0), m0), _mm_cmpeq_epi32(_mm_and_si128(b1, m1), m1));
+    return _mm_movemask_epi8(eq) == 0xFFFF;
+#else
+    for (int i = 0; i < DSALIB_BLOOM_BLOCK_WORDS; i++) {
+        uint32_t bit = 1U << ((low * SALT[i]) >> 27);
+        if (!(block[i] & bit)) return false;
+    }
+    return true;
+#endif
+}
+
+bool dsalib_bloom_filter_contains(const dsalib_bloom_filter_t* filter, int key) {
+    if (!filter) return false;
+    uint64_t hash = dsalib_hash_int(key);
+    return block_check(block_for(filter, hash), (uint32_t)hash);
+}
+
+size_t dsalib_bloom_filter_contains_batch(const dsalib_bloom_filter_t* filter,
+                                          const int* keys,
+                                          size_t size,
+                                          bool* out) {
+    if (!filter || (size > 0 && !keys)) return 0;
+
+    size_t maybe = 0;
+    for (size_t i = 0; i < size; i++) {
+#if defined(__GNUC__)
+        if (i + PREFETCH_DISTANCE < size) {
+            __builtin_prefetch(block_for(filter, dsalib_hash_int(keys[i + PREFETCH_DISTANCE])));
+        }
+#endif
+        uint64_t hash = dsalib_hash_int(keys[i]);
+        bool hit = block_check(block_for(filter, hash), (uint32_t)hash);
+        if (out) out[i] = hit;
+        maybe += hit;
+    }
+    return maybe;
+}
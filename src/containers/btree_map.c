@@ -0,0 +1,433 @@
+#include "dsalib/containers/btree_map.h"
+
+#include "dsalib/search/binary_search.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FANOUT DSALIB_BTREE_MAP_FANOUT
+#define MIN_KEYS (FANOUT / 2 - 1)
+#define CACHE_LINE 64
+
+/*
+ * keys[] comes first so it occupies exactly the first cache line of the
+ * aligned allocation. Inner nodes: all keys in children[i] are < keys[i],
+ * all keys in children[i + 1] are >= keys[i]. Leaves: sorted keys/values
+ * plus links to the neighbouring leaves.
+ */
+struct dsalib_btree_map_node {
+    int keys[FANOUT];
+    uint16_t count;
+    uint16_t is_leaf;
+    union {
+        dsalib_btree_map_node_t* children[FANOUT + 1];
+        struct {
+            int values[FANOUT];
+            dsalib_btree_map_node_t* next;
+            dsalib_btree_map_node_t* prev;
+        };
+    };
+};
+
+typedef dsalib_btree_map_node_t node_t;
+
+static node_t* node_create(bool is_leaf) {
+    size_t bytes = (sizeof(node_t) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    node_t* node = aligned_alloc(CACHE_LINE, bytes);
+    if (!node) return NULL;
+    node->count = 0;
+    node->is_leaf = is_leaf;
+    if (is_leaf) {
+        node->next = NULL;
+        node->prev = NULL;
+    }
+    return node;
+}
+
+static void node_destroy(node_t* node) {
+    if (!node->is_leaf) {
+        for (size_t i = 0; i <= node->count; i++) {
+            node_destroy(node->children[i]);
+        }
+    }
+    free(node);
+}
+
+/* Index of the child whose key range contains key. */
+static size_t child_index(const node_t* node, int key) {
+    size_t i = dsalib_lower_bound(node->keys, node->count, key);
+    if (i < node->count && node->keys[i] == key) i++;
+    return i;
+}
+
+dsalib_btree_map_t* dsalib_btree_map_create(void) {
+    dsalib_btree_map_t* map = malloc(sizeof(dsalib_btree_map_t));
+    if (!map) return NULL;
+    map->root = node_create(true);
+    if (!map->root) {
+        free(map);
+        return NULL;
+    }
+    map->size = 0;
+    map->height = 1;
+    return map;
+}
+
+void dsalib_btree_map_destroy(dsalib_btree_map_t* map) {
+    if (!map) return;
+    node_destroy(map->root);
+    free(map);
+}
+
+size_t dsalib_btree_map_size(const dsalib_btree_map_t* map) {
+    if (!map) return 0;
+    return map->size;
+}
+
+/*
+ * Splits the full child parent->children[i] into two halves and inserts the
+ * separator into parent, which must not be full.
+ */
+static bool split_child(node_t* parent, size_t i) {
+    node_t* left = parent->children[i];
+    node_t* right = node_create(left->is_leaf);
+    if (!right) return false;
+
+    int separator;
+    if (left->is_leaf) {
+        size_t half = FANOUT / 2;
+        right->count = (uint16_t)(FANOUT - half);
+        memcpy(right->keys, left->keys + half, right->count * sizeof(int));
+        memcpy(right->values, left->values + half, right->count * sizeof(int));
+        left->count = (uint16_t)half;
+        right->next = left->next;
+        right->prev = left;
+        if (left->next) left->next->prev = right;
+        left->next = right;
+        separator = right->keys[0];
+    } else {
+        size_t mid = FANOUT / 2;
+        separator = left->keys[mid];
+        right->count = (uint16_t)(FANOUT - mid - 1);
+        memcpy(right->keys, left->keys + mid + 1, right->count * sizeof(int));
+        memcpy(right->children, left->children + mid + 1, (right->count + 1) * sizeof(node_t*));
+        left->count = (uint16_t)mid;
+    }
+
+    memmove(parent->keys + i + 1, parent->keys + i, (parent->count - i) * sizeof(int));
+    memmove(parent->children + i + 2, parent->children + i + 1, (parent->count - i) * sizeof(node_t*));
+    parent->keys[i] = separator;
+    parent->children[i + 1] = right;
+    parent->count++;
+    return true;
+}
+
+bool dsalib_btree_map_insert(dsalib_btree_map_t* map, int key, int value) {
+    if (!map) return false;
+
+    if (map->root->count == FANOUT) {
+        node_t* root = node_create(false);
+        if (!root) return false;
+        root->children[0] = map->root;
+        if (!split_child(root, 0)) {
+            free(root);
+            return false;
+        }
+        map->root = root;
+        map->height++;
+    }
+
+    node_t* node = map->root;
+    while (!node->is_leaf) {
+        size_t i = child_index(node, key);
+        if (node->children[i]->count == FANOUT) {
+            if (!split_child(node, i)) return false;
+            if (key >= node->keys[i]) i++;
+        }
+        node = node->children[i];
+    }
+
+    size_t pos = dsalib_lower_bound(node->keys, node->count, key);
+    if (pos < node->count && node->keys[pos] == key) {
+        node->values[pos] = value;
+        return true;
+    }
+    memmove(node->keys + pos + 1, node->keys + pos, (node->count - pos) * sizeof(int));
+    memmove(node->values + pos + 1, node->values + pos, (node->count - pos) * sizeof(int));
+    node->keys[pos] = key;
+    node->values[pos] = value;
+    node->count++;
+    map->size++;
+    return true;
+}
+
+bool dsalib_btree_map_find(const dsalib_btree_map_t* map, int key, int* value) {
+    if (!map) return false;
+
+    const node_t* node = map->root;
+    while (!node->is_leaf) {
+        node = node->children[child_index(node, key)];
+    }
+    size_t pos = dsalib_lower_bound(node->keys, node->count, key);
+    if (pos == node->count || node->keys[pos] != key) return false;
+    if (value) *value = node->values[pos];
+    return true;
+}
+
+/* Moves the last entry of the left sibling to the front of child i. */
+static void borrow_from_left(node_t* parent, size_t i) {
+    node_t* child = parent->children[i];
+    node_t* left = parent->children[i - 1];
+
+    memmove(child->keys + 1, child->keys, child->count * sizeof(int));
+    if (child->is_leaf) {
+        memmove(child->values + 1, child->values, child->count * sizeof(int));
+        child->keys[0] = left->keys[left->count - 1];
+        child->values[0] = left->values[left->count - 1];
+        parent->keys[i - 1] = child->keys[0];
+    } else {
+        memmove(child->children + 1, child->children, (child->count + 1) * sizeof(node_t*));
+        child->keys[0] = parent->keys[i - 1];
+        child->children[0] = left->children[left->count];
+        parent->keys[i - 1] = left->keys[left->count - 1];
+    }
+    child->count++;
+    left->count--;
+}
+
+/* Moves the first entry of the right sibling to the end of child i. */
+static void borrow_from_right(node_t* parent, size_t i) {
+    node_t* child = parent->children[i];
+    node_t* right = parent->children[i + 1];
+
+    if (child->is_leaf) {
+        child->keys[child->count] = right->keys[0];
+        child->values[child->count] = right->values[0];
+        memmove(right->values, right->values + 1, (right->count - 1) * sizeof(int));
+        memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(int));
+        parent->keys[i] = right->keys[0];
+    } else {
+        child->keys[child->count] = parent->keys[i];
+        child->children[child->count + 1] = right->children[0];
+        parent->keys[i] = right->keys[0];
+        memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(int));
+        memmove(right->children, right->children + 1, right->count * sizeof(node_t*));
+    }
+    child->count++;
+    right->count--;
+}
+
+/* Merges children[i + 1] into children[i] and drops separator i. */
+static void merge_children(node_t* parent, size_t i) {
+    node_t* left = parent->children[i];
+    node_t* right = parent->children[i + 1];
+
+    if (left->is_leaf) {
+        memcpy(left->keys + left->count, right->keys, right->count * sizeof(int));
+        memcpy(left->values + left->count, right->values, right->count * sizeof(int));
+        left->count += right->count;
+        left->next = right->next;
+        if (right->next) right->next->prev = left;
+    } else {
+        left->keys[left->count] = parent->keys[i];
+        memcpy(left->keys + left->count + 1, right->keys, right->count * sizeof(int));
+        memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(node_t*));
+        left->count += right->count + 1;
+    }
+    free(right);
+
+    memmove(parent->keys + i, parent->keys + i + 1, (parent->count - i - 1) * sizeof(int));
+    memmove(parent->children + i + 1, parent->children + i + 2, (parent->count - i - 1) * sizeof(node_t*));
+    parent->count--;
+}
+
+/*
+ * Makes sure parent->children[i] holds more than MIN_KEYS keys before the
+ * descent continues into it. Returns the index of the child to descend into.
+ */
+static size_t refill_child(node_t* parent, size_t i) {
+    if (parent->children[i]->count > MIN_KEYS) return i;
+
+    if (i > 0 && parent->children[i - 1]->count > MIN_KEYS) {
+        borrow_from_left(parent, i);
+    } else if (i < parent->count && parent->children[i + 1]->count > MIN_KEYS) {
+        borrow_from_right(parent, i);
+    } else if (i < parent->count) {
+        merge_children(parent, i);
+    } else {
+        merge_children(parent, i - 1);
+        i--;
+    }
+    return i;
+}
+
+bool dsalib_btree_map_erase(dsalib_btree_map_t* map, int key) {
+    if (!map) return false;
+
+    node_t* node = map->root;
+    while (!node->is_leaf) {
+        size_t i = refill_child(node, child_index(node, key));
+        if (node == map->root && node->count == 0) {
+            // The root's last two children were merged: shrink the tree.
+            map->root = node->children[0];
+            map->height--;
+            free(node);
+            node = map->root;
+            continue;
+        }
+        node = node->children[i];
+    }
+
+    size_t pos = dsalib_lower_bound(node->keys, node->count, key);
+    if (pos == node->count || node->keys[pos] != key) return false;
+    memmove(node->keys + pos, node->keys + pos + 1, (node->count - pos - 1) * sizeof(int));
+    memmove(node->values + pos, node->values + pos + 1, (node->count - pos - 1) * sizeof(int));
+    node->count--;
+    map->size--;
+    return true;
+}
+
+dsalib_btree_map_iter_t dsalib_btree_map_seek(const dsalib_btree_map_t* map, int key) {
+    dsalib_btree_map_iter_t it = {NULL, 0};
+    if (!map) return it;
+
+    const node_t* node = map->root;
+    while (!node->is_leaf) {
+        node = node->children[child_index(node, key)];
+    }
+    it.leaf = node;
+    it.index = dsalib_lower_bound(node->keys, node->count, key);
+    return it;
+}
+
+bool dsalib_btree_map_iter_next(dsalib_btree_map_iter_t* it, int* key, int* value) {
+    if (!it) return false;
+    while (it->leaf && it->index >= it->leaf->count) {
+        it->leaf = it->leaf->next;
+        it->index = 0;
+    }
+    if (!it->leaf) return false;
+    if (key) *key = it->leaf->keys[it->index];
+    if (value) *value = it->leaf->values[it->index];
+    it->index++;
+    return true;
+}
+
+size_t dsalib_btree_map_range(const dsalib_btree_map_t* map, int lo, int hi, int* keys, int* values, size_t max) {
+    if (!map || lo >= hi) return 0;
+
+    dsalib_btree_map_iter_t it = dsalib_btree_map_seek(map, lo);
+    size_t n = 0;
+    int key, value;
+    while (n < max && dsalib_btree_map_iter_next(&it, &key, &value) && key < hi) {
+        if (keys) keys[n] = key;
+        if (values) values[n] = value;
+        n++;
+    }
+    return n;
+}
+
+/*
+ * Bulk loading: build one level at a time, splitting `count` items into
+ * ceil(count / per_node) nodes of (almost) equal size so that every node
+ * except a lone root is at least half full.
+ */
+static size_t level_nodes(size_t count, size_t per_node) {
+    return (count + per_node - 1) / per_node;
+}
+
+static size_t level_share(size_t count, size_t nodes, size_t j) {
+    return count / nodes + (j < count % nodes);
+}
+
+dsalib_btree_map_t* dsalib_btree_map_bulk_load(const int* keys, const int* values, size_t n) {
+    if (n > 0 && (!keys || !values)) return NULL;
+    for (size_t i = 1; i < n; i++) {
+        if (keys[i - 1] >= keys[i]) return NULL;
+    }
+
+    dsalib_btree_map_t* map = dsalib_btree_map_create();
+    if (!map || n == 0) return map;
+
+    size_t count = level_nodes(n, FANOUT);
+    node_t** level = malloc(count * sizeof(node_t*));
+    int* low_keys = malloc(count * sizeof(int));
+    if (!level || !low_keys) {
+        free(level);
+        free(low_keys);
+        dsalib_btree_map_destroy(map);
+        return NULL;
+    }
+
+    // Leaves, linked left to right. The empty root leaf is reused first.
+    free(map->root);
+    map->root = NULL;
+    size_t offset = 0;
+    bool failed = false;
+    for (size_t j = 0; j < count; j++) {
+        node_t* leaf = node_create(true);
+        if (!leaf) {
+            failed = true;
+            count = j;
+            break;
+        }
+        size_t take = level_share(n, count, j);
+        memcpy(leaf->keys, keys + offset, take * sizeof(int));
+        memcpy(leaf->values, values + offset, take * sizeof(int));
+        leaf->count = (uint16_t)take;
+        if (j > 0) {
+            level[j - 1]->next = leaf;
+            leaf->prev = level[j - 1];
+        }
+        level[j] = leaf;
+        low_keys[j] = keys[offset];
+        offset += take;
+    }
+
+    size_t height = 1;
+    while (!failed && count > 1) {
+        size_t parents = level_nodes(count, FANOUT + 1);
+        size_t child = 0;
+        for (size_t j = 0; j < parents; j++) {
+            node_t* inner = node_create(false);
+            if (!inner) {
+                // Free the children not yet adopted, then the built parents.
+                for (size_t c = child; c < count; c++) {
+                    node_destroy(level[c]);
+                }
+                count = j;
+                failed = true;
+                break;
+            }
+            size_t take = level_share(count, parents, j);
+            int low = low_keys[child];
+            for (size_t c = 0; c < take; c++, child++) {
+                inner->children[c] = level[child];
+                if (c > 0) inner->keys[c - 1] = low_keys[child];
+            }
+            inner->count = (uint16_t)(take - 1);
+            level[j] = inner;
+            low_keys[j] = low;
+        }
+        if (!failed) count = parents;
+        height++;
+    }
+
+    if (failed) {
+        for (size_t j = 0; j < count; j++) {
+            node_destroy(level[j]);
+        }
+        free(level);
+        free(low_keys);
+        free(map);
+        return NULL;
+    }
+
+    map->root = level[0];
+    map->size = n;
+    map->height = height;
+    free(level);
+    free(low_keys);
+    return map;
+}
@@ -0,0 +1,395 @@
+#include "dsalib/containers/cache.h"
+
+#include "dsalib/util/hash.h"
+
+#include <stdlib.h>
+
+#define NIL UINT32_MAX
+#define DEFAULT_SHARDS 16
+#define MAX_FREQ 3
+
+enum {
+    QUEUE_FREE,  // On the free list
+    QUEUE_SMALL, // S3-FIFO small queue
+    QUEUE_MAIN,  // LRU list, S3-FIFO main queue, or an occupied CLOCK slot
+    QUEUE_GHOST  // S3-FIFO ghost: key only, not cached
+};
+
+struct dsalib_cache_entry {
+    int key;
+    int value;
+    uint32_t prev;  // Toward the list head (newer)
+    uint32_t next;  // Toward the list tail (older); free-list link
+    uint32_t chain; // Next entry in the same hash bucket
+    uint8_t queue;  // One of QUEUE_*
+    uint8_t freq;   // CLOCK reference bit / S3-FIFO access count
+};
+
+static void list_init(dsalib_cache_list_t* list) {
+    list->head = NIL;
+    list->tail = NIL;
+    list->size = 0;
+}
+
+static void list_push(dsalib_cache_t* cache, dsalib_cache_list_t* list, uint32_t index) {
+    dsalib_cache_entry_t* entry = &cache->entries[index];
+    entry->prev = NIL;
+    entry->next = list->head;
+    if (list->head != NIL) {
+        cache->entries[list->head].prev = index;
+    } else {
+        list->tail = index;
+    }
+    list->head = index;
+    list->size++;
+}
+
+static void list_remove(dsalib_cache_t* cache, dsalib_cache_list_t* list, uint32_t index) {
+    dsalib_cache_entry_t* entry = &cache->entries[index];
+    if (entry->prev != NIL) {
+        cache->entries[entry->prev].next = entry->next;
+    } else {
+        list->head = entry->next;
+    }
+    if (entry->next != NIL) {
+        cache->entries[entry->next].prev = entry->prev;
+    } else {
+        list->tail = entry->prev;
+    }
+    list->size--;
+}
+
+static dsalib_cache_list_t* list_of(dsalib_cache_t* cache, uint8_t queue) {
+    switch (queue) {
+    case QUEUE_SMALL: return &cache->small;
+    case QUEUE_GHOST: return &cache->ghost;
+    default: return cache->policy == DSALIB_CACHE_CLOCK ? NULL : &cache->main;
+    }
+}
+
+static uint32_t lookup(const dsalib_cache_t* cache, int key) {
+    uint32_t index = cache->buckets[dsalib_hash_int(key) & cache->bucket_mask];
+    while (index != NIL && cache->entries[index].key != key) {
+        index = cache->entries[index].chain;
+    }
+    return index;
+}
+
+static void hash_insert(dsalib_cache_t* cache, uint32_t index) {
+    uint32_t* bucket = &cache->buckets[dsalib_hash_int(cache->entries[index].key) & cache->bucket_mask];
+    cache->entries[index].chain = *bucket;
+    *bucket = index;
+}
+
+static void hash_remove(dsalib_cache_t* cache, uint32_t index) {
+    uint32_t* link = &cache->buckets[dsalib_hash_int(cache->entries[index].key) & cache->bucket_mask];
+    while (*link != index) {
+        link = &cache->entries[*link].chain;
+    }
+    *link = cache->entries[index].chain;
+}
+
+/* Unindexes an entry and returns it to the free list. */
+static void release(dsalib_cache_t* cache, uint32_t index) {
+    hash_remove(cache, index);
+    cache->entries[index].queue = QUEUE_FREE;
+    cache->entries[index].next = cache->free_list;
+    cache->free_list = index;
+}
+
+/* Records an access to a cached entry. */
+static void touch(dsalib_cache_t* cache, uint32_t index) {
+    dsalib_cache_entry_t* entry = &cache->entries[index];
+    switch (cache->policy) {
+    case DSALIB_CACHE_LRU:
+        if (cache->main.head != index) {
+            list_remove(cache, &cache->main, index);
+            list_push(cache, &cache->main, index);
+        }
+        break;
+    case DSALIB_CACHE_CLOCK: entry->freq = 1; break;
+    case DSALIB_CACHE_S3FIFO:
+        if (entry->freq < MAX_FREQ) entry->freq++;
+        break;
+    }
+}
+
+static void evict_s3fifo(dsalib_cache_t* cache) {
+    for (;;) {
+        if (cache->small.size >= cache->small_capacity || cache->main.size == 0) {
+            uint32_t index = cache->small.tail;
+            dsalib_cache_entry_t* entry = &cache->entries[index];
+            list_remove(cache, &cache->small, index);
+            if (entry->freq > 0) {
+                // Referenced while in probation: promote, evict later.
+                entry->freq = 0;
+                entry->queue = QUEUE_MAIN;
+                list_push(cache, &cache->main, index);
+                continue;
+            }
+            // Keep the key as a ghost; it keeps its hash chain position.
+            entry->queue = QUEUE_GHOST;
+            list_push(cache, &cache->ghost, index);
+            if (cache->ghost.size > cache->ghost_capacity) {
+                uint32_t oldest = cache->ghost.tail;
+                list_remove(cache, &cache->ghost, oldest);
+                release(cache, oldest);
+            }
+            return;
+        }
+        uint32_t index = cache->main.tail;
+        dsalib_cache_entry_t* entry = &cache->entries[index];
+        list_remove(cache, &cache->main, index);
+        if (entry->freq > 0) {
+            entry->freq--;
+            list_push(cache, &cache->main, index);
+            continue;
+        }
+        release(cache, index);
+        return;
+    }
+}
+
+/* Drops one cached key; the cache must be full. */
+static void evict(dsalib_cache_t* cache) {
+    switch (cache->policy) {
+    case DSALIB_CACHE_LRU: {
+        uint32_t index = cache->main.tail;
+        list_remove(cache, &cache->main, index);
+        release(cache, index);
+        break;
+    }
+    case DSALIB_CACHE_CLOCK: {
+        // Every slot is occupied, so the sweep stops within one revolution.
+        while (cache->entries[cache->hand].freq) {
+            cache->entries[cache->hand].freq = 0;
+            cache->hand = cache->hand + 1 == cache->capacity ? 0 : cache->hand + 1;
+        }
+        release(cache, cache->hand);
+        cache->hand = cache->hand + 1 == cache->capacity ? 0 : cache->hand + 1;
+        break;
+    }
+    case DSALIB_CACHE_S3FIFO: evict_s3fifo(cache); break;
+    }
+    cache->count--;
+    cache->stats.evictions++;
+}
+
+dsalib_cache_t* dsalib_cache_create(size_t capacity, dsalib_cache_policy_t policy) {
+    if (capacity == 0 || capacity >= ((size_t)1 << 31)) return NULL;
+    if (policy != DSALIB_CACHE_LRU && policy != DSALIB_CACHE_CLOCK && policy != DSALIB_CACHE_S3FIFO) return NULL;
+
+    dsalib_cache_t* cache = malloc(sizeof(dsalib_cache_t));
+    if (!cache) return NULL;
+    cache->capacity = capacity;
+    cache->count = 0;
+    cache->policy = policy;
+    cache->small_capacity = 0;
+    cache->ghost_capacity = 0;
+    if (policy == DSALIB_CACHE_S3FIFO) {
+        cache->small_capacity = capacity / 10 ? capacity / 10 : 1;
+        cache->ghost_capacity = capacity - cache->small_capacity;
+    }
+    list_init(&cache->small);
+    list_init(&cache->main);
+    list_init(&cache->ghost);
+    cache->hand = 0;
+    cache->stats = (dsalib_cache_stats_t){0, 0, 0};
+
+    size_t slots = capacity + cache->ghost_capacity;
+    size_t buckets = 1;
+    while (buckets < slots) buckets <<= 1;
+    cache->bucket_mask = buckets - 1;
+    cache->entries = malloc(slots * sizeof(dsalib_cache_entry_t));
+    cache->buckets = malloc(buckets * sizeof(uint32_t));
+    if (!cache->entries || !cache->buckets) {
+        dsalib_cache_destroy(cache);
+        return NULL;
+    }
+    for (size_t i = 0; i < buckets; i++) {
+        cache->buckets[i] = NIL;
+    }
+    // Free list in index order, so CLOCK fills its ring from slot 0.
+    for (size_t i = 0; i < slots; i++) {
+        cache->entries[i].queue = QUEUE_FREE;
+        cache->entries[i].next = i + 1 < slots ? (uint32_t)(i + 1) : NIL;
+    }
+    cache->free_list = 0;
+    return cache;
+}
+
+void dsalib_cache_destroy(dsalib_cache_t* cache) {
+    if (!cache) return;
+    free(cache->entries);
+    free(cache->buckets);
+    free(cache);
+}
+
+bool dsalib_cache_get(dsalib_cache_t* cache, int key, int* value) {
+    if (!cache) return false;
+    uint32_t index = lookup(cache, key);
+    if (index == NIL || cache->entries[index].queue == QUEUE_GHOST) {
+        cache->stats.misses++;
+        return false;
+    }
+    cache->stats.hits++;
+    touch(cache, index);
+    if (value) *value = cache->entries[index].value;
+    return true;
+}
+
+bool dsalib_cache_put(dsalib_cache_t* cache, int key, int value) {
+    if (!cache) return false;
+    uint32_t index = lookup(cache, key);
+    if (index != NIL && cache->entries[index].queue != QUEUE_GHOST) {
+        cache->entries[index].value = value;
+        touch(cache, index);
+        return true;
+    }
+
+    if (index != NIL) {
+        // Ghost hit: the key was evicted recently, so it skips probation.
+        list_remove(cache, &cache->ghost, index);
+        if (cache->count == cache->capacity) evict(cache);
+        dsalib_cache_entry_t* entry = &cache->entries[index];
+        entry->value = value;
+        entry->freq = 0;
+        entry->queue = QUEUE_MAIN;
+        list_push(cache, &cache->main, index);
+        cache->count++;
+        return true;
+    }
+
+    if (cache->count == cache->capacity) evict(cache);
+    index = cache->free_list;
+    dsalib_cache_entry_t* entry = &cache->entries[index];
+    cache->free_list = entry->next;
+    entry->key = key;
+    entry->value = value;
+    entry->freq = 0;
+    hash_insert(cache, index);
+    if (cache->policy == DSALIB_CACHE_S3FIFO) {
+        entry->queue = QUEUE_SMALL;
+        list_push(cache, &cache->small, index);
+    } else {
+        entry->queue = QUEUE_MAIN;
+        if (cache->policy == DSALIB_CACHE_LRU) list_push(cache, &cache->main, index);
+    }
+    cache->count++;
+    return true;
+}
+
+bool dsalib_cache_erase(dsalib_cache_t* cache, int key) {
+    if (!cache) return false;
+    uint32_t index = lookup(cache, key);
+    if (index == NIL || cache->entries[index].queue == QUEUE_GHOST) return false;
+    dsalib_cache_list_t* list = list_of(cache, cache->entries[index].queue);
+    if (list) list_remove(cache, list, index);
+    release(cache, index);
+    cache->count--;
+    return true;
+}
+
+size_t dsalib_cache_size(const dsalib_cache_t* cache) {
+    return cache ? cache->count : 0;
+}
+
+dsalib_cache_stats_t dsalib_cache_stats(const dsalib_cache_t* cache) {
+    if (!cache) return (dsalib_cache_stats_t){0, 0, 0};
+    return cache->stats;
+}
+
+dsalib_sharded_cache_t* dsalib_sharded_cache_create(size_t num_shards, size_t capacity,
+                                                    dsalib_cache_policy_t policy) {
+    if (num_shards == 0) num_shards = DEFAULT_SHARDS;
+    if (capacity == 0 || num_shards > ((size_t)1 << 32)) return NULL;
+    size_t shards = 1;
+    while (shards < num_shards) shards <<= 1;
+    size_t per_shard = (capacity + shards - 1) / shards;
+
+    dsalib_sharded_cache_t* cache = malloc(sizeof(dsalib_sharded_cache_t));
+    if (!cache) return NULL;
+    cache->num_shards = shards;
+    cache->shards = aligned_alloc(_Alignof(dsalib_sharded_cache_shard_t), shards * sizeof(dsalib_sharded_cache_shard_t));
+    if (!cache->shards) {
+        free(cache);
+        return NULL;
+    }
+    for (size_t s = 0; s < shards; s++) {
+        dsalib_sharded_cache_shard_t* shard = &cache->shards[s];
+        shard->cache = dsalib_cache_create(per_shard, policy);
+        if (!shard->cache) {
+            cache->num_shards = s;
+            dsalib_sharded_cache_destroy(cache);
+            return NULL;
+        }
+        pthread_mutex_init(&shard->lock, NULL);
+    }
+    return cache;
+}
+
+void dsalib_sharded_cache_destroy(dsalib_sharded_cache_t* cache) {
+    if (!cache) return;
+    for (size_t s = 0; s < cache->num_shards; s++) {
+        dsalib_cache_destroy(cache->shards[s].cache);
+        pthread_mutex_destroy(&cache->shards[s].lock);
+    }
+    free(cache->shards);
+    free(cache);
+}
+
+static inline dsalib_sharded_cache_shard_t* shard_for(dsalib_sharded_cache_t* cache, int key) {
+    return &cache->shards[(dsalib_hash_int(key) >> 32) & (cache->num_shards - 1)];
+}
+
+bool dsalib_sharded_cache_get(dsalib_sharded_cache_t* cache, int key, int* value) {
+    if (!cache) return false;
+    dsalib_sharded_cache_shard_t* shard = shard_for(cache, key);
+    pthread_mutex_lock(&shard->lock);
+    bool hit = dsalib_cache_get(shard->cache, key, value);
+    pthread_mutex_unlock(&shard->lock);
+    return hit;
+}
+
+bool dsalib_sharded_cache_put(dsalib_sharded_cache_t* cache, int key, int value) {
+    if (!cache) return false;
+    dsalib_sharded_cache_shard_t* shard = shard_for(cache, key);
+    pthread_mutex_lock(&shard->lock);
+    bool ok = dsalib_cache_put(shard->cache, key, value);
+    pthread_mutex_unlock(&shard->lock);
+    return ok;
+}
+
+bool dsalib_sharded_cache_erase(dsalib_sharded_cache_t* cache, int key) {
+    if (!cache) return false;
+    dsalib_sharded_cache_shard_t* shard = shard_for(cache, key);
+    pthread_mutex_lock(&shard->lock);
+    bool removed = dsalib_cache_erase(shard->cache, key);
+    pthread_mutex_unlock(&shard->lock);
+    return removed;
+}
+
+size_t dsalib_sharded_cache_size(dsalib_sharded_cache_t* cache) {
+    if (!cache) return 0;
+    size_t total = 0;
+    for (size_t s = 0; s < cache->num_shards; s++) {
+        pthread_mutex_lock(&cache->shards[s].lock);
+        total += dsalib_cache_size(cache->shards[s].cache);
+        pthread_mutex_unlock(&cache->shards[s].lock);
+    }
+    return total;
+}
+
+dsalib_cache_stats_t dsalib_sharded_cache_stats(dsalib_sharded_cache_t* cache) {
+    dsalib_cache_stats_t total = {0, 0, 0};
+    if (!cache) return total;
+    for (size_t s = 0; s < cache->num_shards; s++) {
+        pthread_mutex_lock(&cache->shards[s].lock);
+        dsalib_cache_stats_t stats = dsalib_cache_stats(cache->shards[s].cache);
+        pthread_mutex_unlock(&cache->shards[s].lock);
+        total.hits += stats.hits;
+        total.misses += stats.misses;
+        total.evictions += stats.evictions;
+    }
+    return total;
+}
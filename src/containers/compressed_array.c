@@ -0,0 +1,222 @@
+#include "dsalib/containers/compressed_array.h"
+
+#include "dsalib/search/binary_search.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define BLOCK DSALIB_COMPRESSED_ARRAY_BLOCK
+#define LANES 4
+#define PER_LANE (BLOCK / LANES)
+
+static uint32_t bits_needed(uint32_t x) {
+    uint32_t bits = 0;
+    while (x) {
+        bits++;
+        x >>= 1;
+    }
+    return bits;
+}
+
+/*
+ * Lane l holds deltas l, l + 4, l + 8, ... packed LSB first; word k of lane l
+ * is stored at words[4 * k + l], so one 16-byte load fetches word k of all
+ * four lanes. A block of width b occupies exactly 4 * b words.
+ */
+static void pack_block(const uint32_t* deltas, uint32_t bits, uint32_t* words) {
+    if (bits == 0) return;
+    memset(words, 0, LANES * bits * sizeof(uint32_t));
+    for (size_t j = 0; j < PER_LANE; j++) {
+        size_t position = j * bits;
+        size_t word = position / 32;
+        uint32_t shift = (uint32_t)(position % 32);
+        for (size_t lane = 0; lane < LANES; lane++) {
+            uint32_t delta = deltas[j * LANES + lane];
+            words[LANES * word + lane] |= delta << shift;
+            if (shift + bits > 32) words[LANES * (word + 1) + lane] |= delta >> (32 - shift);
+        }
+    }
+}
+
+static void unpack_block(const uint32_t* words, uint32_t bits, int first, int* out) {
+    if (bits == 0) {
+        for (size_t i = 0; i < BLOCK; i++) out[i] = first;
+        return;
+    }
+#if defined(__SSE2__)
+    const __m128i mask = _mm_set1_epi32(bits == 32 ? -1 : (int)((1U << bits) - 1));
+    const __m128i* in = (const __m128i*)words;
+    __m128i word = _mm_loadu_si128(in++);
+    __m128i running = _mm_set1_epi32(first);
+    uint32_t shift = 0;
+    for (size_t j = 0; j < PER_LANE; j++) {
+        __m128i v = _mm_srl_epi32(word, _mm_cvtsi32_si128((int)shift));
+        shift += bits;
+        if (shift >= 32 && j + 1 < PER_LANE) {
+            shift -= 32;
+            word = _mm_loadu_si128(in++);
+            if (shift) v = _mm_or_si128(v, _mm_sll_epi32(word, _mm_cvtsi32_si128((int)(bits - shift))));
+        }
+        v = _mm_and_si128(v, mask);
+        // Prefix sum of the four deltas, then add the last value so far.
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi32(v, running);
+        _mm_storeu_si128((__m128i*)(out + j * LANES), v);
+        running = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+#else
+    uint32_t mask = bits == 32 ? UINT32_MAX : (1U << bits) - 1;
+    uint32_t value = (uint32_t)first;
+    for (size_t j = 0; j < PER_LANE; j++) {
+        size_t position = j * bits;
+        size_t word = position / 32;
+        uint32_t shift = (uint32_t)(position % 32);
+        for (size_t lane = 0; lane < LANES; lane++) {
+            uint32_t delta = words[LANES * word + lane] >> shift;
+            if (shift + bits > 32) delta |= words[LANES * (word + 1) + lane] << (32 - shift);
+            value += delta & mask;
+            out[j * LANES + lane] = (int)value;
+        }
+    }
+#endif
+}
+
+dsalib_compressed_array_t* dsalib_compressed_array_create(const int* arr, size_t size) {
+    if (size > 0 && !arr) return NULL;
+    for (size_t i = 1; i < size; i++) {
+        if (arr[i - 1] > arr[i]) return NULL;
+    }
+
+    dsalib_compressed_array_t* array = calloc(1, sizeof(dsalib_compressed_array_t));
+    if (!array) return NULL;
+    size_t num_blocks = (size + BLOCK - 1) / BLOCK;
+    array->size = size;
+    array->num_blocks = num_blocks;
+    array->offsets = malloc((num_blocks + 1) * sizeof(size_t));
+    array->block_first = malloc((num_blocks ? num_blocks : 1) * sizeof(int));
+    array->block_max = malloc((num_blocks ? num_blocks : 1) * sizeof(int));
+    if (!array->offsets || !array->block_first || !array->block_max) {
+        dsalib_compressed_array_destroy(array);
+        return NULL;
+    }
+
+    // First pass: per-block bit widths give the exact payload size.
+    array->offsets[0] = 0;
+    for (size_t b = 0; b < num_blocks; b++) {
+        size_t begin = b * BLOCK;
+        size_t end = begin + BLOCK < size ? begin + BLOCK : size;
+        uint32_t largest = 0;
+        for (size_t i = begin + 1; i < end; i++) {
+            uint32_t delta = (uint32_t)arr[i] - (uint32_t)arr[i - 1];
+            if (delta > largest) largest = delta;
+        }
+        array->block_first[b] = arr[begin];
+        array->block_max[b] = arr[end - 1];
+        array->offsets[b + 1] = array->offsets[b] + LANES * bits_needed(largest);
+    }
+    array->words = malloc((array->offsets[num_blocks] ? array->offsets[num_blocks] : 1) * sizeof(uint32_t));
+    if (!array->words) {
+        dsalib_compressed_array_destroy(array);
+        return NULL;
+    }
+
+    // Second pass: pack. A short last block is padded with zero deltas.
+    uint32_t deltas[BLOCK];
+    for (size_t b = 0; b < num_blocks; b++) {
+        size_t begin = b * BLOCK;
+        size_t end = begin + BLOCK < size ? begin + BLOCK : size;
+        memset(deltas, 0, sizeof(deltas));
+        for (size_t i = begin + 1; i < end; i++) {
+            deltas[i - begin] = (uint32_t)arr[i] - (uint32_t)arr[i - 1];
+        }
+        uint32_t bits = (uint32_t)((array->offsets[b + 1] - array->offsets[b]) / LANES);
+        pack_block(deltas, bits, array->words + array->offsets[b]);
+    }
+    return array;
+}
+
+void dsalib_compressed_array_destroy(dsalib_compressed_array_t* array) {
+    if (!array) return;
+    free(array->words);
+    free(array->offsets);
+    free(array->block_first);
+    free(array->block_max);
+    free(array);
+}
+
+size_t dsalib_compressed_array_size(const dsalib_compressed_array_t* array) {
+    if (!array) return 0;
+    return array->size;
+}
+
+size_t dsalib_compressed_array_memory(const dsalib_compressed_array_t* array) {
+    if (!array) return 0;
+    return sizeof(*array) + array->offsets[array->num_blocks] * sizeof(uint32_t) +
+           (array->num_blocks + 1) * sizeof(size_t) + 2 * array->num_blocks * sizeof(int);
+}
+
+size_t dsalib_compressed_array_decode_block(const dsalib_compressed_array_t* array, size_t block, int* out) {
+    if (!array || !out || block >= array->num_blocks) return 0;
+    uint32_t bits = (uint32_t)((array->offsets[block + 1] - array->offsets[block]) / LANES);
+    size_t begin = block * BLOCK;
+    size_t count = array->size - begin < BLOCK ? array->size - begin : BLOCK;
+    if (count == BLOCK) {
+        unpack_block(array->words + array->offsets[block], bits, array->block_first[block], out);
+    } else {
+        // Keep the padding of the last block out of the caller's buffer.
+        int buffer[BLOCK];
+        unpack_block(array->words + array->offsets[block], bits, array->block_first[block], buffer);
+        memcpy(out, buffer, count * sizeof(int));
+    }
+    return count;
+}
+
+size_t dsalib_compressed_array_decode(const dsalib_compressed_array_t* array, int* out) {
+    if (!array || !out) return 0;
+    size_t written = 0;
+    for (size_t b = 0; b < array->num_blocks; b++) {
+        written += dsalib_compressed_array_decode_block(array, b, out + written);
+    }
+    return written;
+}
+
+bool dsalib_compressed_array_get(const dsalib_compressed_array_t* array, size_t index, int* value) {
+    if (!array || !value || index >= array->size) return false;
+    int buffer[BLOCK];
+    dsalib_compressed_array_decode_block(array, index / BLOCK, buffer);
+    *value = buffer[index % BLOCK];
+    return true;
+}
+
+size_t dsalib_compressed_array_lower_bound(const dsalib_compressed_array_t* array, int target) {
+    if (!array) return 0;
+
+    // Every value before block b is <= block_max[b - 1] < target.
+    size_t b = dsalib_lower_bound(array->block_max, array->num_blocks, target);
+    if (b == array->num_blocks) return array->size;
+    if (array->block_first[b] >= target) return b * BLOCK;
+
+    int buffer[BLOCK];
+    size_t count = dsalib_compressed_array_decode_block(array, b, buffer);
+    return b * BLOCK + dsalib_lower_bound(buffer, count, target);
+}
+
+bool dsalib_compressed_array_contains(const dsalib_compressed_array_t* array, int target) {
+    if (!array) return false;
+
+    size_t b = dsalib_lower_bound(array->block_max, array->num_blocks, target);
+    if (b == array->num_blocks) return false;
+    // The block bounds settle some queries without decoding.
+    if (array->block_first[b] >= target) return array->block_first[b] == target;
+    if (array->block_max[b] == target) return true;
+
+    int buffer[BLOCK];
+    size_t count = dsalib_compressed_array_decode_block(array, b, buffer);
+    size_t i = dsalib_lower_bound(buffer, count, target);
+    return buffer[i] == target;
+}
@@ -0,0 +1,259 @@
+#include "dsalib/containers/concurrent_map.h"
+
+#include "dsalib/util/hash.h"
+
+#include <stdlib.h>
+
+#define DEFAULT_SHARDS 64
+#define MIN_CAPACITY 16
+
+struct dsalib_concurrent_map_table {
+    size_t mask;                                 // Capacity - 1 (capacity is a power of two)
+    dsalib_concurrent_map_table_t* next_retired; // Next older table on the retired list
+    _Atomic uint8_t* used;                       // 1 if the slot holds an entry
+    _Atomic uint64_t* slots;                     // Entry packed as key << 32 | value
+};
+
+static inline uint64_t pack(int key, int value) {
+    return (uint64_t)(uint32_t)key << 32 | (uint32_t)value;
+}
+
+static inline int unpack_key(uint64_t slot) {
+    return (int)(uint32_t)(slot >> 32);
+}
+
+static inline int unpack_value(uint64_t slot) {
+    return (int)(uint32_t)slot;
+}
+
+static dsalib_concurrent_map_table_t* table_create(size_t capacity) {
+    dsalib_concurrent_map_table_t* table = malloc(sizeof(dsalib_concurrent_map_table_t));
+    if (!table) return NULL;
+    table->mask = capacity - 1;
+    table->next_retired = NULL;
+    table->used = calloc(capacity, sizeof(_Atomic uint8_t));
+    table->slots = calloc(capacity, sizeof(_Atomic uint64_t));
+    if (!table->used || !table->slots) {
+        free((void*)table->used);
+        free((void*)table->slots);
+        free(table);
+        return NULL;
+    }
+    return table;
+}
+
+static void table_destroy(dsalib_concurrent_map_table_t* table) {
+    free((void*)table->used);
+    free((void*)table->slots);
+    free(table);
+}
+
+static void free_retired(dsalib_concurrent_map_shard_t* shard) {
+    while (shard->retired) {
+        dsalib_concurrent_map_table_t* next = shard->retired->next_retired;
+        table_destroy(shard->retired);
+        shard->retired = next;
+    }
+}
+
+dsalib_concurrent_map_t* dsalib_concurrent_map_create(size_t num_shards, size_t initial_capacity) {
+    if (num_shards == 0) num_shards = DEFAULT_SHARDS;
+    if (num_shards > ((size_t)1 << 32)) return NULL;
+    size_t shards = 1;
+    while (shards < num_shards) shards <<= 1;
+
+    // Per-shard capacity at a load factor of 3/4.
+    size_t per_shard = initial_capacity / shards + 1;
+    size_t capacity = MIN_CAPACITY;
+    while (capacity * 3 / 4 < per_shard) capacity <<= 1;
+
+    dsalib_concurrent_map_t* map = malloc(sizeof(dsalib_concurrent_map_t));
+    if (!map) return NULL;
+    map->num_shards = shards;
+    map->shards = aligned_alloc(_Alignof(dsalib_concurrent_map_shard_t), shards * sizeof(dsalib_concurrent_map_shard_t));
+    if (!map->shards) {
+        free(map);
+        return NULL;
+    }
+    for (size_t s = 0; s < shards; s++) {
+        dsalib_concurrent_map_shard_t* shard = &map->shards[s];
+        dsalib_concurrent_map_table_t* table = table_create(capacity);
+        if (!table) {
+            map->num_shards = s;
+            dsalib_concurrent_map_destroy(map);
+            return NULL;
+        }
+        atomic_init(&shard->sequence, 0);
+        atomic_init(&shard->table, table);
+        atomic_init(&shard->count, 0);
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->retired = NULL;
+    }
+    return map;
+}
+
+void dsalib_concurrent_map_destroy(dsalib_concurrent_map_t* map) {
+    if (!map) return;
+    for (size_t s = 0; s < map->num_shards; s++) {
+        dsalib_concurrent_map_shard_t* shard = &map->shards[s];
+        table_destroy(atomic_load_explicit(&shard->table, memory_order_relaxed));
+        free_retired(shard);
+        pthread_mutex_destroy(&shard->lock);
+    }
+    free(map->shards);
+    free(map);
+}
+
+static inline dsalib_concurrent_map_shard_t* shard_for(const dsalib_concurrent_map_t* map, uint64_t hash) {
+    return &map->shards[(hash >> 32) & (map->num_shards - 1)];
+}
+
+/* Places an entry known to be absent; the caller holds the shard lock. */
+static void place(dsalib_concurrent_map_table_t* table, uint64_t hash, uint64_t slot) {
+    size_t i = hash & table->mask;
+    while (atomic_load_explicit(&table->used[i], memory_order_relaxed)) {
+        i = (i + 1) & table->mask;
+    }
+    atomic_store_explicit(&table->slots[i], slot, memory_order_relaxed);
+    atomic_store_explicit(&table->used[i], 1, memory_order_release);
+}
+
+/*
+ * Rehashes into a table of twice the capacity, then publishes it. The old
+ * table is never written again, so readers still probing it see a
+ * consistent (if slightly stale) snapshot.
+ */
+static bool grow(dsalib_concurrent_map_shard_t* shard, dsalib_concurrent_map_table_t* old) {
+    dsalib_concurrent_map_table_t* table = table_create(2 * (old->mask + 1));
+    if (!table) return false;
+    for (size_t i = 0; i <= old->mask; i++) {
+        if (!atomic_load_explicit(&old->used[i], memory_order_relaxed)) continue;
+        uint64_t slot = atomic_load_explicit(&old->slots[i], memory_order_relaxed);
+        place(table, dsalib_hash_int(unpack_key(slot)), slot);
+    }
+    atomic_store_explicit(&shard->table, table, memory_order_release);
+    old->next_retired = shard->retired;
+    shard->retired = old;
+    return true;
+}
+
+bool dsalib_concurrent_map_insert(dsalib_concurrent_map_t* map, int key, int value) {
+    if (!map) return false;
+    uint64_t hash = dsalib_hash_int(key);
+    dsalib_concurrent_map_shard_t* shard = shard_for(map, hash);
+    bool ok = true;
+
+    pthread_mutex_lock(&shard->lock);
+    dsalib_concurrent_map_table_t* table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    for (size_t i = hash & table->mask; atomic_load_explicit(&table->used[i], memory_order_relaxed);
+         i = (i + 1) & table->mask) {
+        if (unpack_key(atomic_load_explicit(&table->slots[i], memory_order_relaxed)) == key) {
+            atomic_store_explicit(&table->slots[i], pack(key, value), memory_order_relaxed);
+            pthread_mutex_unlock(&shard->lock);
+            return true;
+        }
+    }
+
+    size_t count = atomic_load_explicit(&shard->count, memory_order_relaxed);
+    if ((count + 1) * 4 > (table->mask + 1) * 3) {
+        ok = grow(shard, table);
+        table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    }
+    if (ok) {
+        place(table, hash, pack(key, value));
+        atomic_store_explicit(&shard->count, count + 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return ok;
+}
+
+bool dsalib_concurrent_map_find(const dsalib_concurrent_map_t* map, int key, int* value) {
+    if (!map) return false;
+    uint64_t hash = dsalib_hash_int(key);
+    dsalib_concurrent_map_shard_t* shard = shard_for(map, hash);
+
+    for (;;) {
+        unsigned before = atomic_load_explicit(&shard->sequence, memory_order_acquire);
+        if (before & 1) continue; // An erase is shifting entries
+        dsalib_concurrent_map_table_t* table = atomic_load_explicit(&shard->table, memory_order_acquire);
+
+        bool found = false;
+        int result = 0;
+        size_t i = hash & table->mask;
+        // Bounded by the capacity in case a torn probe never meets an empty slot.
+        for (size_t probes = 0; probes <= table->mask; probes++) {
+            if (!atomic_load_explicit(&table->used[i], memory_order_acquire)) break;
+            uint64_t slot = atomic_load_explicit(&table->slots[i], memory_order_relaxed);
+            if (unpack_key(slot) == key) {
+                found = true;
+                result = unpack_value(slot);
+                break;
+            }
+            i = (i + 1) & table->mask;
+        }
+
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&shard->sequence, memory_order_relaxed) == before) {
+            if (found && value) *value = result;
+            return found;
+        }
+    }
+}
+
+bool dsalib_concurrent_map_erase(dsalib_concurrent_map_t* map, int key) {
+    if (!map) return false;
+    uint64_t hash = dsalib_hash_int(key);
+    dsalib_concurrent_map_shard_t* shard = shard_for(map, hash);
+
+    pthread_mutex_lock(&shard->lock);
+    dsalib_concurrent_map_table_t* table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    size_t mask = table->mask;
+    size_t hole = hash & mask;
+    for (;; hole = (hole + 1) & mask) {
+        if (!atomic_load_explicit(&table->used[hole], memory_order_relaxed)) {
+            pthread_mutex_unlock(&shard->lock);
+            return false;
+        }
+        if (unpack_key(atomic_load_explicit(&table->slots[hole], memory_order_relaxed)) == key) break;
+    }
+
+    unsigned sequence = atomic_load_explicit(&shard->sequence, memory_order_relaxed);
+    atomic_store_explicit(&shard->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    // Backward shift: pull later entries of the cluster into the hole
+    // unless their home slot lies cyclically in (hole, j].
+    for (size_t j = (hole + 1) & mask; atomic_load_explicit(&table->used[j], memory_order_relaxed);
+         j = (j + 1) & mask) {
+        uint64_t slot = atomic_load_explicit(&table->slots[j], memory_order_relaxed);
+        size_t home = dsalib_hash_int(unpack_key(slot)) & mask;
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            atomic_store_explicit(&table->slots[hole], slot, memory_order_relaxed);
+            hole = j;
+        }
+    }
+    atomic_store_explicit(&table->used[hole], 0, memory_order_relaxed);
+
+    atomic_store_explicit(&shard->sequence, sequence + 2, memory_order_release);
+    atomic_fetch_sub_explicit(&shard->count, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&shard->lock);
+    return true;
+}
+
+size_t dsalib_concurrent_map_size(const dsalib_concurrent_map_t* map) {
+    if (!map) return 0;
+    size_t total = 0;
+    for (size_t s = 0; s < map->num_shards; s++) {
+        total += atomic_load_explicit(&map->shards[s].count, memory_order_relaxed);
+    }
+    return total;
+}
+
+void dsalib_concurrent_map_reclaim(dsalib_concurrent_map_t* map) {
+    if (!map) return;
+    for (size_t s = 0; s < map->num_shards; s++) {
+        pthread_mutex_lock(&map->shards[s].lock);
+        free_retired(&map->shards[s]);
+        pthread_mutex_unlock(&map->shards[s].lock);
+    }
+}
@@ -0,0 +1,207 @@
+#include "dsalib/containers/cuckoo_filter.h"
+
+#include "dsalib/util/hash.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define SLOTS 4
+#define MAX_KICKS 500
+#define PREFETCH_DISTANCE 8
+#define LANE_ONES 0x0001000100010001ULL
+#define LANE_HIGH 0x8000800080008000ULL
+
+static size_t next_pow2(size_t x) {
+    size_t p = 1;
+    while (p < x) p <<= 1;
+    return p;
+}
+
+dsalib_cuckoo_filter_t* dsalib_cuckoo_filter_create(size_t capacity, double fpr) {
+    if (!(fpr > 0.0 && fpr < 1.0)) return NULL;
+    if (capacity == 0) capacity = 1;
+
+    unsigned bits = (unsigned)ceil(log2(8.0 / fpr));
+    if (bits < 4) bits = 4;
+    if (bits > 16) bits = 16;
+
+    dsalib_cuckoo_filter_t* filter = malloc(sizeof(dsalib_cuckoo_filter_t));
+    if (!filter) return NULL;
+    filter->num_buckets = next_pow2((size_t)ceil((double)capacity / (SLOTS * 0.95)));
+    filter->buckets = calloc(filter->num_buckets, sizeof(uint64_t));
+    if (!filter->buckets) {
+        free(filter);
+        return NULL;
+    }
+    filter->count = 0;
+    filter->fingerprint_bits = bits;
+    filter->has_victim = false;
+    filter->victim_fingerprint = 0;
+    filter->victim_bucket = 0;
+    return filter;
+}
+
+void dsalib_cuckoo_filter_destroy(dsalib_cuckoo_filter_t* filter) {
+    if (!filter) return;
+    free(filter->buckets);
+    free(filter);
+}
+
+dsalib_cuckoo_filter_t* dsalib_cuckoo_filter_build(const int* arr, size_t size, double fpr) {
+    if (size > 0 && !arr) return NULL;
+    dsalib_cuckoo_filter_t* filter = dsalib_cuckoo_filter_create(size, fpr);
+    if (!filter) return NULL;
+    for (size_t i = 0; i < size; i++) {
+        if (!dsalib_cuckoo_filter_add(filter, arr[i])) {
+            dsalib_cuckoo_filter_destroy(filter);
+            return NULL;
+        }
+    }
+    return filter;
+}
+
+size_t dsalib_cuckoo_filter_size(const dsalib_cuckoo_filter_t* filter) {
+    if (!filter) return 0;
+    return filter->count;
+}
+
+/* Fingerprint from the high hash bits; 0 is reserved for empty slots. */
+static uint16_t fingerprint_of(const dsalib_cuckoo_filter_t* filter, uint64_t hash) {
+    uint16_t fp = (uint16_t)((hash >> 32) & ((1U << filter->fingerprint_bits) - 1));
+    return fp ? fp : 1;
+}
+
+/* The alternate bucket depends only on the current one and the fingerprint. */
+static size_t alt_bucket(const dsalib_cuckoo_filter_t* filter, size_t bucket, uint16_t fp) {
+    return (bucket ^ (size_t)dsalib_hash_u64(fp)) & (filter->num_buckets - 1);
+}
+
+/* Bit 15 of each lane is set where the lane equals fp (SWAR zero test). */
+static uint64_t match_lanes(uint64_t bucket, uint16_t fp) {
+    uint64_t x = bucket ^ (LANE_ONES * fp);
+    return (x - LANE_ONES) & ~x & LANE_HIGH;
+}
+
+static int lane_of(uint64_t matches) {
+    int lane = 0;
+    while (!(matches & (0x8000ULL << (16 * lane)))) lane++;
+    return lane;
+}
+
+static bool try_place(uint64_t* bucket, uint16_t fp) {
+    uint64_t empty = match_lanes(*bucket, 0);
+    if (!empty) return false;
+    int lane = lane_of(empty);
+    *bucket |= (uint64_t)fp << (16 * lane);
+    return true;
+}
+
+static bool try_remove(uint64_t* bucket, uint16_t fp) {
+    uint64_t found = match_lanes(*bucket, fp);
+    if (!found) return false;
+    int lane = lane_of(found);
+    *bucket &= ~(0xFFFFULL << (16 * lane));
+    return true;
+}
+
+bool dsalib_cuckoo_filter_add(dsalib_cuckoo_filter_t* filter, int key) {
+    if (!filter || filter->has_victim) return false;
+
+    uint64_t hash = dsalib_hash_int(key);
+    uint16_t fp = fingerprint_of(filter, hash);
+    size_t i1 = (size_t)hash & (filter->num_buckets - 1);
+    size_t i2 = alt_bucket(filter, i1, fp);
+    if (try_place(&filter->buckets[i1], fp) || try_place(&filter->buckets[i2], fp)) {
+        filter->count++;
+        return true;
+    }
+
+    // Both buckets full: evict a pseudo-random resident and relocate it.
+    size_t bucket = (hash >> 63) ? i1 : i2;
+    uint64_t state = hash;
+    for (int kick = 0; kick < MAX_KICKS; kick++) {
+        state = dsalib_hash_u64(state);
+        int lane = (int)(state % SLOTS);
+        uint16_t evicted = (uint16_t)(filter->buckets[bucket] >> (16 * lane));
+        filter->buckets[bucket] &= ~(0xFFFFULL << (16 * lane));
+        filter->buckets[bucket] |= (uint64_t)fp << (16 * lane);
+        fp = evicted;
+        bucket = alt_bucket(filter, bucket, fp);
+        if (try_place(&filter->buckets[bucket], fp)) {
+            filter->count++;
+            return true;
+        }
+    }
+
+    // Keep the homeless fingerprint so no earlier key is lost; the filter is now full.
+    filter->has_victim = true;
+    filter->victim_fingerprint = fp;
+    filter->victim_bucket = bucket;
+    filter->count++;
+    return true;
+}
+
+static bool victim_matches(const dsalib_cuckoo_filter_t* filter, uint16_t fp, size_t i1, size_t i2) {
+    return filter->has_victim && filter->victim_fingerprint == fp &&
+           (filter->victim_bucket == i1 || filter->victim_bucket == i2);
+}
+
+bool dsalib_cuckoo_filter_contains(const dsalib_cuckoo_filter_t* filter, int key) {
+    if (!filter) return false;
+    uint64_t hash = dsalib_hash_int(key);
+    uint16_t fp = fingerprint_of(filter, hash);
+    size_t i1 = (size_t)hash & (filter->num_buckets - 1);
+    size_t i2 = alt_bucket(filter, i1, fp);
+    return match_lanes(filter->buckets[i1], fp) || match_lanes(filter->buckets[i2], fp) ||
+           victim_matches(filter, fp, i1, i2);
+}
+
+bool dsalib_cuckoo_filter_remove(dsalib_cuckoo_filter_t* filter, int key) {
+    if (!filter) return false;
+    uint64_t hash = dsalib_hash_int(key);
+    uint16_t fp = fingerprint_of(filter, hash);
+    size_t i1 = (size_t)hash & (filter->num_buckets - 1);
+    size_t i2 = alt_bucket(filter, i1, fp);
+
+    if (victim_matches(filter, fp, i1, i2)) {
+        filter->has_victim = false;
+        filter->count--;
+        return true;
+    }
+    if (!try_remove(&filter->buckets[i1], fp) && !try_remove(&filter->buckets[i2], fp)) return false;
+    filter->count--;
+
+    // A slot is free again: try to re-home the victim (it stays counted).
+    if (filter->has_victim) {
+        size_t bucket = filter->victim_bucket;
+        uint16_t victim = filter->victim_fingerprint;
+        if (try_place(&filter->buckets[bucket], victim) ||
+            try_place(&filter->buckets[alt_bucket(filter, bucket, victim)], victim)) {
+            filter->has_victim = false;
+        }
+    }
+    return true;
+}
+
+size_t dsalib_cuckoo_filter_contains_batch(const dsalib_cuckoo_filter_t* filter,
+                                           const int* keys,
+                                           size_t size,
+                                           bool* out) {
+    if (!filter || (size > 0 && !keys)) return 0;
+
+    size_t maybe = 0;
+    for (size_t i = 0; i < size; i++) {
+#if defined(__GNUC__)
+        if (i + PREFETCH_DISTANCE < size) {
+            uint64_t ahead = dsalib_hash_int(keys[i + PREFETCH_DISTANCE]);
+            size_t b1 = (size_t)ahead & (filter->num_buckets - 1);
+            __builtin_prefetch(&filter->buckets[b1]);
+            __builtin_prefetch(&filter->buckets[alt_bucket(filter, b1, fingerprint_of(filter, ahead))]);
+        }
+#endif
+        bool hit = dsalib_cuckoo_filter_contains(filter, keys[i]);
+        if (out) out[i] = hit;
+        maybe += hit;
+    }
+    return maybe;
+}
@@ -0,0 +1,494 @@
+#include "dsalib/containers/roaring.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define BITMAP_WORDS (65536 / 64)
+
+struct dsalib_roaring_container {
+    uint16_t* values;     // Sorted low 16 bits (array container), or NULL
+    uint64_t* bits;       // BITMAP_WORDS words (bitmap container), or NULL
+    uint32_t cardinality; // Values in the chunk
+    uint32_t capacity;    // Allocated entries of values
+};
+
+typedef dsalib_roaring_container_t container_t;
+
+static size_t popcount_bitmap(const uint64_t* bits) {
+    size_t count = 0;
+    for (size_t i = 0; i < BITMAP_WORDS; i++) {
+        count += (size_t)__builtin_popcountll(bits[i]);
+    }
+    return count;
+}
+
+static void container_free(container_t* c) {
+    free(c->values);
+    free(c->bits);
+    c->values = NULL;
+    c->bits = NULL;
+}
+
+/* Writes the values of a bitmap in ascending order; returns the count. */
+static size_t bitmap_extract(const uint64_t* bits, uint16_t* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < BITMAP_WORDS; i++) {
+        uint64_t w = bits[i];
+        while (w) {
+            out[n++] = (uint16_t)(i * 64 + (size_t)__builtin_ctzll(w));
+            w &= w - 1;
+        }
+    }
+    return n;
+}
+
+static bool array_to_bitmap(container_t* c) {
+    uint64_t* bits = calloc(BITMAP_WORDS, sizeof(uint64_t));
+    if (!bits) return false;
+    for (uint32_t i = 0; i < c->cardinality; i++) {
+        bits[c->values[i] / 64] |= (uint64_t)1 << (c->values[i] % 64);
+    }
+    free(c->values);
+    c->values = NULL;
+    c->capacity = 0;
+    c->bits = bits;
+    return true;
+}
+
+static bool bitmap_to_array(container_t* c) {
+    uint16_t* values = malloc((c->cardinality ? c->cardinality : 1) * sizeof(uint16_t));
+    if (!values) return false;
+    bitmap_extract(c->bits, values);
+    free(c->bits);
+    c->bits = NULL;
+    c->values = values;
+    c->capacity = c->cardinality;
+    return true;
+}
+
+/* Makes the representation match the cardinality (bitmap iff > ARRAY_MAX). */
+static bool container_normalize(container_t* c) {
+    if (c->bits && c->cardinality <= DSALIB_ROARING_ARRAY_MAX) return bitmap_to_array(c);
+    if (!c->bits && c->cardinality > DSALIB_ROARING_ARRAY_MAX) return array_to_bitmap(c);
+    return true;
+}
+
+/* First index in values[0, n) whose value is >= low. */
+static uint32_t array_lower_bound(const uint16_t* values, uint32_t n, uint16_t low) {
+    uint32_t lo = 0, hi = n;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (values[mid] < low) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static bool container_contains(const container_t* c, uint16_t low) {
+    if (c->bits) return (c->bits[low / 64] >> (low % 64)) & 1;
+    uint32_t pos = array_lower_bound(c->values, c->cardinality, low);
+    return pos < c->cardinality && c->values[pos] == low;
+}
+
+/* Returns 1 if added, 0 if already present, -1 on allocation failure. */
+static int container_add(container_t* c, uint16_t low) {
+    if (c->bits) {
+        uint64_t bit = (uint64_t)1 << (low % 64);
+        if (c->bits[low / 64] & bit) return 0;
+        c->bits[low / 64] |= bit;
+        c->cardinality++;
+        return 1;
+    }
+    uint32_t pos = array_lower_bound(c->values, c->cardinality, low);
+    if (pos < c->cardinality && c->values[pos] == low) return 0;
+    if (c->cardinality == DSALIB_ROARING_ARRAY_MAX) {
+        if (!array_to_bitmap(c)) return -1;
+        return container_add(c, low);
+    }
+    if (c->cardinality == c->capacity) {
+        uint32_t capacity = c->capacity ? c->capacity * 2 : 4;
+        if (capacity > DSALIB_ROARING_ARRAY_MAX) capacity = DSALIB_ROARING_ARRAY_MAX;
+        uint16_t* values = realloc(c->values, capacity * sizeof(uint16_t));
+        if (!values) return -1;
+        c->values = values;
+        c->capacity = capacity;
+    }
+    memmove(c->values + pos + 1, c->values + pos, (c->cardinality - pos) * sizeof(uint16_t));
+    c->values[pos] = low;
+    c->cardinality++;
+    return 1;
+}
+
+static bool container_remove(container_t* c, uint16_t low) {
+    if (c->bits) {
+        uint64_t bit = (uint64_t)1 << (low % 64);
+        if (!(c->bits[low / 64] & bit)) return false;
+        c->bits[low / 64] &= ~bit;
+        c->cardinality--;
+        // A failed conversion just leaves an oversized bitmap; still correct.
+        container_normalize(c);
+        return true;
+    }
+    uint32_t pos = array_lower_bound(c->values, c->cardinality, low);
+    if (pos == c->cardinality || c->values[pos] != low) return false;
+    memmove(c->values + pos, c->values + pos + 1, (c->cardinality - pos - 1) * sizeof(uint16_t));
+    c->cardinality--;
+    return true;
+}
+
+/* out = a ∩ b; out is empty on entry. */
+static bool container_and(const container_t* a, const container_t* b, container_t* out) {
+    if (a->bits && b->bits) {
+        out->bits = malloc(BITMAP_WORDS * sizeof(uint64_t));
+        if (!out->bits) return false;
+        for (size_t i = 0; i < BITMAP_WORDS; i++) {
+            out->bits[i] = a->bits[i] & b->bits[i];
+        }
+        out->cardinality = (uint32_t)popcount_bitmap(out->bits);
+        return container_normalize(out);
+    }
+    if (a->bits) {
+        const container_t* t = a;
+        a = b;
+        b = t;
+    }
+    // a is an array: the result is at most as large.
+    out->values = malloc((a->cardinality ? a->cardinality : 1) * sizeof(uint16_t));
+    if (!out->values) return false;
+    out->capacity = a->cardinality;
+    uint32_t n = 0;
+    if (b->bits) {
+        for (uint32_t i = 0; i < a->cardinality; i++) {
+            uint16_t v = a->values[i];
+            out->values[n] = v;
+            n += (b->bits[v / 64] >> (v % 64)) & 1;
+        }
+    } else {
+        uint32_t i = 0, j = 0;
+        while (i < a->cardinality && j < b->cardinality) {
+            if (a->values[i] < b->values[j]) {
+                i++;
+            } else if (a->values[i] > b->values[j]) {
+                j++;
+            } else {
+                out->values[n++] = a->values[i];
+                i++;
+                j++;
+            }
+        }
+    }
+    out->cardinality = n;
+    return true;
+}
+
+/* out = a ∪ b; out is empty on entry. */
+static bool container_or(const container_t* a, const container_t* b, container_t* out) {
+    if (!a->bits && !b->bits && a->cardinality + b->cardinality <= DSALIB_ROARING_ARRAY_MAX) {
+        uint32_t capacity = a->cardinality + b->cardinality;
+        out->values = malloc(capacity * sizeof(uint16_t));
+        if (!out->values) return false;
+        out->capacity = capacity;
+        uint32_t i = 0, j = 0, n = 0;
+        while (i < a->cardinality && j < b->cardinality) {
+            uint16_t x = a->values[i], y = b->values[j];
+            out->values[n++] = x < y ? x : y;
+            i += x <= y;
+            j += y <= x;
+        }
+        while (i < a->cardinality) out->values[n++] = a->values[i++];
+        while (j < b->cardinality) out->values[n++] = b->values[j++];
+        out->cardinality = n;
+        return true;
+    }
+    out->bits = calloc(BITMAP_WORDS, sizeof(uint64_t));
+    if (!out->bits) return false;
+    const container_t* inputs[2] = {a, b};
+    for (int k = 0; k < 2; k++) {
+        const container_t* c = inputs[k];
+        if (c->bits) {
+            for (size_t i = 0; i < BITMAP_WORDS; i++) {
+                out->bits[i] |= c->bits[i];
+            }
+        } else {
+            for (uint32_t i = 0; i < c->cardinality; i++) {
+                out->bits[c->values[i] / 64] |= (uint64_t)1 << (c->values[i] % 64);
+            }
+        }
+    }
+    out->cardinality = (uint32_t)popcount_bitmap(out->bits);
+    return container_normalize(out);
+}
+
+static bool container_copy(const container_t* c, container_t* out) {
+    out->cardinality = c->cardinality;
+    if (c->bits) {
+        out->bits = malloc(BITMAP_WORDS * sizeof(uint64_t));
+        if (!out->bits) return false;
+        memcpy(out->bits, c->bits, BITMAP_WORDS * sizeof(uint64_t));
+        return true;
+    }
+    out->values = malloc((c->cardinality ? c->cardinality : 1) * sizeof(uint16_t));
+    if (!out->values) return false;
+    memcpy(out->values, c->values, c->cardinality * sizeof(uint16_t));
+    out->capacity = c->cardinality;
+    return true;
+}
+
+/* First container index whose key is >= key. */
+static size_t key_lower_bound(const dsalib_roaring_t* set, uint16_t key) {
+    size_t lo = 0, hi = set->num_containers;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (set->keys[mid] < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static bool reserve(dsalib_roaring_t* set, size_t capacity) {
+    if (capacity <= set->capacity) return true;
+    size_t new_capacity = set->capacity ? set->capacity * 2 : 4;
+    if (new_capacity < capacity) new_capacity = capacity;
+    uint16_t* keys = realloc(set->keys, new_capacity * sizeof(uint16_t));
+    if (!keys) return false;
+    set->keys = keys;
+    container_t* containers = realloc(set->containers, new_capacity * sizeof(container_t));
+    if (!containers) return false;
+    set->containers = containers;
+    set->capacity = new_capacity;
+    return true;
+}
+
+/* Inserts an empty array container for key at pos. */
+static container_t* insert_container(dsalib_roaring_t* set, size_t pos, uint16_t key) {
+    if (!reserve(set, set->num_containers + 1)) return NULL;
+    size_t tail = set->num_containers - pos;
+    memmove(set->keys + pos + 1, set->keys + pos, tail * sizeof(uint16_t));
+    memmove(set->containers + pos + 1, set->containers + pos, tail * sizeof(container_t));
+    set->keys[pos] = key;
+    set->containers[pos] = (container_t){NULL, NULL, 0, 0};
+    set->num_containers++;
+    return &set->containers[pos];
+}
+
+static void remove_container(dsalib_roaring_t* set, size_t pos) {
+    container_free(&set->containers[pos]);
+    size_t tail = set->num_containers - pos - 1;
+    memmove(set->keys + pos, set->keys + pos + 1, tail * sizeof(uint16_t));
+    memmove(set->containers + pos, set->containers + pos + 1, tail * sizeof(container_t));
+    set->num_containers--;
+}
+
+/* Appends c (taking ownership) unless it is empty. */
+static bool append_container(dsalib_roaring_t* set, uint16_t key, container_t* c) {
+    if (c->cardinality == 0) {
+        container_free(c);
+        return true;
+    }
+    if (!reserve(set, set->num_containers + 1)) {
+        container_free(c);
+        return false;
+    }
+    set->keys[set->num_containers] = key;
+    set->containers[set->num_containers++] = *c;
+    set->cardinality += c->cardinality;
+    return true;
+}
+
+dsalib_roaring_t* dsalib_roaring_create(void) {
+    dsalib_roaring_t* set = malloc(sizeof(dsalib_roaring_t));
+    if (!set) return NULL;
+    set->keys = NULL;
+    set->containers = NULL;
+    set->num_containers = 0;
+    set->capacity = 0;
+    set->cardinality = 0;
+    return set;
+}
+
+dsalib_roaring_t* dsalib_roaring_from_array(const int* arr, size_t size) {
+    if (!arr && size > 0) return NULL;
+    for (size_t i = 0; i < size; i++) {
+        if (arr[i] < 0 || (i > 0 && arr[i] < arr[i - 1])) return NULL;
+    }
+    dsalib_roaring_t* set = dsalib_roaring_create();
+    if (!set) return NULL;
+    size_t i = 0;
+    while (i < size) {
+        uint16_t key = (uint16_t)((uint32_t)arr[i] >> 16);
+        size_t end = i;
+        uint32_t distinct = 0;
+        while (end < size && (uint32_t)arr[end] >> 16 == key) {
+            distinct += end == i || arr[end] != arr[end - 1];
+            end++;
+        }
+        container_t c = {NULL, NULL, distinct, 0};
+        if (distinct > DSALIB_ROARING_ARRAY_MAX) {
+            c.bits = calloc(BITMAP_WORDS, sizeof(uint64_t));
+            if (c.bits) {
+                for (size_t j = i; j < end; j++) {
+                    uint16_t low = (uint16_t)arr[j];
+                    c.bits[low / 64] |= (uint64_t)1 << (low % 64);
+                }
+            }
+        } else {
+            c.values = malloc(distinct * sizeof(uint16_t));
+            c.capacity = distinct;
+            if (c.values) {
+                uint32_t n = 0;
+                for (size_t j = i; j < end; j++) {
+                    if (j == i || arr[j] != arr[j - 1]) c.values[n++] = (uint16_t)arr[j];
+                }
+            }
+        }
+        if ((!c.bits && !c.values) || !append_container(set, key, &c)) {
+            dsalib_roaring_destroy(set);
+            return NULL;
+        }
+        i = end;
+    }
+    return set;
+}
+
+void dsalib_roaring_destroy(dsalib_roaring_t* set) {
+    if (!set) return;
+    for (size_t i = 0; i < set->num_containers; i++) {
+        container_free(&set->containers[i]);
+    }
+    free(set->keys);
+    free(set->containers);
+    free(set);
+}
+
+bool dsalib_roaring_add(dsalib_roaring_t* set, int value) {
+    if (!set || value < 0) return false;
+    uint16_t key = (uint16_t)((uint32_t)value >> 16);
+    size_t pos = key_lower_bound(set, key);
+    container_t* c;
+    if (pos < set->num_containers && set->keys[pos] == key) {
+        c = &set->containers[pos];
+    } else {
+        c = insert_container(set, pos, key);
+        if (!c) return false;
+    }
+    int added = container_add(c, (uint16_t)value);
+    if (added < 0 && c->cardinality == 0) remove_container(set, pos);
+    if (added <= 0) return false;
+    set->cardinality++;
+    return true;
+}
+
+bool dsalib_roaring_remove(dsalib_roaring_t* set, int value) {
+    if (!set || value < 0) return false;
+    uint16_t key = (uint16_t)((uint32_t)value >> 16);
+    size_t pos = key_lower_bound(set, key);
+    if (pos == set->num_containers || set->keys[pos] != key) return false;
+    if (!container_remove(&set->containers[pos], (uint16_t)value)) return false;
+    if (set->containers[pos].cardinality == 0) remove_container(set, pos);
+    set->cardinality--;
+    return true;
+}
+
+bool dsalib_roaring_contains(const dsalib_roaring_t* set, int value) {
+    if (!set || value < 0) return false;
+    uint16_t key = (uint16_t)((uint32_t)value >> 16);
+    size_t pos = key_lower_bound(set, key);
+    if (pos == set->num_containers || set->keys[pos] != key) return false;
+    return container_contains(&set->containers[pos], (uint16_t)value);
+}
+
+size_t dsalib_roaring_cardinality(const dsalib_roaring_t* set) {
+    return set ? set->cardinality : 0;
+}
+
+size_t dsalib_roaring_memory(const dsalib_roaring_t* set) {
+    if (!set) return 0;
+    size_t bytes = sizeof(dsalib_roaring_t) + set->capacity * (sizeof(uint16_t) + sizeof(container_t));
+    for (size_t i = 0; i < set->num_containers; i++) {
+        const container_t* c = &set->containers[i];
+        bytes += c->bits ? BITMAP_WORDS * sizeof(uint64_t) : c->capacity * sizeof(uint16_t);
+    }
+    return bytes;
+}
+
+dsalib_roaring_t* dsalib_roaring_and(const dsalib_roaring_t* a, const dsalib_roaring_t* b) {
+    if (!a || !b) return NULL;
+    dsalib_roaring_t* out = dsalib_roaring_create();
+    if (!out) return NULL;
+    size_t i = 0, j = 0;
+    while (i < a->num_containers && j < b->num_containers) {
+        if (a->keys[i] < b->keys[j]) {
+            i++;
+        } else if (a->keys[i] > b->keys[j]) {
+            j++;
+        } else {
+            container_t c = {NULL, NULL, 0, 0};
+            if (!container_and(&a->containers[i], &b->containers[j], &c) ||
+                !append_container(out, a->keys[i], &c)) {
+                container_free(&c);
+                dsalib_roaring_destroy(out);
+                return NULL;
+            }
+            i++;
+            j++;
+        }
+    }
+    return out;
+}
+
+dsalib_roaring_t* dsalib_roaring_or(const dsalib_roaring_t* a, const dsalib_roaring_t* b) {
+    if (!a || !b) return NULL;
+    dsalib_roaring_t* out = dsalib_roaring_create();
+    if (!out) return NULL;
+    size_t i = 0, j = 0;
+    while (i < a->num_containers || j < b->num_containers) {
+        container_t c = {NULL, NULL, 0, 0};
+        uint16_t key;
+        bool ok;
+        if (j == b->num_containers || (i < a->num_containers && a->keys[i] < b->keys[j])) {
+            key = a->keys[i];
+            ok = container_copy(&a->containers[i++], &c);
+        } else if (i == a->num_containers || b->keys[j] < a->keys[i]) {
+            key = b->keys[j];
+            ok = container_copy(&b->containers[j++], &c);
+        } else {
+            key = a->keys[i];
+            ok = container_or(&a->containers[i++], &b->containers[j++], &c);
+        }
+        if (!ok || !append_container(out, key, &c)) {
+            container_free(&c);
+            dsalib_roaring_destroy(out);
+            return NULL;
+        }
+    }
+    return out;
+}
+
+size_t dsalib_roaring_to_array(const dsalib_roaring_t* set, int* out) {
+    if (!set || !out) return 0;
+    size_t n = 0;
+    for (size_t i = 0; i < set->num_containers; i++) {
+        const container_t* c = &set->containers[i];
+        int high = (int)set->keys[i] << 16;
+        if (c->bits) {
+            for (size_t w = 0; w < BITMAP_WORDS; w++) {
+                uint64_t word = c->bits[w];
+                while (word) {
+                    out[n++] = high | (int)(w * 64 + (size_t)__builtin_ctzll(word));
+                    word &= word - 1;
+                }
+            }
+        } else {
+            for (uint32_t k = 0; k < c->cardinality; k++) {
+                out[n++] = high | c->values[k];
+            }
+        }
+    }
+    return n;
+}
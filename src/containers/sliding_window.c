@@ -0,0 +1,228 @@
+#include "dsalib/containers/sliding_window.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Windows up to this length take the direct shifted-load path. */
+#define SMALL_WINDOW 8
+
+dsalib_sliding_window_t* dsalib_sliding_window_create(size_t window) {
+    if (window == 0 || window > UINT32_MAX) return NULL;
+
+    size_t capacity = 1;
+    while (capacity < window) capacity <<= 1;
+
+    dsalib_sliding_window_t* w = malloc(sizeof(dsalib_sliding_window_t));
+    if (!w) return NULL;
+    w->values = malloc(capacity * sizeof(int));
+    w->min_queue = malloc(capacity * sizeof(size_t));
+    w->max_queue = malloc(capacity * sizeof(size_t));
+    if (!w->values || !w->min_queue || !w->max_queue) {
+        dsalib_sliding_window_destroy(w);
+        return NULL;
+    }
+    w->mask = capacity - 1;
+    w->window = window;
+    dsalib_sliding_window_reset(w);
+    return w;
+}
+
+void dsalib_sliding_window_destroy(dsalib_sliding_window_t* w) {
+    if (!w) return;
+    free(w->values);
+    free(w->min_queue);
+    free(w->max_queue);
+    free(w);
+}
+
+void dsalib_sliding_window_reset(dsalib_sliding_window_t* w) {
+    if (!w) return;
+    w->pushed = 0;
+    w->min_head = 0;
+    w->min_tail = 0;
+    w->max_head = 0;
+    w->max_tail = 0;
+    w->sum = 0;
+}
+
+bool dsalib_sliding_window_push(dsalib_sliding_window_t* w, int value) {
+    if (!w) return false;
+    size_t position = w->pushed;
+    size_t mask = w->mask;
+
+    // Evict the value falling out before its ring slot can be reused.
+    if (position >= w->window) {
+        size_t expired = position - w->window;
+        w->sum -= w->values[expired & mask];
+        if (w->min_queue[w->min_head & mask] == expired) w->min_head++;
+        if (w->max_queue[w->max_head & mask] == expired) w->max_head++;
+    }
+    w->values[position & mask] = value;
+    w->sum += value;
+
+    while (w->min_tail != w->min_head && w->values[w->min_queue[(w->min_tail - 1) & mask] & mask] >= value) {
+        w->min_tail--;
+    }
+    w->min_queue[w->min_tail++ & mask] = position;
+    while (w->max_tail != w->max_head && w->values[w->max_queue[(w->max_tail - 1) & mask] & mask] <= value) {
+        w->max_tail--;
+    }
+    w->max_queue[w->max_tail++ & mask] = position;
+
+    w->pushed++;
+    return true;
+}
+
+size_t dsalib_sliding_window_count(const dsalib_sliding_window_t* w) {
+    if (!w) return 0;
+    return w->pushed < w->window ? w->pushed : w->window;
+}
+
+bool dsalib_sliding_window_min(const dsalib_sliding_window_t* w, int* min) {
+    if (!w || !min || w->pushed == 0) return false;
+    *min = w->values[w->min_queue[w->min_head & w->mask] & w->mask];
+    return true;
+}
+
+bool dsalib_sliding_window_max(const dsalib_sliding_window_t* w, int* max) {
+    if (!w || !max || w->pushed == 0) return false;
+    *max = w->values[w->max_queue[w->max_head & w->mask] & w->mask];
+    return true;
+}
+
+long long dsalib_sliding_window_sum(const dsalib_sliding_window_t* w) {
+    return w ? w->sum : 0;
+}
+
+bool dsalib_sliding_window_sum_int(const dsalib_sliding_window_t* w, int* sum) {
+    if (!w || !sum) return false;
+    if (w->sum > INT_MAX) {
+        *sum = INT_MAX;
+        return false;
+    }
+    if (w->sum < INT_MIN) {
+        *sum = INT_MIN;
+        return false;
+    }
+    *sum = (int)w->sum;
+    return true;
+}
+
+/* ---- Whole-array windows ---- */
+
+static inline int pick(int a, int b, bool want_max) {
+    return want_max ? (a > b ? a : b) : (a < b ? a : b);
+}
+
+#if defined(__SSE2__)
+/* Lane-wise min or max; SSE2 has no 32-bit signed min/max instruction. */
+static inline __m128i pick_epi32(__m128i a, __m128i b, bool want_max) {
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    if (want_max) return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+}
+#endif
+
+/* out[i] = pick over arr[i .. i+window) by combining window shifted loads. */
+static inline void small_window(const int* arr, size_t count, size_t window, int* out, bool want_max) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 4 <= count; i += 4) {
+        __m128i best = _mm_loadu_si128((const __m128i*)(arr + i));
+        for (size_t j = 1; j < window; j++) {
+            best = pick_epi32(best, _mm_loadu_si128((const __m128i*)(arr + i + j)), want_max);
+        }
+        _mm_storeu_si128((__m128i*)(out + i), best);
+    }
+#endif
+    for (; i < count; i++) {
+        int best = arr[i];
+        for (size_t j = 1; j < window; j++) {
+            best = pick(best, arr[i + j], want_max);
+        }
+        out[i] = best;
+    }
+}
+
+/*
+ * van Herk/Gil-Werman: for the block starting at s, suffix[j] covers
+ * arr[s+j .. s+window) and prefix[j] covers arr[s+window .. s+window+j], so
+ * the window starting at s+j (j > 0) is suffix[j] combined with
+ * prefix[j-1].
+ */
+static inline bool large_window(const int* arr, size_t n, size_t window, int* out, bool want_max) {
+    int* scratch = malloc(2 * window * sizeof(int));
+    if (!scratch) return false;
+    int* suffix = scratch;
+    int* prefix = scratch + window;
+    size_t count = n - window + 1;
+
+    for (size_t s = 0; s < count; s += window) {
+        suffix[window - 1] = arr[s + window - 1];
+        for (size_t j = window - 1; j-- > 0;) {
+            suffix[j] = pick(arr[s + j], suffix[j + 1], want_max);
+        }
+        out[s] = suffix[0];
+
+        // Only outputs s+1 .. s+window-1 below count need the next block.
+        size_t outputs = count - s < window ? count - s : window;
+        if (outputs < 2) continue;
+        const int* next = arr + s + window;
+        prefix[0] = next[0];
+        for (size_t j = 1; j + 1 < outputs; j++) {
+            prefix[j] = pick(prefix[j - 1], next[j], want_max);
+        }
+
+        size_t j = 1;
+#if defined(__SSE2__)
+        for (; j + 4 <= outputs; j += 4) {
+            __m128i a = _mm_loadu_si128((const __m128i*)(suffix + j));
+            __m128i b = _mm_loadu_si128((const __m128i*)(prefix + j - 1));
+            _mm_storeu_si128((__m128i*)(out + s + j), pick_epi32(a, b, want_max));
+        }
+#endif
+        for (; j < outputs; j++) {
+            out[s + j] = pick(suffix[j], prefix[j - 1], want_max);
+        }
+    }
+
+    free(scratch);
+    return true;
+}
+
+static inline size_t sliding_extreme(const int* arr, size_t n, size_t window, int* out, bool want_max) {
+    if (!arr || !out || window == 0 || window > n) return 0;
+    size_t count = n - window + 1;
+    if (window <= SMALL_WINDOW) {
+        small_window(arr, count, window, out, want_max);
+        return count;
+    }
+    return large_window(arr, n, window, out, want_max) ? count : 0;
+}
+
+size_t dsalib_sliding_min(const int* arr, size_t n, size_t window, int* out) {
+    return sliding_extreme(arr, n, window, out, false);
+}
+
+size_t dsalib_sliding_max(const int* arr, size_t n, size_t window, int* out) {
+    return sliding_extreme(arr, n, window, out, true);
+}
+
+size_t dsalib_sliding_sum(const int* arr, size_t n, size_t window, long long* out) {
+    if (!arr || !out || window == 0 || window > n) return 0;
+    long long sum = 0;
+    for (size_t i = 0; i < window; i++) {
+        sum += arr[i];
+    }
+    out[0] = sum;
+    for (size_t i = window; i < n; i++) {
+        sum += (long long)arr[i] - arr[i - window];
+        out[i - window + 1] = sum;
+    }
+    return n - window + 1;
+}
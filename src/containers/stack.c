@@ -16,6 +16,10 @@ dsalib_stack_t* dsalib_stack_create(size_t initial_capacity) {
     }
     
     stack->data = malloc(initial_capacity*sizeof(int));
+    if (!stack->data) {
+        free(stack);
+        return NULL;
+    }
     stack->size = 0;
     stack->capacity = initial_capacity;
     return stack;
@@ -23,7 +27,7 @@ dsalib_stack_t* dsalib_stack_create(size_t initial_capacity) {
 
 
 void dsalib_stack_destroy(dsalib_stack_t* stack) {
-    if(!stack || stack->size == 0 || !stack->data) return;
+    if(!stack) return;
     free(stack->data);
     free(stack);
 }
@@ -0,0 +1,331 @@
+#include "dsalib/containers/timer_wheel.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define NIL UINT32_MAX
+#define SLOT_BITS 8
+#define SLOT_MASK (DSALIB_TIMER_WHEEL_SLOTS - 1)
+#define NUM_SLOTS (DSALIB_TIMER_WHEEL_LEVELS * DSALIB_TIMER_WHEEL_SLOTS)
+#define WORDS (DSALIB_TIMER_WHEEL_SLOTS / 64)
+#define NO_SLOT UINT16_MAX
+#define MIN_CAPACITY 64
+#define BLOCK_ITEMS 14
+
+struct dsalib_timer_node {
+    uint64_t expires;
+    void* data;
+    uint32_t block;      // Block holding this timer; free-list link when unused
+    uint32_t generation; // Bumped on release; never 0
+    uint16_t slot;       // level * DSALIB_TIMER_WHEEL_SLOTS + index, or NO_SLOT
+    uint8_t pos;         // Position in block
+};
+
+/*
+ * One cache line. Only the newest block of a slot may be partly filled;
+ * the older ones are full.
+ */
+struct dsalib_timer_block {
+    uint32_t next;               // Next older block of the slot; free-list link
+    uint32_t count;              // Used entries of items
+    uint32_t items[BLOCK_ITEMS]; // Node indices
+};
+
+static inline dsalib_timer_id_t make_id(uint32_t index, uint32_t generation) {
+    return (uint64_t)generation << 32 | index;
+}
+
+/* Threads nodes [from, to) onto the free list. */
+static void add_free_nodes(dsalib_timer_wheel_t* wheel, size_t from, size_t to) {
+    for (size_t i = to; i-- > from;) {
+        wheel->nodes[i].generation = 1;
+        wheel->nodes[i].slot = NO_SLOT;
+        wheel->nodes[i].block = wheel->free_list;
+        wheel->free_list = (uint32_t)i;
+    }
+}
+
+static void add_free_blocks(dsalib_timer_wheel_t* wheel, size_t from, size_t to) {
+    for (size_t i = to; i-- > from;) {
+        wheel->blocks[i].next = wheel->free_blocks;
+        wheel->free_blocks = (uint32_t)i;
+    }
+}
+
+/*
+ * Blocks needed in the worst case: one partial block per slot, the full
+ * ones, and one more held by a slot that is being cascaded.
+ */
+static size_t blocks_needed(size_t count) {
+    return NUM_SLOTS + count / BLOCK_ITEMS + 2;
+}
+
+/* Resizes the block pool, keeping blocks cache-line aligned. */
+static bool resize_blocks(dsalib_timer_wheel_t* wheel, size_t num_blocks) {
+    dsalib_timer_block_t* blocks = aligned_alloc(64, num_blocks * sizeof(dsalib_timer_block_t));
+    if (!blocks) return false;
+    if (wheel->blocks) memcpy(blocks, wheel->blocks, wheel->num_blocks * sizeof(dsalib_timer_block_t));
+    free(wheel->blocks);
+    wheel->blocks = blocks;
+    add_free_blocks(wheel, wheel->num_blocks, num_blocks);
+    wheel->num_blocks = num_blocks;
+    return true;
+}
+
+/* Makes room for one more pending timer, so that advance never allocates. */
+static bool reserve(dsalib_timer_wheel_t* wheel) {
+    if (wheel->free_list == NIL) {
+        size_t capacity = wheel->capacity * 2;
+        if (capacity >= NIL) return false;
+        dsalib_timer_node_t* nodes = realloc(wheel->nodes, capacity * sizeof(dsalib_timer_node_t));
+        if (!nodes) return false;
+        wheel->nodes = nodes;
+        add_free_nodes(wheel, wheel->capacity, capacity);
+        wheel->capacity = capacity;
+    }
+    if (wheel->num_blocks < blocks_needed(wheel->count + 1)) {
+        return resize_blocks(wheel, wheel->num_blocks * 2);
+    }
+    return true;
+}
+
+static inline void set_occupied(dsalib_timer_wheel_t* wheel, size_t slot, bool occupied) {
+    uint64_t bit = (uint64_t)1 << (slot % 64);
+    if (occupied) {
+        wheel->occupied[slot / 64] |= bit;
+    } else {
+        wheel->occupied[slot / 64] &= ~bit;
+    }
+}
+
+/* Appends a node to a slot; reserve() guarantees a free block. */
+static void push(dsalib_timer_wheel_t* wheel, size_t slot, uint32_t index) {
+    uint32_t head = wheel->slots[slot];
+    if (head == NIL || wheel->blocks[head].count == BLOCK_ITEMS) {
+        uint32_t fresh = wheel->free_blocks;
+        wheel->free_blocks = wheel->blocks[fresh].next;
+        wheel->blocks[fresh].next = head;
+        wheel->blocks[fresh].count = 0;
+        wheel->slots[slot] = fresh;
+        if (head == NIL) set_occupied(wheel, slot, true);
+        head = fresh;
+    }
+    dsalib_timer_block_t* block = &wheel->blocks[head];
+    dsalib_timer_node_t* node = &wheel->nodes[index];
+    node->slot = (uint16_t)slot;
+    node->block = head;
+    node->pos = (uint8_t)block->count;
+    block->items[block->count++] = index;
+}
+
+/* Returns the newest block of a slot, which must be empty, to the pool. */
+static void pop_empty_block(dsalib_timer_wheel_t* wheel, size_t slot) {
+    uint32_t head = wheel->slots[slot];
+    wheel->slots[slot] = wheel->blocks[head].next;
+    wheel->blocks[head].next = wheel->free_blocks;
+    wheel->free_blocks = head;
+    if (wheel->slots[slot] == NIL) set_occupied(wheel, slot, false);
+}
+
+/* Removes a node from its slot by moving the slot's last index into the hole. */
+static void remove_node(dsalib_timer_wheel_t* wheel, uint32_t index) {
+    dsalib_timer_node_t* node = &wheel->nodes[index];
+    size_t slot = node->slot;
+    dsalib_timer_block_t* head = &wheel->blocks[wheel->slots[slot]];
+    uint32_t last = head->items[--head->count];
+    if (last != index) {
+        wheel->blocks[node->block].items[node->pos] = last;
+        wheel->nodes[last].block = node->block;
+        wheel->nodes[last].pos = node->pos;
+    }
+    if (head->count == 0) pop_empty_block(wheel, slot);
+}
+
+/* Adds a node to the coarsest wheel its distance from now needs. */
+static void place(dsalib_timer_wheel_t* wheel, uint32_t index) {
+    uint64_t expires = wheel->nodes[index].expires;
+    uint64_t delta = expires - wheel->now;
+    size_t level = 0;
+    while (level < DSALIB_TIMER_WHEEL_LEVELS - 1 && delta >> (SLOT_BITS * (level + 1))) {
+        level++;
+    }
+    if (delta >> (SLOT_BITS * DSALIB_TIMER_WHEEL_LEVELS)) {
+        // Beyond the last wheel: park in its farthest slot and re-place later.
+        expires = wheel->now + ((uint64_t)1 << (SLOT_BITS * DSALIB_TIMER_WHEEL_LEVELS)) - 1;
+    }
+    size_t slot = (expires >> (SLOT_BITS * level)) & SLOT_MASK;
+    push(wheel, level * DSALIB_TIMER_WHEEL_SLOTS + slot, index);
+}
+
+static void release(dsalib_timer_wheel_t* wheel, uint32_t index) {
+    dsalib_timer_node_t* node = &wheel->nodes[index];
+    node->slot = NO_SLOT;
+    node->generation = node->generation + 1 ? node->generation + 1 : 1;
+    node->block = wheel->free_list;
+    wheel->free_list = index;
+    wheel->count--;
+}
+
+dsalib_timer_wheel_t* dsalib_timer_wheel_create(uint64_t now, size_t initial_capacity) {
+    size_t capacity = MIN_CAPACITY;
+    while (capacity < initial_capacity && capacity < NIL / 2) capacity <<= 1;
+    size_t num_blocks = 1;
+    while (num_blocks < blocks_needed(capacity)) num_blocks <<= 1;
+
+    dsalib_timer_wheel_t* wheel = malloc(sizeof(dsalib_timer_wheel_t));
+    if (!wheel) return NULL;
+    wheel->capacity = capacity;
+    wheel->count = 0;
+    wheel->free_list = NIL;
+    wheel->blocks = NULL;
+    wheel->num_blocks = 0;
+    wheel->free_blocks = NIL;
+    wheel->now = now;
+    wheel->nodes = malloc(capacity * sizeof(dsalib_timer_node_t));
+    if (!wheel->nodes || !resize_blocks(wheel, num_blocks)) {
+        dsalib_timer_wheel_destroy(wheel);
+        return NULL;
+    }
+    add_free_nodes(wheel, 0, capacity);
+    for (size_t i = 0; i < NUM_SLOTS; i++) {
+        wheel->slots[i] = NIL;
+    }
+    for (size_t i = 0; i < NUM_SLOTS / 64; i++) {
+        wheel->occupied[i] = 0;
+    }
+    return wheel;
+}
+
+void dsalib_timer_wheel_destroy(dsalib_timer_wheel_t* wheel) {
+    if (!wheel) return;
+    free(wheel->nodes);
+    free(wheel->blocks);
+    free(wheel);
+}
+
+dsalib_timer_id_t dsalib_timer_wheel_schedule(dsalib_timer_wheel_t* wheel, uint64_t expires, void* data) {
+    if (!wheel || !reserve(wheel)) return 0;
+    uint32_t index = wheel->free_list;
+    dsalib_timer_node_t* node = &wheel->nodes[index];
+    wheel->free_list = node->block;
+    node->expires = expires > wheel->now ? expires : wheel->now + 1;
+    node->data = data;
+    place(wheel, index);
+    wheel->count++;
+    return make_id(index, node->generation);
+}
+
+bool dsalib_timer_wheel_cancel(dsalib_timer_wheel_t* wheel, dsalib_timer_id_t timer) {
+    if (!wheel) return false;
+    uint32_t index = (uint32_t)timer;
+    if (index >= wheel->capacity) return false;
+    dsalib_timer_node_t* node = &wheel->nodes[index];
+    if (node->slot == NO_SLOT || node->generation != (uint32_t)(timer >> 32)) return false;
+    remove_node(wheel, index);
+    release(wheel, index);
+    return true;
+}
+
+/* Re-places every timer of one slot of a coarser wheel; returns the slot index. */
+static size_t cascade(dsalib_timer_wheel_t* wheel, size_t level) {
+    size_t index = (wheel->now >> (SLOT_BITS * level)) & SLOT_MASK;
+    size_t slot = level * DSALIB_TIMER_WHEEL_SLOTS + index;
+    // Nothing cascades back into the slot being emptied, so it is walked
+    // in place and handed back block by block.
+    while (wheel->slots[slot] != NIL) {
+        dsalib_timer_block_t* block = &wheel->blocks[wheel->slots[slot]];
+        for (uint32_t i = 0; i < block->count; i++) {
+            __builtin_prefetch(&wheel->nodes[block->items[i]]);
+        }
+        for (uint32_t i = 0; i < block->count; i++) {
+            place(wheel, block->items[i]);
+        }
+        block->count = 0;
+        pop_empty_block(wheel, slot);
+    }
+    return index;
+}
+
+/* Fires every timer of a slot of the finest wheel. */
+static size_t fire(dsalib_timer_wheel_t* wheel, size_t slot, dsalib_timer_fn fn, void* ctx) {
+    size_t fired = 0;
+    uint32_t prefetched = NIL;
+    while (wheel->slots[slot] != NIL) {
+        uint32_t head = wheel->slots[slot];
+        dsalib_timer_block_t* block = &wheel->blocks[head];
+        if (head != prefetched) {
+            for (uint32_t i = 0; i < block->count; i++) {
+                __builtin_prefetch(&wheel->nodes[block->items[i]]);
+            }
+            prefetched = head;
+        }
+        // Pop one at a time so the callback may cancel timers of this slot.
+        uint32_t index = block->items[--block->count];
+        if (block->count == 0) pop_empty_block(wheel, slot);
+        void* data = wheel->nodes[index].data;
+        dsalib_timer_id_t id = make_id(index, wheel->nodes[index].generation);
+        release(wheel, index);
+        fired++;
+        if (fn) fn(ctx, id, data);
+    }
+    return fired;
+}
+
+/*
+ * Distance from slot `from` to the first occupied slot of one wheel, going
+ * around the ring, or DSALIB_TIMER_WHEEL_SLOTS if the wheel is empty.
+ */
+static size_t next_occupied(const uint64_t* words, size_t from) {
+    size_t scanned = 0;
+    while (scanned < DSALIB_TIMER_WHEEL_SLOTS) {
+        size_t pos = (from + scanned) & SLOT_MASK;
+        uint64_t bits = words[pos / 64] >> (pos % 64);
+        if (bits) {
+            size_t distance = scanned + (size_t)__builtin_ctzll(bits);
+            return distance < DSALIB_TIMER_WHEEL_SLOTS ? distance : DSALIB_TIMER_WHEEL_SLOTS;
+        }
+        scanned += 64 - pos % 64;
+    }
+    return DSALIB_TIMER_WHEEL_SLOTS;
+}
+
+/*
+ * Next tick that fires a slot of the finest wheel or cascades an occupied
+ * slot of a coarser one; every tick before it is a no-op and is skipped.
+ */
+static uint64_t next_event(const dsalib_timer_wheel_t* wheel) {
+    uint64_t next = UINT64_MAX;
+    for (size_t level = 0; level < DSALIB_TIMER_WHEEL_LEVELS; level++) {
+        size_t shift = SLOT_BITS * level;
+        uint64_t base = (wheel->now >> shift) + 1;
+        size_t distance = next_occupied(&wheel->occupied[level * WORDS], base & SLOT_MASK);
+        if (distance < DSALIB_TIMER_WHEEL_SLOTS && ((base + distance) << shift) < next) {
+            next = (base + distance) << shift;
+        }
+    }
+    return next;
+}
+
+size_t dsalib_timer_wheel_advance(dsalib_timer_wheel_t* wheel, uint64_t now, dsalib_timer_fn fn, void* ctx) {
+    if (!wheel) return 0;
+    size_t fired = 0;
+    while (wheel->now < now) {
+        uint64_t next = wheel->count ? next_event(wheel) : UINT64_MAX;
+        if (next > now) {
+            wheel->now = now;
+            break;
+        }
+        wheel->now = next;
+        size_t index = wheel->now & SLOT_MASK;
+        if (index == 0) {
+            size_t level = 1;
+            while (level < DSALIB_TIMER_WHEEL_LEVELS && cascade(wheel, level) == 0) level++;
+        }
+        fired += fire(wheel, index, fn, ctx);
+    }
+    return fired;
+}
+
+size_t dsalib_timer_wheel_size(const dsalib_timer_wheel_t* wheel) {
+    return wheel ? wheel->count : 0;
+}
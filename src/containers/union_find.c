@@ -0,0 +1,243 @@
+#include "dsalib/containers/union_find.h"
+
+#include "dsalib/util/parallel.h"
+
+#include <stdlib.h>
+
+static bool valid_count(size_t count) {
+    return count > 0 && count <= UINT32_MAX;
+}
+
+dsalib_union_find_t* dsalib_union_find_create(size_t count) {
+    if (!valid_count(count)) return NULL;
+
+    dsalib_union_find_t* uf = malloc(sizeof(dsalib_union_find_t));
+    if (!uf) return NULL;
+
+    uf->parent = malloc(count * sizeof(uint32_t));
+    uf->size = malloc(count * sizeof(uint32_t));
+    if (!uf->parent || !uf->size) {
+        free(uf->parent);
+        free(uf->size);
+        free(uf);
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uf->parent[i] = (uint32_t)i;
+        uf->size[i] = 1;
+    }
+    uf->count = count;
+    uf->sets = count;
+    return uf;
+}
+
+void dsalib_union_find_destroy(dsalib_union_find_t* uf) {
+    if (!uf) return;
+    free(uf->parent);
+    free(uf->size);
+    free(uf);
+}
+
+static uint32_t find_root(uint32_t* parent, uint32_t x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+size_t dsalib_union_find_find(dsalib_union_find_t* uf, size_t x) {
+    if (!uf || x >= uf->count) return SIZE_MAX;
+    return find_root(uf->parent, (uint32_t)x);
+}
+
+bool dsalib_union_find_union(dsalib_union_find_t* uf, size_t x, size_t y) {
+    if (!uf || x >= uf->count || y >= uf->count) return false;
+
+    uint32_t rx = find_root(uf->parent, (uint32_t)x);
+    uint32_t ry = find_root(uf->parent, (uint32_t)y);
+    if (rx == ry) return false;
+
+    if (uf->size[rx] < uf->size[ry]) {
+        uint32_t tmp = rx;
+        rx = ry;
+        ry = tmp;
+    }
+    uf->parent[ry] = rx;
+    uf->size[rx] += uf->size[ry];
+    uf->sets--;
+    return true;
+}
+
+bool dsalib_union_find_connected(dsalib_union_find_t* uf, size_t x, size_t y) {
+    if (!uf || x >= uf->count || y >= uf->count) return false;
+    return find_root(uf->parent, (uint32_t)x) == find_root(uf->parent, (uint32_t)y);
+}
+
+size_t dsalib_union_find_set_size(dsalib_union_find_t* uf, size_t x) {
+    if (!uf || x >= uf->count) return 0;
+    return uf->size[find_root(uf->parent, (uint32_t)x)];
+}
+
+size_t dsalib_union_find_count_sets(const dsalib_union_find_t* uf) {
+    if (!uf) return 0;
+    return uf->sets;
+}
+
+/*
+ * Fixed pseudo-random link priority (a 32-bit integer hash). Ties cannot
+ * happen between different roots because the index breaks them.
+ */
+static uint32_t link_priority(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+static bool links_below(uint32_t x, uint32_t y) {
+    uint32_t px = link_priority(x);
+    uint32_t py = link_priority(y);
+    return px < py || (px == py && x < y);
+}
+
+/*
+ * Parent pointers always lead to strictly higher priority, so concurrent
+ * halving and linking can never create a cycle.
+ */
+static uint32_t concurrent_find_root(_Atomic uint32_t* parent, uint32_t x) {
+    for (;;) {
+        uint32_t p = atomic_load_explicit(&parent[x], memory_order_relaxed);
+        if (p == x) return x;
+        uint32_t gp = atomic_load_explicit(&parent[p], memory_order_relaxed);
+        if (gp != p) {
+            atomic_compare_exchange_weak_explicit(&parent[x], &p, gp, memory_order_relaxed, memory_order_relaxed);
+        }
+        x = gp;
+    }
+}
+
+dsalib_concurrent_union_find_t* dsalib_concurrent_union_find_create(size_t count) {
+    if (!valid_count(count)) return NULL;
+
+    dsalib_concurrent_union_find_t* uf = malloc(sizeof(dsalib_concurrent_union_find_t));
+    if (!uf) return NULL;
+
+    uf->parent = malloc(count * sizeof(_Atomic uint32_t));
+    if (!uf->parent) {
+        free(uf);
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        atomic_init(&uf->parent[i], (uint32_t)i);
+    }
+    uf->count = count;
+    atomic_init(&uf->sets, count);
+    return uf;
+}
+
+void dsalib_concurrent_union_find_destroy(dsalib_concurrent_union_find_t* uf) {
+    if (!uf) return;
+    free((void*)uf->parent);
+    free(uf);
+}
+
+size_t dsalib_concurrent_union_find_find(dsalib_concurrent_union_find_t* uf, size_t x) {
+    if (!uf || x >= uf->count) return SIZE_MAX;
+    return concurrent_find_root(uf->parent, (uint32_t)x);
+}
+
+bool dsalib_concurrent_union_find_union(dsalib_concurrent_union_find_t* uf, size_t x, size_t y) {
+    if (!uf || x >= uf->count || y >= uf->count) return false;
+
+    uint32_t rx = (uint32_t)x;
+    uint32_t ry = (uint32_t)y;
+    for (;;) {
+        rx = concurrent_find_root(uf->parent, rx);
+        ry = concurrent_find_root(uf->parent, ry);
+        if (rx == ry) return false;
+        if (links_below(rx, ry)) {
+            uint32_t tmp = rx;
+            rx = ry;
+            ry = tmp;
+        }
+        // Link ry below rx, but only if ry is still a root.
+        uint32_t expected = ry;
+        if (atomic_compare_exchange_strong_explicit(
+                &uf->parent[ry], &expected, rx, memory_order_acq_rel, memory_order_relaxed)) {
+            atomic_fetch_sub_explicit(&uf->sets, 1, memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+bool dsalib_concurrent_union_find_connected(dsalib_concurrent_union_find_t* uf, size_t x, size_t y) {
+    if (!uf || x >= uf->count || y >= uf->count) return false;
+
+    uint32_t rx = (uint32_t)x;
+    uint32_t ry = (uint32_t)y;
+    for (;;) {
+        rx = concurrent_find_root(uf->parent, rx);
+        ry = concurrent_find_root(uf->parent, ry);
+        if (rx == ry) return true;
+        // If rx is still a root, the two sets were disjoint at this instant.
+        if (atomic_load_explicit(&uf->parent[rx], memory_order_acquire) == rx) return false;
+    }
+}
+
+size_t dsalib_concurrent_union_find_count_sets(const dsalib_concurrent_union_find_t* uf) {
+    if (!uf) return 0;
+    return atomic_load_explicit(&uf->sets, memory_order_relaxed);
+}
+
+typedef struct {
+    dsalib_concurrent_union_find_t* uf;
+    const dsalib_edge_t* edges;
+    uint32_t* labels;
+} edge_job_t;
+
+static void union_edge_chunk(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    edge_job_t* job = ctx;
+    for (size_t i = begin; i < end; i++) {
+        dsalib_concurrent_union_find_union(job->uf, job->edges[i].u, job->edges[i].v);
+    }
+}
+
+static void label_chunk(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    edge_job_t* job = ctx;
+    for (size_t i = begin; i < end; i++) {
+        job->labels[i] = concurrent_find_root(job->uf->parent, (uint32_t)i);
+    }
+}
+
+bool dsalib_concurrent_union_find_union_edges(dsalib_concurrent_union_find_t* uf,
+                                              const dsalib_edge_t* edges,
+                                              size_t num_edges,
+                                              size_t num_threads) {
+    if (!uf || (num_edges && !edges)) return false;
+    edge_job_t job = {uf, edges, NULL};
+    return dsalib_parallel_for(num_edges, num_threads, union_edge_chunk, &job);
+}
+
+size_t dsalib_connected_components(size_t count,
+                                   const dsalib_edge_t* edges,
+                                   size_t num_edges,
+                                   size_t num_threads,
+                                   uint32_t* labels) {
+    if (!labels || (num_edges && !edges)) return 0;
+
+    dsalib_concurrent_union_find_t* uf = dsalib_concurrent_union_find_create(count);
+    if (!uf) return 0;
+
+    edge_job_t job = {uf, edges, labels};
+    dsalib_parallel_for(num_edges, num_threads, union_edge_chunk, &job);
+    dsalib_parallel_for(count, num_threads, label_chunk, &job);
+
+    size_t components = dsalib_concurrent_union_find_count_sets(uf);
+    dsalib_concurrent_union_find_destroy(uf);
+    return components;
+}
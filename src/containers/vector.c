@@ -0,0 +1,213 @@
+#include "dsalib/containers/vector.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MIN_HEAP_CAPACITY 4
+
+static size_t inline_capacity(const dsalib_vector_t* vec) {
+    return DSALIB_VECTOR_INLINE_BYTES / vec->elem_size;
+}
+
+static unsigned char* storage(dsalib_vector_t* vec) {
+    return vec->heap ? vec->heap : vec->inline_data;
+}
+
+/* Moves the elements to a heap buffer of exactly capacity elements. */
+static bool set_heap_capacity(dsalib_vector_t* vec, size_t capacity) {
+    if (capacity > SIZE_MAX / vec->elem_size) return false;
+    if (vec->heap) {
+        void* grown = realloc(vec->heap, capacity * vec->elem_size);
+        if (!grown) return false;
+        vec->heap = grown;
+    } else {
+        void* heap = malloc(capacity * vec->elem_size);
+        if (!heap) return false;
+        memcpy(heap, vec->inline_data, vec->size * vec->elem_size);
+        vec->heap = heap;
+    }
+    vec->capacity = capacity;
+    return true;
+}
+
+/* Grows by the vector's policy, but to at least needed elements. */
+static bool grow(dsalib_vector_t* vec, size_t needed) {
+    size_t capacity = vec->capacity;
+    if (vec->growth == DSALIB_VECTOR_GROW_1_5X) {
+        capacity = capacity <= SIZE_MAX - capacity / 2 ? capacity + capacity / 2 : SIZE_MAX;
+    } else {
+        capacity = capacity <= SIZE_MAX / 2 ? capacity * 2 : SIZE_MAX;
+    }
+    if (capacity < needed) capacity = needed;
+    if (capacity < MIN_HEAP_CAPACITY) capacity = MIN_HEAP_CAPACITY;
+    return set_heap_capacity(vec, capacity);
+}
+
+bool dsalib_vector_init(dsalib_vector_t* vec, size_t elem_size, dsalib_vector_growth_t growth) {
+    if (!vec || elem_size == 0) return false;
+    vec->heap = NULL;
+    vec->size = 0;
+    vec->elem_size = elem_size;
+    vec->growth = growth;
+    vec->capacity = inline_capacity(vec);
+    return true;
+}
+
+void dsalib_vector_release(dsalib_vector_t* vec) {
+    if (!vec) return;
+    free(vec->heap);
+    vec->heap = NULL;
+    vec->size = 0;
+    vec->capacity = inline_capacity(vec);
+}
+
+dsalib_vector_t* dsalib_vector_create(size_t elem_size, dsalib_vector_growth_t growth) {
+    if (elem_size == 0) return NULL;
+    dsalib_vector_t* vec = malloc(sizeof(dsalib_vector_t));
+    if (!vec) return NULL;
+    dsalib_vector_init(vec, elem_size, growth);
+    return vec;
+}
+
+void dsalib_vector_destroy(dsalib_vector_t* vec) {
+    if (!vec) return;
+    free(vec->heap);
+    free(vec);
+}
+
+size_t dsalib_vector_size(const dsalib_vector_t* vec) {
+    if (!vec) return 0;
+    return vec->size;
+}
+
+size_t dsalib_vector_capacity(const dsalib_vector_t* vec) {
+    if (!vec) return 0;
+    return vec->capacity;
+}
+
+bool dsalib_vector_is_inline(const dsalib_vector_t* vec) {
+    return vec && !vec->heap;
+}
+
+void* dsalib_vector_data(dsalib_vector_t* vec) {
+    if (!vec) return NULL;
+    return storage(vec);
+}
+
+void* dsalib_vector_at(dsalib_vector_t* vec, size_t index) {
+    if (!vec || index >= vec->size) return NULL;
+    return storage(vec) + index * vec->elem_size;
+}
+
+bool dsalib_vector_reserve(dsalib_vector_t* vec, size_t capacity) {
+    if (!vec) return false;
+    if (capacity <= vec->capacity) return true;
+    return set_heap_capacity(vec, capacity);
+}
+
+bool dsalib_vector_shrink_to_fit(dsalib_vector_t* vec) {
+    if (!vec) return false;
+    if (!vec->heap) return true;
+    if (vec->size <= inline_capacity(vec)) {
+        memcpy(vec->inline_data, vec->heap, vec->size * vec->elem_size);
+        free(vec->heap);
+        vec->heap = NULL;
+        vec->capacity = inline_capacity(vec);
+        return true;
+    }
+    if (vec->size == vec->capacity) return true;
+    return set_heap_capacity(vec, vec->size);
+}
+
+void dsalib_vector_clear(dsalib_vector_t* vec) {
+    if (!vec) return;
+    vec->size = 0;
+}
+
+bool dsalib_vector_push_back(dsalib_vector_t* vec, const void* elem) {
+    if (!vec || !elem) return false;
+    if (vec->size == vec->capacity && !grow(vec, vec->size + 1)) return false;
+    memcpy(storage(vec) + vec->size * vec->elem_size, elem, vec->elem_size);
+    vec->size++;
+    return true;
+}
+
+bool dsalib_vector_pop_back(dsalib_vector_t* vec, void* out) {
+    if (!vec || vec->size == 0) return false;
+    vec->size--;
+    if (out) memcpy(out, storage(vec) + vec->size * vec->elem_size, vec->elem_size);
+    return true;
+}
+
+bool dsalib_vector_insert(dsalib_vector_t* vec, size_t index, const void* elems, size_t count) {
+    if (!vec || index > vec->size) return false;
+    if (count == 0) return true;
+    if (!elems || count > SIZE_MAX - vec->size) return false;
+    if (vec->size + count > vec->capacity && !grow(vec, vec->size + count)) return false;
+
+    unsigned char* data = storage(vec);
+    size_t width = vec->elem_size;
+    memmove(data + (index + count) * width, data + index * width, (vec->size - index) * width);
+    memcpy(data + index * width, elems, count * width);
+    vec->size += count;
+    return true;
+}
+
+bool dsalib_vector_erase(dsalib_vector_t* vec, size_t index, size_t count) {
+    if (!vec || index > vec->size || count > vec->size - index) return false;
+
+    unsigned char* data = storage(vec);
+    size_t width = vec->elem_size;
+    memmove(data + index * width, data + (index + count) * width, (vec->size - index - count) * width);
+    vec->size -= count;
+    return true;
+}
+
+bool dsalib_vector_swap_remove(dsalib_vector_t* vec, size_t index, void* out) {
+    if (!vec || index >= vec->size) return false;
+
+    unsigned char* data = storage(vec);
+    size_t width = vec->elem_size;
+    if (out) memcpy(out, data + index * width, width);
+    vec->size--;
+    if (index != vec->size) memcpy(data + index * width, data + vec->size * width, width);
+    return true;
+}
+
+bool dsalib_vector_adopt(dsalib_vector_t* vec, void* buffer, size_t size, size_t capacity) {
+    if (!vec || !buffer || capacity == 0 || size > capacity) return false;
+    free(vec->heap);
+    vec->heap = buffer;
+    vec->size = size;
+    vec->capacity = capacity;
+    return true;
+}
+
+void* dsalib_vector_detach(dsalib_vector_t* vec, size_t* size, size_t* capacity) {
+    if (!vec || vec->size == 0) return NULL;
+
+    void* buffer = vec->heap;
+    size_t buffer_capacity = vec->capacity;
+    if (!buffer) {
+        buffer = malloc(vec->size * vec->elem_size);
+        if (!buffer) return NULL;
+        memcpy(buffer, vec->inline_data, vec->size * vec->elem_size);
+        buffer_capacity = vec->size;
+    }
+    if (size) *size = vec->size;
+    if (capacity) *capacity = buffer_capacity;
+
+    vec->heap = NULL;
+    vec->size = 0;
+    vec->capacity = inline_capacity(vec);
+    return buffer;
+}
+
+bool dsalib_vector_swap(dsalib_vector_t* a, dsalib_vector_t* b) {
+    if (!a || !b || a->elem_size != b->elem_size) return false;
+    dsalib_vector_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+    return true;
+}
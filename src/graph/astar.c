@@ -0,0 +1,412 @@
+#include "dsalib/graph/astar.h"
+
+#include <limits.h>
+#include <stdlib.h>
+
+#define CLOSED UINT32_MAX
+
+enum { HEURISTIC_NONE, HEURISTIC_MANHATTAN, HEURISTIC_OCTILE, HEURISTIC_CALLBACK };
+
+typedef struct {
+    long long dist;    // Best known cost from the side's origin
+    long long h;       // Heuristic to the goal, computed on first touch
+    uint32_t stamp;    // Generation that last touched the record
+    uint32_t parent;   // Predecessor on the best known path
+    uint32_t heap_pos; // Position in the heap, or CLOSED once expanded
+} search_node_t;
+
+typedef struct {
+    long long f;   // dist + h
+    uint32_t h;    // h clamped to 32 bits, breaks ties on f
+    uint32_t node; // Node id
+} heap_entry_t;
+
+struct dsalib_search_side {
+    search_node_t* nodes; // capacity records
+    heap_entry_t* heap;   // 4-ary min-heap of open nodes
+    size_t heap_size;     // Open nodes
+};
+
+/* What a search runs on; kind selects the inline heuristic. */
+typedef struct {
+    const dsalib_grid_t* grid;
+    const dsalib_csr_graph_t* graph;
+    const int* weights;
+    int kind;
+    dsalib_heuristic_fn heuristic;
+    void* ctx;
+    uint32_t goal;
+} problem_t;
+
+static const int DX[8] = {1, -1, 0, 0, 1, 1, -1, -1};
+static const int DY[8] = {0, 0, 1, -1, 1, -1, 1, -1};
+
+static inline long long heuristic(const problem_t* p, uint32_t node) {
+    switch (p->kind) {
+    case HEURISTIC_NONE: return 0;
+    case HEURISTIC_CALLBACK: return p->heuristic(p->ctx, node, p->goal);
+    default: break;
+    }
+    uint32_t w = p->grid->width;
+    long long dx = llabs((long long)(node % w) - (long long)(p->goal % w));
+    long long dy = llabs((long long)(node / w) - (long long)(p->goal / w));
+    if (p->kind == HEURISTIC_MANHATTAN) return DSALIB_GRID_COST_STRAIGHT * (dx + dy);
+    long long lo = dx < dy ? dx : dy;
+    long long hi = dx < dy ? dy : dx;
+    return DSALIB_GRID_COST_STRAIGHT * hi + (DSALIB_GRID_COST_DIAGONAL - DSALIB_GRID_COST_STRAIGHT) * lo;
+}
+
+long long dsalib_heuristic_manhattan(void* ctx, uint32_t node, uint32_t goal) {
+    if (!ctx) return 0;
+    problem_t p = {ctx, NULL, NULL, HEURISTIC_MANHATTAN, NULL, NULL, goal};
+    return heuristic(&p, node);
+}
+
+long long dsalib_heuristic_octile(void* ctx, uint32_t node, uint32_t goal) {
+    if (!ctx) return 0;
+    problem_t p = {ctx, NULL, NULL, HEURISTIC_OCTILE, NULL, NULL, goal};
+    return heuristic(&p, node);
+}
+
+static inline bool entry_less(heap_entry_t a, heap_entry_t b) {
+    return a.f < b.f || (a.f == b.f && a.h < b.h);
+}
+
+static void sift_up(dsalib_search_side_t* side, size_t i) {
+    heap_entry_t entry = side->heap[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / 4;
+        if (!entry_less(entry, side->heap[parent])) break;
+        side->heap[i] = side->heap[parent];
+        side->nodes[side->heap[i].node].heap_pos = (uint32_t)i;
+        i = parent;
+    }
+    side->heap[i] = entry;
+    side->nodes[entry.node].heap_pos = (uint32_t)i;
+}
+
+static void sift_down(dsalib_search_side_t* side, size_t i) {
+    heap_entry_t entry = side->heap[i];
+    size_t n = side->heap_size;
+    for (;;) {
+        size_t first = 4 * i + 1;
+        if (first >= n) break;
+        size_t last = first + 4 < n ? first + 4 : n;
+        size_t best = first;
+        for (size_t c = first + 1; c < last; c++) {
+            if (entry_less(side->heap[c], side->heap[best])) best = c;
+        }
+        if (!entry_less(side->heap[best], entry)) break;
+        side->heap[i] = side->heap[best];
+        side->nodes[side->heap[i].node].heap_pos = (uint32_t)i;
+        i = best;
+    }
+    side->heap[i] = entry;
+    side->nodes[entry.node].heap_pos = (uint32_t)i;
+}
+
+static uint32_t pop(dsalib_search_side_t* side) {
+    uint32_t node = side->heap[0].node;
+    side->nodes[node].heap_pos = CLOSED;
+    if (--side->heap_size > 0) {
+        side->heap[0] = side->heap[side->heap_size];
+        sift_down(side, 0);
+    }
+    return node;
+}
+
+/* Offers dist via parent to node; pushes, reopens or decreases its key. */
+static inline void relax(dsalib_search_side_t* side, uint32_t generation, const problem_t* p,
+                         uint32_t node, uint32_t parent, long long dist) {
+    search_node_t* record = &side->nodes[node];
+    size_t pos;
+    if (record->stamp != generation) {
+        record->stamp = generation;
+        record->h = heuristic(p, node);
+        pos = side->heap_size++;
+    } else if (dist < record->dist) {
+        pos = record->heap_pos == CLOSED ? side->heap_size++ : record->heap_pos;
+    } else {
+        return;
+    }
+    record->dist = dist;
+    record->parent = parent;
+    side->heap[pos] = (heap_entry_t){dist + record->h, record->h < UINT32_MAX ? (uint32_t)record->h : UINT32_MAX, node};
+    sift_up(side, pos);
+}
+
+static dsalib_search_side_t* side_create(size_t capacity) {
+    dsalib_search_side_t* side = malloc(sizeof(dsalib_search_side_t));
+    if (!side) return NULL;
+    side->nodes = calloc(capacity, sizeof(search_node_t));
+    side->heap = malloc(capacity * sizeof(heap_entry_t));
+    side->heap_size = 0;
+    if (!side->nodes || !side->heap) {
+        free(side->nodes);
+        free(side->heap);
+        free(side);
+        return NULL;
+    }
+    return side;
+}
+
+/* Starts a query: new generation, empty open sets. */
+static bool begin_query(dsalib_search_state_t* state, size_t num_nodes, uint32_t source, uint32_t target,
+                        bool bidirectional) {
+    if (num_nodes > state->capacity || source >= num_nodes || target >= num_nodes) return false;
+    if (bidirectional && !state->sides[1]) {
+        state->sides[1] = side_create(state->capacity);
+        if (!state->sides[1]) return false;
+    }
+    if (++state->generation == 0) {
+        // Wrapped: old stamps could now look current, so clear them once.
+        for (int s = 0; s < 2; s++) {
+            if (!state->sides[s]) continue;
+            for (size_t i = 0; i < state->capacity; i++) {
+                state->sides[s]->nodes[i].stamp = 0;
+            }
+        }
+        state->generation = 1;
+    }
+    state->sides[0]->heap_size = 0;
+    if (state->sides[1]) state->sides[1]->heap_size = 0;
+    state->source = source;
+    state->target = target;
+    state->meet = target;
+    state->bidirectional = bidirectional;
+    state->found = false;
+    state->expanded = 0;
+    return true;
+}
+
+/*
+ * Fills next/cost with the grid moves out of u, or the moves into u when
+ * backward (the cost is then that of entering u). Returns their number.
+ */
+static inline int grid_moves(const dsalib_grid_t* grid, uint32_t u, bool backward, uint32_t next[8], long long cost[8]) {
+    uint32_t w = grid->width;
+    long long x = u % w, y = u / w;
+    int moves = grid->diagonal ? 8 : 4;
+    int n = 0;
+    for (int d = 0; d < moves; d++) {
+        long long nx = x + DX[d], ny = y + DY[d];
+        if (nx < 0 || ny < 0 || nx >= w || ny >= grid->height) continue;
+        uint32_t v = (uint32_t)(ny * w + nx);
+        if (!grid->cells[v]) continue;
+        // No cutting corners: both cells beside a diagonal step must be open.
+        if (d >= 4 && (!grid->cells[y * w + nx] || !grid->cells[ny * w + x])) continue;
+        long long base = d < 4 ? DSALIB_GRID_COST_STRAIGHT : DSALIB_GRID_COST_DIAGONAL;
+        next[n] = v;
+        cost[n++] = base * grid->cells[backward ? u : v];
+    }
+    return n;
+}
+
+static long long astar(dsalib_search_state_t* state, const problem_t* p, uint32_t source, uint32_t target) {
+    dsalib_search_side_t* side = state->sides[0];
+    uint32_t generation = state->generation;
+    relax(side, generation, p, source, source, 0);
+    while (side->heap_size > 0) {
+        uint32_t u = pop(side);
+        state->expanded++;
+        long long dist = side->nodes[u].dist;
+        if (u == target) {
+            state->found = true;
+            return dist;
+        }
+        if (p->grid) {
+            uint32_t next[8];
+            long long cost[8];
+            int n = grid_moves(p->grid, u, false, next, cost);
+            for (int i = 0; i < n; i++) {
+                relax(side, generation, p, next[i], u, dist + cost[i]);
+            }
+        } else {
+            const dsalib_csr_graph_t* graph = p->graph;
+            for (size_t e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+                relax(side, generation, p, graph->targets[e], u, dist + (p->weights ? p->weights[e] : 1));
+            }
+        }
+    }
+    return DSALIB_SEARCH_UNREACHABLE;
+}
+
+dsalib_search_state_t* dsalib_search_state_create(size_t capacity) {
+    if (capacity == 0 || capacity > UINT32_MAX) return NULL;
+    dsalib_search_state_t* state = malloc(sizeof(dsalib_search_state_t));
+    if (!state) return NULL;
+    state->capacity = capacity;
+    state->generation = 0;
+    state->sides[0] = side_create(capacity);
+    state->sides[1] = NULL;
+    state->source = state->target = state->meet = 0;
+    state->bidirectional = false;
+    state->found = false;
+    state->expanded = 0;
+    if (!state->sides[0]) {
+        free(state);
+        return NULL;
+    }
+    return state;
+}
+
+void dsalib_search_state_destroy(dsalib_search_state_t* state) {
+    if (!state) return;
+    for (int s = 0; s < 2; s++) {
+        if (!state->sides[s]) continue;
+        free(state->sides[s]->nodes);
+        free(state->sides[s]->heap);
+        free(state->sides[s]);
+    }
+    free(state);
+}
+
+static bool grid_valid(const dsalib_grid_t* grid) {
+    return grid && grid->cells && grid->width > 0 && grid->height > 0 &&
+           (uint64_t)grid->width * grid->height <= UINT32_MAX;
+}
+
+long long dsalib_astar_grid(const dsalib_grid_t* grid,
+                            uint32_t source,
+                            uint32_t target,
+                            dsalib_heuristic_fn heuristic,
+                            void* ctx,
+                            dsalib_search_state_t* state) {
+    if (!grid_valid(grid) || !state) return DSALIB_SEARCH_UNREACHABLE;
+    if (!begin_query(state, (size_t)grid->width * grid->height, source, target, false)) return DSALIB_SEARCH_UNREACHABLE;
+    if (!grid->cells[source] || !grid->cells[target]) return DSALIB_SEARCH_UNREACHABLE;
+    problem_t p = {grid, NULL, NULL, HEURISTIC_CALLBACK, heuristic, ctx, target};
+    if (!heuristic) {
+        p.kind = HEURISTIC_NONE;
+    } else if (heuristic == dsalib_heuristic_manhattan) {
+        p.kind = HEURISTIC_MANHATTAN;
+    } else if (heuristic == dsalib_heuristic_octile) {
+        p.kind = HEURISTIC_OCTILE;
+    }
+    return astar(state, &p, source, target);
+}
+
+long long dsalib_astar_csr(const dsalib_csr_graph_t* graph,
+                           const int* weights,
+                           uint32_t source,
+                           uint32_t target,
+                           dsalib_heuristic_fn heuristic,
+                           void* ctx,
+                           dsalib_search_state_t* state) {
+    if (!graph || !state) return DSALIB_SEARCH_UNREACHABLE;
+    if (!begin_query(state, graph->num_nodes, source, target, false)) return DSALIB_SEARCH_UNREACHABLE;
+    problem_t p = {NULL, graph, weights, heuristic ? HEURISTIC_CALLBACK : HEURISTIC_NONE, heuristic, ctx, target};
+    return astar(state, &p, source, target);
+}
+
+/* Records v as the meeting node if the sides' paths through it beat best. */
+static inline void meet(dsalib_search_state_t* state, const search_node_t* mine, const search_node_t* other, uint32_t v,
+                        long long* best) {
+    if (other[v].stamp != state->generation) return;
+    long long total = mine[v].dist + other[v].dist;
+    if (total < *best) {
+        *best = total;
+        state->meet = v;
+    }
+}
+
+/*
+ * Shared loop of both bidirectional searches. problems[0] walks forward
+ * edges, problems[1] the reversed ones.
+ */
+static long long bidirectional(dsalib_search_state_t* state, const problem_t problems[2], uint32_t source, uint32_t target) {
+    dsalib_search_side_t* sides[2] = {state->sides[0], state->sides[1]};
+    uint32_t generation = state->generation;
+    relax(sides[0], generation, &problems[0], source, source, 0);
+    relax(sides[1], generation, &problems[1], target, target, 0);
+    long long best = source == target ? 0 : LLONG_MAX;
+    state->meet = source == target ? source : target;
+    while (sides[0]->heap_size > 0 && sides[1]->heap_size > 0) {
+        long long top0 = sides[0]->heap[0].f, top1 = sides[1]->heap[0].f;
+        if (top0 + top1 >= best) break;
+        int s = top0 <= top1 ? 0 : 1;
+        dsalib_search_side_t* side = sides[s];
+        const search_node_t* other = sides[1 - s]->nodes;
+        const problem_t* p = &problems[s];
+        uint32_t u = pop(side);
+        state->expanded++;
+        long long dist = side->nodes[u].dist;
+        if (p->grid) {
+            uint32_t next[8];
+            long long cost[8];
+            int n = grid_moves(p->grid, u, s == 1, next, cost);
+            for (int i = 0; i < n; i++) {
+                relax(side, generation, p, next[i], u, dist + cost[i]);
+                meet(state, side->nodes, other, next[i], &best);
+            }
+        } else {
+            const dsalib_csr_graph_t* graph = p->graph;
+            for (size_t e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+                uint32_t v = graph->targets[e];
+                relax(side, generation, p, v, u, dist + (p->weights ? p->weights[e] : 1));
+                meet(state, side->nodes, other, v, &best);
+            }
+        }
+    }
+    if (best == LLONG_MAX) return DSALIB_SEARCH_UNREACHABLE;
+    state->found = true;
+    return best;
+}
+
+long long dsalib_bidirectional_dijkstra_grid(const dsalib_grid_t* grid,
+                                             uint32_t source,
+                                             uint32_t target,
+                                             dsalib_search_state_t* state) {
+    if (!grid_valid(grid) || !state) return DSALIB_SEARCH_UNREACHABLE;
+    if (!begin_query(state, (size_t)grid->width * grid->height, source, target, true)) return DSALIB_SEARCH_UNREACHABLE;
+    if (!grid->cells[source] || !grid->cells[target]) return DSALIB_SEARCH_UNREACHABLE;
+    problem_t p = {grid, NULL, NULL, HEURISTIC_NONE, NULL, NULL, target};
+    problem_t problems[2] = {p, p};
+    return bidirectional(state, problems, source, target);
+}
+
+long long dsalib_bidirectional_dijkstra_csr(const dsalib_csr_graph_t* graph,
+                                            const int* weights,
+                                            const dsalib_csr_graph_t* reverse,
+                                            const int* reverse_weights,
+                                            uint32_t source,
+                                            uint32_t target,
+                                            dsalib_search_state_t* state) {
+    if (!graph || !state) return DSALIB_SEARCH_UNREACHABLE;
+    if (!reverse) {
+        reverse = graph;
+        reverse_weights = weights;
+    } else if (reverse->num_nodes != graph->num_nodes) {
+        return DSALIB_SEARCH_UNREACHABLE;
+    }
+    if (!begin_query(state, graph->num_nodes, source, target, true)) return DSALIB_SEARCH_UNREACHABLE;
+    problem_t problems[2] = {{NULL, graph, weights, HEURISTIC_NONE, NULL, NULL, target},
+                             {NULL, reverse, reverse_weights, HEURISTIC_NONE, NULL, NULL, source}};
+    return bidirectional(state, problems, source, target);
+}
+
+size_t dsalib_search_path(const dsalib_search_state_t* state, uint32_t* out) {
+    if (!state || !state->found) return 0;
+    const search_node_t* forward = state->sides[0]->nodes;
+    size_t head = 1;
+    for (uint32_t v = state->meet; v != state->source; v = forward[v].parent) head++;
+    size_t length = head;
+    const search_node_t* backward = state->bidirectional ? state->sides[1]->nodes : NULL;
+    if (backward) {
+        for (uint32_t v = state->meet; v != state->target; v = backward[v].parent) length++;
+    }
+    if (!out) return length;
+    size_t i = head;
+    for (uint32_t v = state->meet;; v = forward[v].parent) {
+        out[--i] = v;
+        if (v == state->source) break;
+    }
+    if (backward) {
+        i = head;
+        for (uint32_t v = state->meet; v != state->target;) {
+            v = backward[v].parent;
+            out[i++] = v;
+        }
+    }
+    return length;
+}
@@ -0,0 +1,95 @@
+#include "dsalib/graph/csr.h"
+
+#include <stdlib.h>
+
+dsalib_csr_graph_t* dsalib_csr_graph_create(size_t num_nodes, const dsalib_edge_t* edges, size_t num_edges) {
+    if (num_nodes == 0 || num_nodes > UINT32_MAX || (num_edges && !edges)) return NULL;
+    for (size_t i = 0; i < num_edges; i++) {
+        if (edges[i].u >= num_nodes || edges[i].v >= num_nodes) return NULL;
+    }
+
+    dsalib_csr_graph_t* graph = malloc(sizeof(dsalib_csr_graph_t));
+    if (!graph) return NULL;
+    graph->num_nodes = num_nodes;
+    graph->num_edges = num_edges;
+    graph->offsets = calloc(num_nodes + 1, sizeof(size_t));
+    graph->targets = malloc((num_edges ? num_edges : 1) * sizeof(uint32_t));
+    if (!graph->offsets || !graph->targets) {
+        dsalib_csr_graph_destroy(graph);
+        return NULL;
+    }
+
+    // Counting sort by source: count, prefix-sum, then place.
+    for (size_t i = 0; i < num_edges; i++) {
+        graph->offsets[edges[i].u + 1]++;
+    }
+    for (size_t u = 0; u < num_nodes; u++) {
+        graph->offsets[u + 1] += graph->offsets[u];
+    }
+    for (size_t i = 0; i < num_edges; i++) {
+        graph->targets[graph->offsets[edges[i].u]++] = edges[i].v;
+    }
+    // Placing advanced every offset to the next node's start; shift back.
+    for (size_t u = num_nodes; u > 0; u--) {
+        graph->offsets[u] = graph->offsets[u - 1];
+    }
+    graph->offsets[0] = 0;
+    return graph;
+}
+
+dsalib_csr_graph_t* dsalib_csr_graph_transpose(const dsalib_csr_graph_t* graph, const int* weights, int* transposed_weights) {
+    if (!graph || (weights && !transposed_weights)) return NULL;
+
+    size_t n = graph->num_nodes;
+    dsalib_csr_graph_t* reverse = malloc(sizeof(dsalib_csr_graph_t));
+    if (!reverse) return NULL;
+    reverse->num_nodes = n;
+    reverse->num_edges = graph->num_edges;
+    reverse->offsets = calloc(n + 1, sizeof(size_t));
+    reverse->targets = malloc((graph->num_edges ? graph->num_edges : 1) * sizeof(uint32_t));
+    if (!reverse->offsets || !reverse->targets) {
+        dsalib_csr_graph_destroy(reverse);
+        return NULL;
+    }
+
+    // Same counting sort as create, keyed by target instead of source.
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        reverse->offsets[graph->targets[e] + 1]++;
+    }
+    for (size_t v = 0; v < n; v++) {
+        reverse->offsets[v + 1] += reverse->offsets[v];
+    }
+    for (size_t u = 0; u < n; u++) {
+        for (size_t e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            size_t pos = reverse->offsets[graph->targets[e]]++;
+            reverse->targets[pos] = (uint32_t)u;
+            if (weights) transposed_weights[pos] = weights[e];
+        }
+    }
+    for (size_t v = n; v > 0; v--) {
+        reverse->offsets[v] = reverse->offsets[v - 1];
+    }
+    reverse->offsets[0] = 0;
+    return reverse;
+}
+
+void dsalib_csr_graph_destroy(dsalib_csr_graph_t* graph) {
+    if (!graph) return;
+    free(graph->offsets);
+    free(graph->targets);
+    free(graph);
+}
+
+size_t dsalib_csr_graph_out_degree(const dsalib_csr_graph_t* graph, size_t node) {
+    if (!graph || node >= graph->num_nodes) return 0;
+    return graph->offsets[node + 1] - graph->offsets[node];
+}
+
+const uint32_t* dsalib_csr_graph_successors(const dsalib_csr_graph_t* graph, size_t node, size_t* count) {
+    if (!graph || node >= graph->num_nodes) {
+        if (count) *count = 0;
+        return NULL;
+    }
+    if (count) *count = graph->offsets[node + 1] - graph->offsets[node];
+    return graph->targets + graph->offsets[node];
+}
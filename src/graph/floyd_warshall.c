@@ -0,0 +1,186 @@
+#include "dsalib/graph/floyd_warshall.h"
+
+#include "dsalib/math/add.h"
+#include "dsalib/util/parallel.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define INF DSALIB_FLOYD_WARSHALL_INF
+/* Tile edge in elements; a 64 x 64 int tile is 16 KB. */
+#define TILE 64
+/* Below this size the per-phase thread start-up costs more than it saves. */
+#define PARALLEL_MIN_N 256
+
+bool dsalib_floyd_warshall_init(int* dist, size_t n, const dsalib_weighted_edge_t* edges, size_t edge_count) {
+    if (!dist || (edge_count && !edges)) return false;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            dist[i * n + j] = i == j ? 0 : INF;
+        }
+    }
+    for (size_t e = 0; e < edge_count; e++) {
+        if (edges[e].u >= n || edges[e].v >= n) continue;
+        int* entry = &dist[edges[e].u * n + edges[e].v];
+        if (edges[e].weight < *entry) *entry = edges[e].weight;
+    }
+    return true;
+}
+
+static bool has_negative_cycle(const int* dist, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (dist[i * n + i] < 0) return true;
+    }
+    return false;
+}
+
+bool dsalib_floyd_warshall_naive(int* dist, size_t n) {
+    if (!dist) return false;
+    for (size_t k = 0; k < n; k++) {
+        for (size_t i = 0; i < n; i++) {
+            int through = dist[i * n + k];
+            if (through == INF) continue;
+            for (size_t j = 0; j < n; j++) {
+                int rest = dist[k * n + j];
+                if (rest == INF) continue;
+                int candidate = safe_add(through, rest);
+                if (candidate < dist[i * n + j]) dist[i * n + j] = candidate;
+            }
+        }
+    }
+    return !has_negative_cycle(dist, n);
+}
+
+#if defined(__SSE2__)
+/* SSE2 has no 32-bit signed min/max; select through a compare mask. */
+static inline __m128i min_epi32(__m128i a, __m128i b) {
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+}
+
+static inline __m128i max_epi32(__m128i a, __m128i b) {
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+}
+#endif
+
+/*
+ * row_i[j] = min(row_i[j], through + row_k[j]) for j in [begin, end).
+ *
+ * through is fixed for the whole row, so the saturating add reduces to a
+ * clamp of row_k[j] followed by a plain add: for through >= 0 clamping to
+ * INT_MAX - through also maps INF to INT_MAX (== INF), and for
+ * through < 0 INF entries are masked so they stay INF. The result equals
+ * safe_add(through, row_k[j]) whenever row_k[j] is finite.
+ */
+static void relax_row(int* row_i, const int* row_k, int through, size_t begin, size_t end) {
+    if (through == INF) return;
+    size_t j = begin;
+    if (through >= 0) {
+        int limit = INT_MAX - through;
+#if defined(__SSE2__)
+        const __m128i add = _mm_set1_epi32(through);
+        const __m128i clamp = _mm_set1_epi32(limit);
+        for (; j + 4 <= end; j += 4) {
+            __m128i rest = _mm_loadu_si128((const __m128i*)(row_k + j));
+            __m128i candidate = _mm_add_epi32(min_epi32(rest, clamp), add);
+            __m128i current = _mm_loadu_si128((const __m128i*)(row_i + j));
+            _mm_storeu_si128((__m128i*)(row_i + j), min_epi32(current, candidate));
+        }
+#endif
+        for (; j < end; j++) {
+            int candidate = (row_k[j] < limit ? row_k[j] : limit) + through;
+            if (candidate < row_i[j]) row_i[j] = candidate;
+        }
+    } else {
+        int floor = INT_MIN - through;
+#if defined(__SSE2__)
+        const __m128i add = _mm_set1_epi32(through);
+        const __m128i clamp = _mm_set1_epi32(floor);
+        const __m128i inf = _mm_set1_epi32(INF);
+        for (; j + 4 <= end; j += 4) {
+            __m128i rest = _mm_loadu_si128((const __m128i*)(row_k + j));
+            __m128i unreachable = _mm_cmpeq_epi32(rest, inf);
+            __m128i candidate = _mm_add_epi32(max_epi32(rest, clamp), add);
+            candidate = _mm_or_si128(_mm_andnot_si128(unreachable, candidate), _mm_and_si128(unreachable, inf));
+            __m128i current = _mm_loadu_si128((const __m128i*)(row_i + j));
+            _mm_storeu_si128((__m128i*)(row_i + j), min_epi32(current, candidate));
+        }
+#endif
+        for (; j < end; j++) {
+            if (row_k[j] == INF) continue;
+            int candidate = (row_k[j] > floor ? row_k[j] : floor) + through;
+            if (candidate < row_i[j]) row_i[j] = candidate;
+        }
+    }
+}
+
+typedef struct {
+    int* dist;
+    size_t n;
+    size_t tiles; // Tiles per matrix edge
+    size_t kb;    // Current diagonal tile
+} blocked_job_t;
+
+/*
+ * Relaxes tile (ib, jb) through the vertices of tile kb. k is the outer
+ * loop so the update stays correct when the tile is its own row or column
+ * source (phases one and two).
+ */
+static void relax_tile(const blocked_job_t* job, size_t ib, size_t jb) {
+    size_t n = job->n;
+    size_t i0 = ib * TILE, i1 = i0 + TILE < n ? i0 + TILE : n;
+    size_t j0 = jb * TILE, j1 = j0 + TILE < n ? j0 + TILE : n;
+    size_t k0 = job->kb * TILE, k1 = k0 + TILE < n ? k0 + TILE : n;
+    int* dist = job->dist;
+    for (size_t k = k0; k < k1; k++) {
+        const int* row_k = dist + k * n;
+        for (size_t i = i0; i < i1; i++) {
+            relax_row(dist + i * n, row_k, dist[i * n + k], j0, j1);
+        }
+    }
+}
+
+/* Phase two: item 2b is tile (kb, b), item 2b + 1 is tile (b, kb). */
+static void relax_cross(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    const blocked_job_t* job = ctx;
+    for (size_t item = begin; item < end; item++) {
+        size_t b = item / 2;
+        if (b == job->kb) continue;
+        if (item % 2 == 0) {
+            relax_tile(job, job->kb, b);
+        } else {
+            relax_tile(job, b, job->kb);
+        }
+    }
+}
+
+/* Phase three: item ib * tiles + jb, skipping row and column kb. */
+static void relax_rest(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    const blocked_job_t* job = ctx;
+    for (size_t item = begin; item < end; item++) {
+        size_t ib = item / job->tiles;
+        size_t jb = item % job->tiles;
+        if (ib == job->kb || jb == job->kb) continue;
+        relax_tile(job, ib, jb);
+    }
+}
+
+bool dsalib_floyd_warshall(int* dist, size_t n, size_t num_threads) {
+    if (!dist) return false;
+    if (num_threads == 0 || n < PARALLEL_MIN_N) num_threads = 1;
+
+    blocked_job_t job;
+    job.dist = dist;
+    job.n = n;
+    job.tiles = (n + TILE - 1) / TILE;
+    for (job.kb = 0; job.kb < job.tiles; job.kb++) {
+        relax_tile(&job, job.kb, job.kb);
+        dsalib_parallel_for(2 * job.tiles, num_threads, relax_cross, &job);
+        dsalib_parallel_for(job.tiles * job.tiles, num_threads, relax_rest, &job);
+    }
+    return !has_negative_cycle(dist, n);
+}
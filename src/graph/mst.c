@@ -0,0 +1,38 @@
+#include "dsalib/graph/mst.h"
+
+#include "dsalib/containers/union_find.h"
+
+#include <stdlib.h>
+
+static int compare_weight(const void* a, const void* b) {
+    int wa = ((const dsalib_weighted_edge_t*)a)->weight;
+    int wb = ((const dsalib_weighted_edge_t*)b)->weight;
+    return (wa > wb) - (wa < wb);
+}
+
+size_t dsalib_mst_kruskal(size_t vertex_count,
+                          dsalib_weighted_edge_t* edges,
+                          size_t edge_count,
+                          dsalib_weighted_edge_t* out,
+                          long long* total_weight) {
+    if (total_weight) *total_weight = 0;
+    if (!out || (edge_count && !edges)) return 0;
+
+    dsalib_union_find_t* uf = dsalib_union_find_create(vertex_count);
+    if (!uf) return 0;
+
+    if (edge_count > 0) qsort(edges, edge_count, sizeof(dsalib_weighted_edge_t), compare_weight);
+
+    size_t n = 0;
+    long long total = 0;
+    for (size_t i = 0; i < edge_count && n + 1 < vertex_count; i++) {
+        if (dsalib_union_find_union(uf, edges[i].u, edges[i].v)) {
+            out[n++] = edges[i];
+            total += edges[i].weight;
+        }
+    }
+
+    dsalib_union_find_destroy(uf);
+    if (total_weight) *total_weight = total;
+    return n;
+}
@@ -0,0 +1,269 @@
+#include "dsalib/graph/topo_sort.h"
+
+#include "dsalib/util/parallel.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Frontiers smaller than this per thread are expanded on the calling thread. */
+#define PARALLEL_GRAIN 2048
+/* Ready nodes a worker collects before publishing them in one step. */
+#define LOCAL_BUFFER 256
+
+size_t dsalib_topo_sort(const dsalib_csr_graph_t* graph, uint32_t* order) {
+    if (!graph || !order) return 0;
+
+    size_t n = graph->num_nodes;
+    uint32_t* in_degree = calloc(n, sizeof(uint32_t));
+    if (!in_degree) return 0;
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        in_degree[graph->targets[e]]++;
+    }
+
+    // order[head, tail) is the queue of ready nodes not yet expanded.
+    size_t tail = 0;
+    for (size_t u = 0; u < n; u++) {
+        if (in_degree[u] == 0) order[tail++] = (uint32_t)u;
+    }
+    for (size_t head = 0; head < tail; head++) {
+        uint32_t u = order[head];
+        for (size_t e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            uint32_t v = graph->targets[e];
+            if (--in_degree[v] == 0) order[tail++] = v;
+        }
+    }
+
+    free(in_degree);
+    return tail;
+}
+
+/* Atomic in-degree counters, initialized from the graph. */
+static _Atomic uint32_t* create_in_degrees(const dsalib_csr_graph_t* graph) {
+    uint32_t* counts = calloc(graph->num_nodes, sizeof(uint32_t));
+    _Atomic uint32_t* in_degree = malloc(graph->num_nodes * sizeof(_Atomic uint32_t));
+    if (!counts || !in_degree) {
+        free(counts);
+        free((void*)in_degree);
+        return NULL;
+    }
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        counts[graph->targets[e]]++;
+    }
+    for (size_t u = 0; u < graph->num_nodes; u++) {
+        atomic_init(&in_degree[u], counts[u]);
+    }
+    free(counts);
+    return in_degree;
+}
+
+typedef struct {
+    const dsalib_csr_graph_t* graph;
+    _Atomic uint32_t* in_degree;
+    uint32_t* order;
+    _Atomic size_t tail; // Next free slot in order
+    size_t base;         // Start of the frontier being expanded
+} level_job_t;
+
+typedef struct {
+    uint32_t items[LOCAL_BUFFER];
+    size_t count;
+} local_buffer_t;
+
+/* Reserves a block of order with one atomic add and copies the buffer there. */
+static void flush_ready(level_job_t* job, local_buffer_t* buffer) {
+    if (buffer->count == 0) return;
+    size_t position = atomic_fetch_add_explicit(&job->tail, buffer->count, memory_order_relaxed);
+    memcpy(job->order + position, buffer->items, buffer->count * sizeof(uint32_t));
+    buffer->count = 0;
+}
+
+static void expand_chunk(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    level_job_t* job = ctx;
+    const dsalib_csr_graph_t* graph = job->graph;
+    local_buffer_t buffer;
+    buffer.count = 0;
+
+    for (size_t i = begin; i < end; i++) {
+        uint32_t u = job->order[job->base + i];
+        for (size_t e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            uint32_t v = graph->targets[e];
+            // Exactly one thread sees the counter drop from 1 to 0.
+            if (atomic_fetch_sub_explicit(&job->in_degree[v], 1, memory_order_acq_rel) == 1) {
+                buffer.items[buffer.count++] = v;
+                if (buffer.count == LOCAL_BUFFER) flush_ready(job, &buffer);
+            }
+        }
+    }
+    flush_ready(job, &buffer);
+}
+
+static size_t threads_for(size_t items, size_t num_threads) {
+    size_t useful = items / PARALLEL_GRAIN;
+    if (useful < 1) useful = 1;
+    return useful < num_threads ? useful : num_threads;
+}
+
+size_t dsalib_topo_sort_parallel(const dsalib_csr_graph_t* graph,
+                                 size_t num_threads,
+                                 uint32_t* order,
+                                 size_t* num_levels) {
+    if (num_levels) *num_levels = 0;
+    if (!graph || !order) return 0;
+
+    level_job_t job;
+    job.graph = graph;
+    job.order = order;
+    job.base = 0;
+    job.in_degree = create_in_degrees(graph);
+    if (!job.in_degree) return 0;
+
+    size_t tail = 0;
+    for (size_t u = 0; u < graph->num_nodes; u++) {
+        if (atomic_load_explicit(&job.in_degree[u], memory_order_relaxed) == 0) order[tail++] = (uint32_t)u;
+    }
+    atomic_init(&job.tail, tail);
+
+    // order[base, end) is the current level; its successors land after end.
+    size_t levels = 0;
+    size_t end = tail;
+    while (job.base < end) {
+        size_t width = end - job.base;
+        dsalib_parallel_for(width, threads_for(width, num_threads), expand_chunk, &job);
+        levels++;
+        job.base = end;
+        end = atomic_load_explicit(&job.tail, memory_order_relaxed);
+    }
+
+    free((void*)job.in_degree);
+    if (num_levels) *num_levels = levels;
+    return end;
+}
+
+/* ---- DAG executor ---- */
+
+typedef struct {
+    const dsalib_csr_graph_t* graph;
+    dsalib_dag_task_fn task;
+    void* ctx;
+    _Atomic uint32_t* in_degree;
+    _Atomic size_t completed;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    uint32_t* ready; // ready[head, tail) are nodes waiting for a worker; guarded by lock
+    size_t head;
+    size_t tail;
+    size_t active; // Workers currently running a task; guarded by lock
+} executor_t;
+
+static void publish(executor_t* ex, const uint32_t* nodes, size_t count) {
+    if (count == 0) return;
+    pthread_mutex_lock(&ex->lock);
+    memcpy(ex->ready + ex->tail, nodes, count * sizeof(uint32_t));
+    ex->tail += count;
+    if (count == 1) {
+        pthread_cond_signal(&ex->wake);
+    } else {
+        pthread_cond_broadcast(&ex->wake);
+    }
+    pthread_mutex_unlock(&ex->lock);
+}
+
+/* Runs u and then, while it makes one ready, keeps going with a successor. */
+static void run_chain(executor_t* ex, uint32_t u) {
+    const dsalib_csr_graph_t* graph = ex->graph;
+    local_buffer_t buffer;
+    for (;;) {
+        ex->task(ex->ctx, u);
+        atomic_fetch_add_explicit(&ex->completed, 1, memory_order_relaxed);
+
+        bool has_next = false;
+        uint32_t next = 0;
+        buffer.count = 0;
+        for (size_t e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            uint32_t v = graph->targets[e];
+            if (atomic_fetch_sub_explicit(&ex->in_degree[v], 1, memory_order_acq_rel) != 1) continue;
+            if (!has_next) {
+                has_next = true;
+                next = v;
+                continue;
+            }
+            buffer.items[buffer.count++] = v;
+            if (buffer.count == LOCAL_BUFFER) {
+                publish(ex, buffer.items, buffer.count);
+                buffer.count = 0;
+            }
+        }
+        publish(ex, buffer.items, buffer.count);
+        if (!has_next) return;
+        u = next;
+    }
+}
+
+/*
+ * A worker sleeps only while another worker is running a task (which may
+ * produce more work), so a worker whose thread could not be started and
+ * runs late on the caller finds nothing to wait for and returns.
+ */
+static void executor_worker(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)begin;
+    (void)end;
+    (void)worker;
+    executor_t* ex = ctx;
+    for (;;) {
+        pthread_mutex_lock(&ex->lock);
+        while (ex->head == ex->tail && ex->active > 0) {
+            pthread_cond_wait(&ex->wake, &ex->lock);
+        }
+        if (ex->head == ex->tail) {
+            pthread_mutex_unlock(&ex->lock);
+            return;
+        }
+        uint32_t u = ex->ready[ex->head++];
+        ex->active++;
+        pthread_mutex_unlock(&ex->lock);
+
+        run_chain(ex, u);
+
+        pthread_mutex_lock(&ex->lock);
+        ex->active--;
+        if (ex->active == 0 && ex->head == ex->tail) pthread_cond_broadcast(&ex->wake);
+        pthread_mutex_unlock(&ex->lock);
+    }
+}
+
+bool dsalib_dag_execute(const dsalib_csr_graph_t* graph, size_t num_threads, dsalib_dag_task_fn task, void* ctx) {
+    if (!graph || !task) return false;
+    if (num_threads == 0) num_threads = 1;
+
+    executor_t ex;
+    ex.graph = graph;
+    ex.task = task;
+    ex.ctx = ctx;
+    ex.head = 0;
+    ex.tail = 0;
+    ex.active = 0;
+    atomic_init(&ex.completed, 0);
+    ex.in_degree = create_in_degrees(graph);
+    ex.ready = malloc(graph->num_nodes * sizeof(uint32_t));
+    if (!ex.in_degree || !ex.ready) {
+        free((void*)ex.in_degree);
+        free(ex.ready);
+        return false;
+    }
+    for (size_t u = 0; u < graph->num_nodes; u++) {
+        if (atomic_load_explicit(&ex.in_degree[u], memory_order_relaxed) == 0) ex.ready[ex.tail++] = (uint32_t)u;
+    }
+    pthread_mutex_init(&ex.lock, NULL);
+    pthread_cond_init(&ex.wake, NULL);
+
+    dsalib_parallel_for(num_threads, num_threads, executor_worker, &ex);
+
+    pthread_cond_destroy(&ex.wake);
+    pthread_mutex_destroy(&ex.lock);
+    free((void*)ex.in_degree);
+    free(ex.ready);
+    return atomic_load_explicit(&ex.completed, memory_order_relaxed) == graph->num_nodes;
+}
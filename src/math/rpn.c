@@ -0,0 +1,475 @@
+#include "dsalib/math/rpn.h"
+
+#include "dsalib/containers/vector.h"
+#include "dsalib/math/add.h"
+#include "dsalib/util/string_utils.h"
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ---- Arithmetic (saturating like safe_add()) ---- */
+
+static int clamp(long long value) {
+    if (value > INT_MAX) return INT_MAX;
+    if (value < INT_MIN) return INT_MIN;
+    return (int)value;
+}
+
+static int saturating_div(int a, int b) {
+    return (a == INT_MIN && b == -1) ? INT_MAX : a / b;
+}
+
+static int saturating_mod(int a, int b) {
+    return b == -1 ? 0 : a % b;
+}
+
+/* Applies binary op (DSALIB_RPN_ADD..MOD). Returns false on division by zero. */
+static bool apply_binary(int op, int a, int b, int* result) {
+    switch (op) {
+    case DSALIB_RPN_ADD:
+        *result = safe_add(a, b);
+        return true;
+    case DSALIB_RPN_SUB:
+        *result = clamp((long long)a - b);
+        return true;
+    case DSALIB_RPN_MUL:
+        *result = clamp((long long)a * b);
+        return true;
+    case DSALIB_RPN_DIV:
+        if (b == 0) return false;
+        *result = saturating_div(a, b);
+        return true;
+    case DSALIB_RPN_MOD:
+        if (b == 0) return false;
+        *result = saturating_mod(a, b);
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* ---- Lexer ---- */
+
+typedef enum { TOKEN_END, TOKEN_NUMBER, TOKEN_VAR, TOKEN_OP, TOKEN_LPAREN, TOKEN_RPAREN, TOKEN_ERROR } token_kind_t;
+
+typedef struct {
+    token_kind_t kind;
+    int value; // Literal, variable number, or operator character
+} token_t;
+
+static int binary_op_for(char c) {
+    switch (c) {
+    case '+':
+        return DSALIB_RPN_ADD;
+    case '-':
+        return DSALIB_RPN_SUB;
+    case '*':
+        return DSALIB_RPN_MUL;
+    case '/':
+        return DSALIB_RPN_DIV;
+    case '%':
+        return DSALIB_RPN_MOD;
+    default:
+        return -1;
+    }
+}
+
+/* Reads the next token; in RPN mode '-' directly before a digit starts a literal. */
+static token_t next_token(const char** cursor, bool rpn, const char* const* names, size_t num_vars) {
+    const char* p = *cursor;
+    while (isspace((unsigned char)*p)) p++;
+    token_t token = {TOKEN_ERROR, 0};
+    const char* start = p;
+
+    if (*p == '\0') {
+        token.kind = TOKEN_END;
+    } else if (isdigit((unsigned char)*p) || (rpn && *p == '-' && isdigit((unsigned char)p[1]))) {
+        p++;
+        while (isdigit((unsigned char)*p)) p++;
+        dsalib_string_span_t span = {start, (size_t)(p - start)};
+        if (dsalib_string_parse_int(span, &token.value)) token.kind = TOKEN_NUMBER;
+    } else if (isalpha((unsigned char)*p) || *p == '_') {
+        while (isalnum((unsigned char)*p) || *p == '_') p++;
+        size_t length = (size_t)(p - start);
+        for (size_t v = 0; v < num_vars; v++) {
+            if (names[v] && strlen(names[v]) == length && memcmp(names[v], start, length) == 0) {
+                token.kind = TOKEN_VAR;
+                token.value = (int)v;
+                break;
+            }
+        }
+    } else if (binary_op_for(*p) >= 0) {
+        token.kind = TOKEN_OP;
+        token.value = *p++;
+    } else if (!rpn && (*p == '(' || *p == ')')) {
+        token.kind = *p++ == '(' ? TOKEN_LPAREN : TOKEN_RPAREN;
+    }
+    *cursor = p;
+    return token;
+}
+
+/* ---- Code generation ---- */
+
+typedef struct {
+    dsalib_vector_t code; // dsalib_rpn_instr_t
+    size_t depth;         // Stack depth after the code emitted so far
+    bool failed;
+} builder_t;
+
+static void emit_push(builder_t* b, int op, int arg) {
+    dsalib_rpn_instr_t instr = {op, arg};
+    if (!dsalib_vector_push_back(&b->code, &instr)) b->failed = true;
+    b->depth++;
+}
+
+/*
+ * Emits an operator, folding literal operands: two literals become one, and
+ * a literal right operand moves into the instruction (ADD -> ADD_CONST).
+ */
+static void emit_op(builder_t* b, int op) {
+    size_t needed = op == DSALIB_RPN_NEG ? 1 : 2;
+    if (b->depth < needed) {
+        b->failed = true;
+        return;
+    }
+    b->depth -= needed - 1;
+
+    size_t n = dsalib_vector_size(&b->code);
+    dsalib_rpn_instr_t* code = dsalib_vector_data(&b->code);
+    bool last_const = n >= 1 && code[n - 1].op == DSALIB_RPN_PUSH_CONST;
+    if (op == DSALIB_RPN_NEG) {
+        if (last_const) {
+            code[n - 1].arg = clamp(-(long long)code[n - 1].arg);
+            return;
+        }
+    } else if (last_const) {
+        int folded;
+        if (n >= 2 && code[n - 2].op == DSALIB_RPN_PUSH_CONST &&
+            apply_binary(op, code[n - 2].arg, code[n - 1].arg, &folded)) {
+            code[n - 2].arg = folded;
+            dsalib_vector_pop_back(&b->code, NULL);
+        } else {
+            code[n - 1].op = op - DSALIB_RPN_ADD + DSALIB_RPN_ADD_CONST;
+        }
+        return;
+    }
+    dsalib_rpn_instr_t instr = {op, 0};
+    if (!dsalib_vector_push_back(&b->code, &instr)) b->failed = true;
+}
+
+static size_t compute_max_depth(const dsalib_rpn_instr_t* code, size_t length) {
+    size_t depth = 0;
+    size_t max_depth = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (code[i].op == DSALIB_RPN_PUSH_CONST || code[i].op == DSALIB_RPN_PUSH_VAR) {
+            depth++;
+        } else if (code[i].op >= DSALIB_RPN_ADD && code[i].op <= DSALIB_RPN_MOD) {
+            depth--;
+        }
+        if (depth > max_depth) max_depth = depth;
+    }
+    return max_depth;
+}
+
+static dsalib_rpn_program_t* finish(builder_t* b, size_t num_vars) {
+    if (b->failed || b->depth != 1) {
+        dsalib_vector_release(&b->code);
+        return NULL;
+    }
+
+    dsalib_rpn_program_t* program = malloc(sizeof(dsalib_rpn_program_t));
+    if (!program) {
+        dsalib_vector_release(&b->code);
+        return NULL;
+    }
+    program->code = dsalib_vector_detach(&b->code, &program->length, NULL);
+    program->max_depth = compute_max_depth(program->code, program->length);
+    program->num_vars = num_vars;
+    program->stack = program->code ? dsalib_stack_create(program->max_depth * DSALIB_RPN_BATCH) : NULL;
+    if (!program->stack) {
+        dsalib_rpn_destroy(program);
+        return NULL;
+    }
+    return program;
+}
+
+dsalib_rpn_program_t* dsalib_rpn_compile(const char* expression, const char* const* names, size_t num_vars) {
+    if (!expression || (num_vars && !names) || num_vars > INT_MAX) return NULL;
+
+    builder_t b = {.depth = 0, .failed = false};
+    dsalib_vector_init(&b.code, sizeof(dsalib_rpn_instr_t), DSALIB_VECTOR_GROW_2X);
+    const char* cursor = expression;
+    for (token_t token = next_token(&cursor, true, names, num_vars); token.kind != TOKEN_END && !b.failed;
+         token = next_token(&cursor, true, names, num_vars)) {
+        switch (token.kind) {
+        case TOKEN_NUMBER:
+            emit_push(&b, DSALIB_RPN_PUSH_CONST, token.value);
+            break;
+        case TOKEN_VAR:
+            emit_push(&b, DSALIB_RPN_PUSH_VAR, token.value);
+            break;
+        case TOKEN_OP:
+            emit_op(&b, binary_op_for((char)token.value));
+            break;
+        default:
+            b.failed = true;
+            break;
+        }
+    }
+    return finish(&b, num_vars);
+}
+
+/* Operator-stack entries for the shunting-yard pass. */
+#define LPAREN_MARK (-1)
+
+static int precedence(int op) {
+    switch (op) {
+    case DSALIB_RPN_NEG:
+        return 3;
+    case DSALIB_RPN_MUL:
+    case DSALIB_RPN_DIV:
+    case DSALIB_RPN_MOD:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+dsalib_rpn_program_t* dsalib_rpn_compile_infix(const char* expression, const char* const* names, size_t num_vars) {
+    if (!expression || (num_vars && !names) || num_vars > INT_MAX) return NULL;
+
+    dsalib_stack_t* ops = dsalib_stack_create(0);
+    if (!ops) return NULL;
+    builder_t b = {.depth = 0, .failed = false};
+    dsalib_vector_init(&b.code, sizeof(dsalib_rpn_instr_t), DSALIB_VECTOR_GROW_2X);
+
+    bool expect_operand = true;
+    const char* cursor = expression;
+    int top;
+    for (;;) {
+        token_t token = next_token(&cursor, false, names, num_vars);
+        if (token.kind == TOKEN_END || token.kind == TOKEN_ERROR || b.failed) {
+            b.failed |= token.kind == TOKEN_ERROR || expect_operand;
+            break;
+        }
+        switch (token.kind) {
+        case TOKEN_NUMBER:
+        case TOKEN_VAR:
+            if (!expect_operand) b.failed = true;
+            emit_push(&b, token.kind == TOKEN_NUMBER ? DSALIB_RPN_PUSH_CONST : DSALIB_RPN_PUSH_VAR, token.value);
+            expect_operand = false;
+            break;
+        case TOKEN_LPAREN:
+            if (!expect_operand || !dsalib_stack_push(ops, LPAREN_MARK)) b.failed = true;
+            break;
+        case TOKEN_RPAREN:
+            b.failed |= expect_operand;
+            for (;;) {
+                if (!dsalib_stack_pop(ops, &top)) {
+                    b.failed = true;
+                    break;
+                }
+                if (top == LPAREN_MARK) break;
+                emit_op(&b, top);
+            }
+            break;
+        case TOKEN_OP: {
+            int op = binary_op_for((char)token.value);
+            if (expect_operand) {
+                // Prefix operators: unary minus binds tightest, unary plus is a no-op.
+                if (token.value == '-') {
+                    if (!dsalib_stack_push(ops, DSALIB_RPN_NEG)) b.failed = true;
+                } else if (token.value != '+') {
+                    b.failed = true;
+                }
+                break;
+            }
+            while (dsalib_stack_peek(ops, &top) && top != LPAREN_MARK && precedence(top) >= precedence(op)) {
+                dsalib_stack_pop(ops, &top);
+                emit_op(&b, top);
+            }
+            if (!dsalib_stack_push(ops, op)) b.failed = true;
+            expect_operand = true;
+            break;
+        }
+        default:
+            b.failed = true;
+            break;
+        }
+    }
+    while (!b.failed && dsalib_stack_pop(ops, &top)) {
+        if (top == LPAREN_MARK) {
+            b.failed = true;
+        } else {
+            emit_op(&b, top);
+        }
+    }
+    dsalib_stack_destroy(ops);
+    return finish(&b, num_vars);
+}
+
+void dsalib_rpn_destroy(dsalib_rpn_program_t* program) {
+    if (!program) return;
+    free(program->code);
+    dsalib_stack_destroy(program->stack);
+    free(program);
+}
+
+/* ---- Evaluation ---- */
+
+bool dsalib_rpn_eval(dsalib_rpn_program_t* program, const int* vars, int* result) {
+    if (!program || !result || (program->num_vars && !vars)) return false;
+
+    // Depth was checked at compile time, so the stack is indexed directly.
+    int* s = program->stack->data;
+    size_t sp = 0;
+    for (const dsalib_rpn_instr_t* in = program->code; in != program->code + program->length; in++) {
+        switch (in->op) {
+        case DSALIB_RPN_PUSH_CONST:
+            s[sp++] = in->arg;
+            break;
+        case DSALIB_RPN_PUSH_VAR:
+            s[sp++] = vars[in->arg];
+            break;
+        case DSALIB_RPN_ADD_CONST:
+            s[sp - 1] = safe_add(s[sp - 1], in->arg);
+            break;
+        case DSALIB_RPN_SUB_CONST:
+            s[sp - 1] = clamp((long long)s[sp - 1] - in->arg);
+            break;
+        case DSALIB_RPN_MUL_CONST:
+            s[sp - 1] = clamp((long long)s[sp - 1] * in->arg);
+            break;
+        case DSALIB_RPN_DIV_CONST:
+        case DSALIB_RPN_MOD_CONST:
+            if (!apply_binary(in->op - DSALIB_RPN_ADD_CONST + DSALIB_RPN_ADD, s[sp - 1], in->arg, &s[sp - 1])) {
+                return false;
+            }
+            break;
+        case DSALIB_RPN_NEG:
+            s[sp - 1] = clamp(-(long long)s[sp - 1]);
+            break;
+        default:
+            sp--;
+            if (!apply_binary(in->op, s[sp - 1], s[sp], &s[sp - 1])) return false;
+            break;
+        }
+    }
+    *result = s[0];
+    return true;
+}
+
+/* Runs one instruction over n rows; slots are DSALIB_RPN_BATCH ints apart. */
+static void eval_batch_instr(const dsalib_rpn_instr_t* in,
+                             const int* const* columns,
+                             size_t first_row,
+                             size_t n,
+                             int* slots,
+                             size_t* sp,
+                             bool* failed) {
+    int k = in->arg;
+    if (in->op == DSALIB_RPN_PUSH_CONST || in->op == DSALIB_RPN_PUSH_VAR) {
+        int* slot = slots + *sp * DSALIB_RPN_BATCH;
+        if (in->op == DSALIB_RPN_PUSH_VAR) {
+            memcpy(slot, columns[k] + first_row, n * sizeof(int));
+        } else {
+            for (size_t i = 0; i < n; i++) slot[i] = k;
+        }
+        (*sp)++;
+        return;
+    }
+
+    int* top = slots + (*sp - 1) * DSALIB_RPN_BATCH;
+    const int* rhs = top;
+    switch (in->op) {
+    case DSALIB_RPN_NEG:
+        for (size_t i = 0; i < n; i++) top[i] = clamp(-(long long)top[i]);
+        return;
+    case DSALIB_RPN_ADD_CONST:
+    case DSALIB_RPN_SUB_CONST:
+    case DSALIB_RPN_MUL_CONST:
+    case DSALIB_RPN_DIV_CONST:
+    case DSALIB_RPN_MOD_CONST:
+        break;
+    default:
+        // Stack-operand form: pop the right operand.
+        top -= DSALIB_RPN_BATCH;
+        (*sp)--;
+        break;
+    }
+
+    // The same saturation as safe_add() & co., written inline so it vectorizes.
+    switch (in->op) {
+    case DSALIB_RPN_ADD:
+        for (size_t i = 0; i < n; i++) top[i] = clamp((long long)top[i] + rhs[i]);
+        break;
+    case DSALIB_RPN_ADD_CONST:
+        for (size_t i = 0; i < n; i++) top[i] = clamp((long long)top[i] + k);
+        break;
+    case DSALIB_RPN_SUB:
+        for (size_t i = 0; i < n; i++) top[i] = clamp((long long)top[i] - rhs[i]);
+        break;
+    case DSALIB_RPN_SUB_CONST:
+        for (size_t i = 0; i < n; i++) top[i] = clamp((long long)top[i] - k);
+        break;
+    case DSALIB_RPN_MUL:
+        for (size_t i = 0; i < n; i++) top[i] = clamp((long long)top[i] * rhs[i]);
+        break;
+    case DSALIB_RPN_MUL_CONST:
+        for (size_t i = 0; i < n; i++) top[i] = clamp((long long)top[i] * k);
+        break;
+    default: {
+        bool mod = in->op == DSALIB_RPN_MOD || in->op == DSALIB_RPN_MOD_CONST;
+        bool constant = in->op == DSALIB_RPN_DIV_CONST || in->op == DSALIB_RPN_MOD_CONST;
+        if (constant && k != 0) {
+            for (size_t i = 0; i < n; i++) top[i] = mod ? saturating_mod(top[i], k) : saturating_div(top[i], k);
+            break;
+        }
+        for (size_t i = 0; i < n; i++) {
+            int divisor = constant ? k : rhs[i];
+            if (divisor == 0) {
+                failed[i] = true;
+                top[i] = 0;
+            } else {
+                top[i] = mod ? saturating_mod(top[i], divisor) : saturating_div(top[i], divisor);
+            }
+        }
+        break;
+    }
+    }
+}
+
+size_t dsalib_rpn_eval_batch(dsalib_rpn_program_t* program,
+                             const int* const* columns,
+                             size_t rows,
+                             int* out) {
+    if (!program || !out || (program->num_vars && !columns)) return 0;
+    for (size_t v = 0; v < program->num_vars; v++) {
+        if (!columns[v]) return 0;
+    }
+
+    size_t ok = 0;
+    bool failed[DSALIB_RPN_BATCH];
+    for (size_t first = 0; first < rows; first += DSALIB_RPN_BATCH) {
+        size_t n = rows - first < DSALIB_RPN_BATCH ? rows - first : DSALIB_RPN_BATCH;
+        memset(failed, 0, n * sizeof(bool));
+        size_t sp = 0;
+        for (size_t pc = 0; pc < program->length; pc++) {
+            eval_batch_instr(&program->code[pc], columns, first, n, program->stack->data, &sp, failed);
+        }
+        for (size_t i = 0; i < n; i++) {
+            out[first + i] = failed[i] ? 0 : program->stack->data[i];
+            ok += !failed[i];
+        }
+    }
+    return ok;
+}
+
+bool dsalib_rpn_evaluate(const char* expression, int* result) {
+    dsalib_rpn_program_t* program = dsalib_rpn_compile(expression, NULL, 0);
+    bool ok = dsalib_rpn_eval(program, NULL, result);
+    dsalib_rpn_destroy(program);
+    return ok;
+}
@@ -0,0 +1,279 @@
+#include "dsalib/search/parallel_scan.h"
+
+#include "dsalib/util/parallel.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* First index in [begin, end) holding target, or end. */
+static size_t find_range(const int* arr, size_t begin, size_t end, int target) {
+    size_t i = begin;
+#if defined(__AVX2__)
+    __m256i t = _mm256_set1_epi32(target);
+    for (; i + 32 <= end; i += 32) {
+        __m256i m0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), t);
+        __m256i m1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), t);
+        __m256i m2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 16)), t);
+        __m256i m3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 24)), t);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(m0, m1), _mm256_or_si256(m2, m3));
+        if (!_mm256_testz_si256(any, any)) break; // The scalar loop pins it down
+    }
+#elif defined(__SSE2__)
+    __m128i t = _mm_set1_epi32(target);
+    for (; i + 16 <= end; i += 16) {
+        __m128i m0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i)), t);
+        __m128i m1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 4)), t);
+        __m128i m2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 8)), t);
+        __m128i m3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 12)), t);
+        __m128i any = _mm_or_si128(_mm_or_si128(m0, m1), _mm_or_si128(m2, m3));
+        if (_mm_movemask_epi8(any)) break; // The scalar loop pins it down
+    }
+#endif
+    for (; i < end; i++) {
+        if (arr[i] == target) return i;
+    }
+    return end;
+}
+
+/* Occurrences of target in [begin, end); at most one chunk, so lanes cannot overflow. */
+static size_t count_range(const int* arr, size_t begin, size_t end, int target) {
+    size_t i = begin;
+    size_t count = 0;
+#if defined(__AVX2__)
+    __m256i t = _mm256_set1_epi32(target);
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 16 <= end; i += 16) {
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), t));
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), t));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    for (int k = 0; k < 8; k++) count += (size_t)lanes[k];
+#elif defined(__SSE2__)
+    __m128i t = _mm_set1_epi32(target);
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 8 <= end; i += 8) {
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i)), t));
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 4)), t));
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    for (int k = 0; k < 4; k++) count += (size_t)lanes[k];
+#endif
+    for (; i < end; i++) {
+        count += arr[i] == target;
+    }
+    return count;
+}
+
+/* Smallest and largest value in [begin, end), which is not empty. */
+static void minmax_range(const int* arr, size_t begin, size_t end, int* min, int* max) {
+    size_t i = begin;
+    int lo = arr[begin], hi = arr[begin];
+#if defined(__AVX2__)
+    if (end - begin >= 8) {
+        __m256i vmin = _mm256_loadu_si256((const __m256i*)(arr + i));
+        __m256i vmax = vmin;
+        for (i += 8; i + 8 <= end; i += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(arr + i));
+            vmin = _mm256_min_epi32(vmin, v);
+            vmax = _mm256_max_epi32(vmax, v);
+        }
+        int mins[8], maxs[8];
+        _mm256_storeu_si256((__m256i*)mins, vmin);
+        _mm256_storeu_si256((__m256i*)maxs, vmax);
+        for (int k = 0; k < 8; k++) {
+            if (mins[k] < lo) lo = mins[k];
+            if (maxs[k] > hi) hi = maxs[k];
+        }
+    }
+#elif defined(__SSE2__)
+    if (end - begin >= 4) {
+        // SSE2 has no 32-bit min/max: select with a compare mask.
+        __m128i vmin = _mm_loadu_si128((const __m128i*)(arr + i));
+        __m128i vmax = vmin;
+        for (i += 4; i + 4 <= end; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(arr + i));
+            __m128i lt = _mm_cmpgt_epi32(vmin, v);
+            __m128i gt = _mm_cmpgt_epi32(v, vmax);
+            vmin = _mm_or_si128(_mm_and_si128(lt, v), _mm_andnot_si128(lt, vmin));
+            vmax = _mm_or_si128(_mm_and_si128(gt, v), _mm_andnot_si128(gt, vmax));
+        }
+        int mins[4], maxs[4];
+        _mm_storeu_si128((__m128i*)mins, vmin);
+        _mm_storeu_si128((__m128i*)maxs, vmax);
+        for (int k = 0; k < 4; k++) {
+            if (mins[k] < lo) lo = mins[k];
+            if (maxs[k] > hi) hi = maxs[k];
+        }
+    }
+#endif
+    for (; i < end; i++) {
+        if (arr[i] < lo) lo = arr[i];
+        if (arr[i] > hi) hi = arr[i];
+    }
+    *min = lo;
+    *max = hi;
+}
+
+static size_t num_chunks(size_t size) {
+    return (size + DSALIB_SCAN_CHUNK - 1) / DSALIB_SCAN_CHUNK;
+}
+
+static size_t clamp_threads(size_t num_threads, size_t chunks) {
+    if (num_threads == 0) num_threads = 1;
+    return num_threads < chunks ? num_threads : chunks;
+}
+
+typedef struct {
+    const int* arr;
+    size_t size;
+    int target;
+    dsalib_scan_predicate_fn pred; // NULL: compare with target
+    void* ctx;
+    _Atomic size_t found;          // Lowest match so far, size if none
+} find_work_t;
+
+static void find_worker(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    find_work_t* work = ctx;
+    for (size_t c = begin; c < end; c++) {
+        size_t first = c * DSALIB_SCAN_CHUNK;
+        // A match below this chunk already beats anything in it.
+        if (first >= atomic_load_explicit(&work->found, memory_order_relaxed)) return;
+        size_t last = first + DSALIB_SCAN_CHUNK < work->size ? first + DSALIB_SCAN_CHUNK : work->size;
+        size_t hit = last;
+        if (work->pred) {
+            for (size_t i = first; i < last; i++) {
+                if (work->pred(work->ctx, work->arr[i])) {
+                    hit = i;
+                    break;
+                }
+            }
+        } else {
+            hit = find_range(work->arr, first, last, work->target);
+        }
+        if (hit < last) {
+            size_t seen = atomic_load_explicit(&work->found, memory_order_relaxed);
+            while (hit < seen &&
+                   !atomic_compare_exchange_weak_explicit(&work->found, &seen, hit, memory_order_relaxed,
+                                                          memory_order_relaxed)) {
+            }
+            return; // Later chunks of this worker only hold larger indices
+        }
+    }
+}
+
+static long long parallel_find(const int* arr, size_t size, int target, dsalib_scan_predicate_fn pred, void* ctx,
+                               size_t num_threads) {
+    find_work_t work = {arr, size, target, pred, ctx, size};
+    size_t chunks = num_chunks(size);
+    dsalib_parallel_for(chunks, clamp_threads(num_threads, chunks), find_worker, &work);
+    size_t found = atomic_load(&work.found);
+    return found < size ? (long long)found : -1;
+}
+
+long long dsalib_parallel_find(const int* arr, size_t size, int target, size_t num_threads) {
+    if (!arr || size == 0) return -1;
+    return parallel_find(arr, size, target, NULL, NULL, num_threads);
+}
+
+long long dsalib_parallel_find_if(const int* arr, size_t size, dsalib_scan_predicate_fn pred, void* ctx,
+                                  size_t num_threads) {
+    if (!arr || !pred || size == 0) return -1;
+    return parallel_find(arr, size, 0, pred, ctx, num_threads);
+}
+
+typedef struct {
+    const int* arr;
+    size_t size;
+    int target;
+    size_t* counts;           // One per worker
+    dsalib_minmax_t* minmaxes; // One per worker
+} scan_work_t;
+
+static void count_worker(void* ctx, size_t begin, size_t end, size_t worker) {
+    scan_work_t* work = ctx;
+    size_t count = 0;
+    for (size_t c = begin; c < end; c++) {
+        size_t first = c * DSALIB_SCAN_CHUNK;
+        size_t last = first + DSALIB_SCAN_CHUNK < work->size ? first + DSALIB_SCAN_CHUNK : work->size;
+        count += count_range(work->arr, first, last, work->target);
+    }
+    work->counts[worker] = count;
+}
+
+static void minmax_worker(void* ctx, size_t begin, size_t end, size_t worker) {
+    scan_work_t* work = ctx;
+    dsalib_minmax_t result = {0, 0, 0, 0};
+    for (size_t c = begin; c < end; c++) {
+        size_t first = c * DSALIB_SCAN_CHUNK;
+        size_t last = first + DSALIB_SCAN_CHUNK < work->size ? first + DSALIB_SCAN_CHUNK : work->size;
+        int lo, hi;
+        minmax_range(work->arr, first, last, &lo, &hi);
+        // Locate an extreme only when it strictly improves: earlier chunks win ties.
+        if (c == begin || lo < result.min) {
+            result.min = lo;
+            result.min_index = find_range(work->arr, first, last, lo);
+        }
+        if (c == begin || hi > result.max) {
+            result.max = hi;
+            result.max_index = find_range(work->arr, first, last, hi);
+        }
+    }
+    work->minmaxes[worker] = result;
+}
+
+size_t dsalib_parallel_count(const int* arr, size_t size, int target, size_t num_threads) {
+    if (!arr || size == 0) return 0;
+    size_t chunks = num_chunks(size);
+    size_t threads = clamp_threads(num_threads, chunks);
+    size_t local;
+    size_t* counts = threads > 1 ? malloc(threads * sizeof(size_t)) : NULL;
+    if (!counts) {
+        threads = 1;
+        counts = &local;
+    }
+    scan_work_t work = {arr, size, target, counts, NULL};
+    dsalib_parallel_for(chunks, threads, count_worker, &work);
+    size_t total = 0;
+    for (size_t t = 0; t < threads; t++) {
+        total += counts[t];
+    }
+    if (counts != &local) free(counts);
+    return total;
+}
+
+bool dsalib_parallel_minmax(const int* arr, size_t size, size_t num_threads, dsalib_minmax_t* out) {
+    if (!arr || !out || size == 0) return false;
+    size_t chunks = num_chunks(size);
+    size_t threads = clamp_threads(num_threads, chunks);
+    dsalib_minmax_t local;
+    dsalib_minmax_t* minmaxes = threads > 1 ? malloc(threads * sizeof(dsalib_minmax_t)) : NULL;
+    if (!minmaxes) {
+        threads = 1;
+        minmaxes = &local;
+    }
+    scan_work_t work = {arr, size, 0, NULL, minmaxes};
+    dsalib_parallel_for(chunks, threads, minmax_worker, &work);
+    // Workers cover ascending ranges, so strict comparisons keep the first index.
+    *out = minmaxes[0];
+    for (size_t t = 1; t < threads; t++) {
+        if (minmaxes[t].min < out->min) {
+            out->min = minmaxes[t].min;
+            out->min_index = minmaxes[t].min_index;
+        }
+        if (minmaxes[t].max > out->max) {
+            out->max = minmaxes[t].max;
+            out->max_index = minmaxes[t].max_index;
+        }
+    }
+    if (minmaxes != &local) free(minmaxes);
+    return true;
+}
@@ -0,0 +1,286 @@
+#include "dsalib/search/range_query.h"
+
+#include "dsalib/util/parallel.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Elements per thread below which a parallel scan is not worth starting. */
+#define PARALLEL_GRAIN (1 << 18)
+
+static inline size_t floor_log2(size_t x) {
+    return (size_t)(63 - __builtin_clzll((unsigned long long)x));
+}
+
+static inline int pick(int a, int b, dsalib_range_kind_t kind) {
+    if (kind == DSALIB_RANGE_MAX) return a > b ? a : b;
+    return a < b ? a : b;
+}
+
+/* ---- Sparse table ---- */
+
+/* Fills count entries of one level from two overlapping runs of the previous one. */
+static void build_level(int* dst, const int* src, size_t half, size_t count, dsalib_range_kind_t kind) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 4 <= count; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + i + half));
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        __m128i best = kind == DSALIB_RANGE_MAX
+                           ? _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b))
+                           : _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+        _mm_storeu_si128((__m128i*)(dst + i), best);
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = pick(src[i], src[i + half], kind);
+    }
+}
+
+dsalib_sparse_table_t* dsalib_sparse_table_create(const int* arr, size_t size, dsalib_range_kind_t kind) {
+    if (!arr || size == 0) return NULL;
+
+    dsalib_sparse_table_t* table = malloc(sizeof(dsalib_sparse_table_t));
+    if (!table) return NULL;
+    table->size = size;
+    table->num_levels = floor_log2(size) + 1;
+    table->kind = kind;
+    table->table = malloc(table->num_levels * size * sizeof(int));
+    if (!table->table) {
+        free(table);
+        return NULL;
+    }
+
+    memcpy(table->table, arr, size * sizeof(int));
+    for (size_t k = 1; k < table->num_levels; k++) {
+        size_t half = (size_t)1 << (k - 1);
+        // Level k is only defined where a whole run of 2^k elements fits.
+        build_level(table->table + k * size, table->table + (k - 1) * size, half, size - 2 * half + 1, kind);
+    }
+    return table;
+}
+
+void dsalib_sparse_table_destroy(dsalib_sparse_table_t* table) {
+    if (!table) return;
+    free(table->table);
+    free(table);
+}
+
+bool dsalib_sparse_table_query(const dsalib_sparse_table_t* table, size_t left, size_t right, int* result) {
+    if (!table || !result || left >= right || right > table->size) return false;
+    size_t k = floor_log2(right - left);
+    const int* level = table->table + k * table->size;
+    *result = pick(level[left], level[right - ((size_t)1 << k)], table->kind);
+    return true;
+}
+
+/* ---- Fenwick tree ---- */
+
+dsalib_fenwick_t* dsalib_fenwick_create(const int* arr, size_t size) {
+    if (size == 0) return NULL;
+
+    dsalib_fenwick_t* fenwick = malloc(sizeof(dsalib_fenwick_t));
+    if (!fenwick) return NULL;
+    fenwick->size = size;
+    fenwick->tree = calloc(size + 1, sizeof(long long));
+    if (!fenwick->tree) {
+        free(fenwick);
+        return NULL;
+    }
+
+    // Linear build: each node pushes its finished sum to its parent.
+    if (arr) {
+        long long* tree = fenwick->tree;
+        for (size_t i = 1; i <= size; i++) {
+            tree[i] += arr[i - 1];
+            size_t parent = i + (i & -i);
+            if (parent <= size) tree[parent] += tree[i];
+        }
+    }
+    return fenwick;
+}
+
+void dsalib_fenwick_destroy(dsalib_fenwick_t* fenwick) {
+    if (!fenwick) return;
+    free(fenwick->tree);
+    free(fenwick);
+}
+
+bool dsalib_fenwick_add(dsalib_fenwick_t* fenwick, size_t index, long long delta) {
+    if (!fenwick || index >= fenwick->size) return false;
+    for (size_t i = index + 1; i <= fenwick->size; i += i & -i) {
+        fenwick->tree[i] += delta;
+    }
+    return true;
+}
+
+long long dsalib_fenwick_prefix_sum(const dsalib_fenwick_t* fenwick, size_t count) {
+    if (!fenwick) return 0;
+    if (count > fenwick->size) count = fenwick->size;
+    long long sum = 0;
+    for (size_t i = count; i > 0; i -= i & -i) {
+        sum += fenwick->tree[i];
+    }
+    return sum;
+}
+
+long long dsalib_fenwick_range_sum(const dsalib_fenwick_t* fenwick, size_t left, size_t right) {
+    if (!fenwick || left >= right || right > fenwick->size) return 0;
+    return dsalib_fenwick_prefix_sum(fenwick, right) - dsalib_fenwick_prefix_sum(fenwick, left);
+}
+
+size_t dsalib_fenwick_lower_bound(const dsalib_fenwick_t* fenwick, long long target) {
+    if (!fenwick) return 0;
+    if (target <= 0) return 0;
+
+    // position counts the elements whose prefix sum stays below target.
+    size_t position = 0;
+    for (size_t step = (size_t)1 << floor_log2(fenwick->size); step > 0; step >>= 1) {
+        size_t next = position + step;
+        if (next <= fenwick->size && fenwick->tree[next] < target) {
+            position = next;
+            target -= fenwick->tree[next];
+        }
+    }
+    return position;
+}
+
+/* ---- Prefix scan ---- */
+
+static long long sum_range(const int* arr, size_t n) {
+    long long sum = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(arr + i));
+        __m128i sign = _mm_cmpgt_epi32(zero, x);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, sign));
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    sum = lanes[0] + lanes[1];
+#endif
+    for (; i < n; i++) {
+        sum += arr[i];
+    }
+    return sum;
+}
+
+/*
+ * Scans arr[0 .. n) starting from offset. Four ints are sign-extended into
+ * two pairs of 64-bit lanes; each pair is scanned with one shifted add and
+ * the running total is carried through by broadcasting the upper lane.
+ */
+static void scan_range(const int* arr, size_t n, long long* out, long long offset, bool inclusive) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i carry = _mm_set1_epi64x(offset);
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(arr + i));
+        __m128i sign = _mm_cmpgt_epi32(zero, x);
+        __m128i lo = _mm_unpacklo_epi32(x, sign);
+        __m128i hi = _mm_unpackhi_epi32(x, sign);
+        __m128i lo_sum = _mm_add_epi64(_mm_add_epi64(lo, _mm_slli_si128(lo, 8)), carry);
+        carry = _mm_shuffle_epi32(lo_sum, _MM_SHUFFLE(3, 2, 3, 2));
+        __m128i hi_sum = _mm_add_epi64(_mm_add_epi64(hi, _mm_slli_si128(hi, 8)), carry);
+        carry = _mm_shuffle_epi32(hi_sum, _MM_SHUFFLE(3, 2, 3, 2));
+        if (!inclusive) {
+            lo_sum = _mm_sub_epi64(lo_sum, lo);
+            hi_sum = _mm_sub_epi64(hi_sum, hi);
+        }
+        _mm_storeu_si128((__m128i*)(out + i), lo_sum);
+        _mm_storeu_si128((__m128i*)(out + i + 2), hi_sum);
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, carry);
+    offset = lanes[0];
+#endif
+    for (; i < n; i++) {
+        long long next = offset + arr[i];
+        out[i] = inclusive ? next : offset;
+        offset = next;
+    }
+}
+
+typedef struct {
+    const int* arr;
+    long long* out;
+    size_t size;
+    size_t chunks;
+    long long* offsets; // Chunk totals after pass one, starting offsets after the scan
+    bool inclusive;
+} scan_job_t;
+
+static size_t chunk_begin(const scan_job_t* job, size_t chunk) {
+    return job->size / job->chunks * chunk + (chunk < job->size % job->chunks ? chunk : job->size % job->chunks);
+}
+
+static void sum_chunks(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    scan_job_t* job = ctx;
+    for (size_t c = begin; c < end; c++) {
+        size_t first = chunk_begin(job, c);
+        job->offsets[c] = sum_range(job->arr + first, chunk_begin(job, c + 1) - first);
+    }
+}
+
+static void scan_chunks(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)worker;
+    scan_job_t* job = ctx;
+    for (size_t c = begin; c < end; c++) {
+        size_t first = chunk_begin(job, c);
+        scan_range(job->arr + first, chunk_begin(job, c + 1) - first, job->out + first, job->offsets[c],
+                   job->inclusive);
+    }
+}
+
+static bool prefix_sum(const int* arr, size_t size, long long* out, size_t num_threads, bool inclusive) {
+    if (!arr || !out) return false;
+    size_t useful = size / PARALLEL_GRAIN;
+    if (num_threads > useful) num_threads = useful;
+    if (num_threads <= 1) {
+        scan_range(arr, size, out, 0, inclusive);
+        return true;
+    }
+
+    scan_job_t job;
+    job.arr = arr;
+    job.out = out;
+    job.size = size;
+    job.chunks = num_threads;
+    job.inclusive = inclusive;
+    job.offsets = malloc(num_threads * sizeof(long long));
+    if (!job.offsets) {
+        scan_range(arr, size, out, 0, inclusive);
+        return true;
+    }
+
+    dsalib_parallel_for(job.chunks, num_threads, sum_chunks, &job);
+    long long running = 0;
+    for (size_t c = 0; c < job.chunks; c++) {
+        long long total = job.offsets[c];
+        job.offsets[c] = running;
+        running += total;
+    }
+    dsalib_parallel_for(job.chunks, num_threads, scan_chunks, &job);
+
+    free(job.offsets);
+    return true;
+}
+
+bool dsalib_prefix_sum_inclusive(const int* arr, size_t size, long long* out, size_t num_threads) {
+    return prefix_sum(arr, size, out, num_threads, true);
+}
+
+bool dsalib_prefix_sum_exclusive(const int* arr, size_t size, long long* out, size_t num_threads) {
+    return prefix_sum(arr, size, out, num_threads, false);
+}
@@ -0,0 +1,242 @@
+#include "dsalib/search/select.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Ranges this short are finished with insertion sort. */
+#define SMALL_RANGE 16
+
+static inline void swap_int(int* a, int* b) {
+    int tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+static size_t floor_log2(size_t x) {
+    return x ? (size_t)(63 - __builtin_clzll((unsigned long long)x)) : 0;
+}
+
+static void insertion_sort(int* arr, size_t lo, size_t hi) {
+    for (size_t i = lo + 1; i < hi; i++) {
+        int value = arr[i];
+        size_t j = i;
+        while (j > lo && arr[j - 1] > value) {
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        arr[j] = value;
+    }
+}
+
+static inline int median3(int a, int b, int c) {
+    if (a > b) swap_int(&a, &b);
+    if (b > c) b = c;
+    return a > b ? a : b;
+}
+
+/* Median of three samples, or of three medians of three for large ranges. */
+static int sample_pivot(const int* arr, size_t lo, size_t hi) {
+    size_t n = hi - lo;
+    size_t mid = lo + n / 2;
+    if (n < 1024) return median3(arr[lo], arr[mid], arr[hi - 1]);
+    size_t step = n / 8;
+    return median3(median3(arr[lo], arr[lo + step], arr[lo + 2 * step]),
+                   median3(arr[mid - step], arr[mid], arr[mid + step]),
+                   median3(arr[hi - 1 - 2 * step], arr[hi - 1 - step], arr[hi - 1]));
+}
+
+/*
+ * Three-way partition: afterwards [lo, *lt) < pivot, [*lt, *gt) == pivot
+ * and [*gt, hi) > pivot.
+ */
+static void partition3(int* arr, size_t lo, size_t hi, int pivot, size_t* lt, size_t* gt) {
+    size_t less = lo, i = lo, greater = hi;
+    while (i < greater) {
+        if (arr[i] < pivot) {
+            swap_int(&arr[less++], &arr[i++]);
+        } else if (arr[i] > pivot) {
+            swap_int(&arr[i], &arr[--greater]);
+        } else {
+            i++;
+        }
+    }
+    *lt = less;
+    *gt = greater;
+}
+
+static void select_ranks(int* arr, size_t lo, size_t hi, const size_t* ranks, size_t num_ranks, size_t depth);
+
+/*
+ * Median of medians of five: the group medians are gathered at the front
+ * of the range and their median is selected recursively. It is guaranteed
+ * to have at least 30% of the range on each side.
+ */
+static int median_of_medians(int* arr, size_t lo, size_t hi) {
+    size_t groups = 0;
+    for (size_t g = lo; g + 5 <= hi; g += 5) {
+        insertion_sort(arr, g, g + 5);
+        swap_int(&arr[lo + groups++], &arr[g + 2]);
+    }
+    size_t rank = lo + groups / 2;
+    select_ranks(arr, lo, lo + groups, &rank, 1, 2 * floor_log2(groups));
+    return arr[rank];
+}
+
+static void select_ranks(int* arr, size_t lo, size_t hi, const size_t* ranks, size_t num_ranks, size_t depth) {
+    while (num_ranks > 0) {
+        if (hi - lo <= SMALL_RANGE) {
+            insertion_sort(arr, lo, hi);
+            return;
+        }
+        int pivot;
+        if (depth > 0) {
+            pivot = sample_pivot(arr, lo, hi);
+            depth--;
+        } else {
+            pivot = median_of_medians(arr, lo, hi);
+        }
+
+        size_t lt, gt;
+        partition3(arr, lo, hi, pivot, &lt, &gt);
+
+        // Ranks in [lt, gt) are settled; the rest split by side.
+        size_t left = 0;
+        while (left < num_ranks && ranks[left] < lt) left++;
+        size_t right = left;
+        while (right < num_ranks && ranks[right] < gt) right++;
+
+        if (left > 0) select_ranks(arr, lo, lt, ranks, left, depth);
+        ranks += right;
+        num_ranks -= right;
+        lo = gt;
+    }
+}
+
+bool dsalib_nth_element(int* arr, size_t size, size_t rank) {
+    if (!arr || rank >= size) return false;
+    select_ranks(arr, 0, size, &rank, 1, 2 * floor_log2(size));
+    return true;
+}
+
+bool dsalib_multi_select(int* arr, size_t size, const size_t* ranks, size_t num_ranks) {
+    if (!arr || !ranks) return false;
+    for (size_t i = 0; i < num_ranks; i++) {
+        if (ranks[i] >= size || (i > 0 && ranks[i] < ranks[i - 1])) return false;
+    }
+    select_ranks(arr, 0, size, ranks, num_ranks, 2 * floor_log2(size));
+    return true;
+}
+
+size_t dsalib_quantile_rank(size_t size, double q) {
+    if (size == 0) return 0;
+    if (!(q > 0.0)) return 0;
+    if (q >= 1.0) return size - 1;
+    return (size_t)(q * (double)(size - 1));
+}
+
+/* ---- Streaming top-k ---- */
+
+dsalib_topk_t* dsalib_topk_create(size_t k) {
+    if (k == 0) return NULL;
+    dsalib_topk_t* topk = malloc(sizeof(dsalib_topk_t));
+    if (!topk) return NULL;
+    topk->heap = malloc(k * sizeof(int));
+    if (!topk->heap) {
+        free(topk);
+        return NULL;
+    }
+    topk->k = k;
+    topk->count = 0;
+    return topk;
+}
+
+void dsalib_topk_destroy(dsalib_topk_t* topk) {
+    if (!topk) return;
+    free(topk->heap);
+    free(topk);
+}
+
+void dsalib_topk_reset(dsalib_topk_t* topk) {
+    if (topk) topk->count = 0;
+}
+
+static void sift_down(int* heap, size_t count, size_t i) {
+    int value = heap[i];
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= count) break;
+        if (child + 1 < count && heap[child + 1] < heap[child]) child++;
+        if (heap[child] >= value) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = value;
+}
+
+bool dsalib_topk_push(dsalib_topk_t* topk, int value) {
+    if (!topk) return false;
+    int* heap = topk->heap;
+    if (topk->count < topk->k) {
+        size_t i = topk->count++;
+        while (i > 0 && heap[(i - 1) / 2] > value) {
+            heap[i] = heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        heap[i] = value;
+        return true;
+    }
+    if (value <= heap[0]) return false;
+    heap[0] = value;
+    sift_down(heap, topk->count, 0);
+    return true;
+}
+
+bool dsalib_topk_push_array(dsalib_topk_t* topk, const int* arr, size_t size) {
+    if (!topk || !arr) return false;
+    size_t i = 0;
+    while (i < size && topk->count < topk->k) {
+        dsalib_topk_push(topk, arr[i++]);
+    }
+#if defined(__SSE2__)
+    // Sixteen values per test; only blocks with a value above the root go to the heap.
+    __m128i threshold = _mm_set1_epi32(i < size ? topk->heap[0] : 0);
+    for (; i + 16 <= size; i += 16) {
+        const __m128i* in = (const __m128i*)(arr + i);
+        __m128i above = _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(_mm_loadu_si128(in), threshold),
+                                                  _mm_cmpgt_epi32(_mm_loadu_si128(in + 1), threshold)),
+                                     _mm_or_si128(_mm_cmpgt_epi32(_mm_loadu_si128(in + 2), threshold),
+                                                  _mm_cmpgt_epi32(_mm_loadu_si128(in + 3), threshold)));
+        if (!_mm_movemask_epi8(above)) continue;
+        for (size_t j = i; j < i + 16; j++) {
+            dsalib_topk_push(topk, arr[j]);
+        }
+        threshold = _mm_set1_epi32(topk->heap[0]);
+    }
+#endif
+    for (; i < size; i++) {
+        dsalib_topk_push(topk, arr[i]);
+    }
+    return true;
+}
+
+bool dsalib_topk_threshold(const dsalib_topk_t* topk, int* threshold) {
+    if (!topk || !threshold || topk->count == 0) return false;
+    *threshold = topk->heap[0];
+    return true;
+}
+
+size_t dsalib_topk_result(const dsalib_topk_t* topk, int* out) {
+    if (!topk || !out) return 0;
+    // Heap sort of a copy: popping the min-heap root fills out from the back.
+    size_t count = topk->count;
+    memcpy(out, topk->heap, count * sizeof(int));
+    for (size_t end = count; end > 1; end--) {
+        swap_int(&out[0], &out[end - 1]);
+        sift_down(out, end - 1, 0);
+    }
+    return count;
+}
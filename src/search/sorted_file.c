@@ -0,0 +1,277 @@
+#include "dsalib/search/sorted_file.h"
+
+#include "dsalib/search/binary_search.h"
+#include "dsalib/util/hash.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define ENDIAN_TAG 0x01020304U
+#define MAX_SECTIONS 3
+#define PRIME1 0x9E3779B185EBCA87ULL
+#define PRIME2 0xC2B2AE3D27D4EB4FULL
+
+static uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+uint64_t dsalib_sorted_file_checksum(const void* data, size_t bytes) {
+    const unsigned char* p = data;
+    uint64_t acc[4] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+    size_t i = 0;
+
+    // Four independent lanes keep several multiplies in flight.
+    for (; i + 32 <= bytes; i += 32) {
+        for (int lane = 0; lane < 4; lane++) {
+            uint64_t word;
+            memcpy(&word, p + i + 8 * lane, sizeof(word));
+            acc[lane] = rotl64(acc[lane] + word * PRIME2, 31) * PRIME1;
+        }
+    }
+    uint64_t h = rotl64(acc[0], 1) + rotl64(acc[1], 7) + rotl64(acc[2], 12) + rotl64(acc[3], 18);
+    h += (uint64_t)bytes;
+    for (; i < bytes; i++) {
+        h = rotl64(h ^ (p[i] * PRIME1), 11) * PRIME2;
+    }
+    return dsalib_hash_u64(h);
+}
+
+static uint64_t align_up(uint64_t offset) {
+    return (offset + DSALIB_SORTED_FILE_ALIGNMENT - 1) / DSALIB_SORTED_FILE_ALIGNMENT * DSALIB_SORTED_FILE_ALIGNMENT;
+}
+
+static bool write_padding(FILE* out, uint64_t* position, uint64_t target) {
+    static const char zeros[64];
+    while (*position < target) {
+        size_t chunk = target - *position < sizeof(zeros) ? (size_t)(target - *position) : sizeof(zeros);
+        if (fwrite(zeros, 1, chunk, out) != chunk) return false;
+        *position += chunk;
+    }
+    return true;
+}
+
+bool dsalib_sorted_file_write(const char* path,
+                              const int* arr,
+                              size_t size,
+                              const dsalib_sorted_file_options_t* options) {
+    if (!path || (size > 0 && !arr)) return false;
+    for (size_t i = 1; i < size; i++) {
+        if (arr[i - 1] > arr[i]) return false;
+    }
+
+    // Build the optional indexes in memory first.
+    size_t stride = options ? options->fence_stride : 0;
+    size_t fence_count = stride && size ? (size + stride - 1) / stride : 0;
+    int* fences = NULL;
+    if (fence_count) {
+        fences = malloc(fence_count * sizeof(int));
+        if (!fences) return false;
+        for (size_t i = 0; i < fence_count; i++) {
+            fences[i] = arr[i * stride];
+        }
+    }
+    dsalib_bloom_filter_t* bloom = NULL;
+    if (options && options->bloom_fpr > 0.0) {
+        bloom = dsalib_bloom_filter_build(arr, size, options->bloom_fpr);
+        if (!bloom) {
+            free(fences);
+            return false;
+        }
+    }
+
+    const void* payloads[MAX_SECTIONS];
+    dsalib_sorted_file_section_t table[MAX_SECTIONS];
+    memset(table, 0, sizeof(table));
+    uint32_t count = 0;
+    table[count].kind = DSALIB_SORTED_FILE_SECTION_ARRAY;
+    table[count].bytes = (uint64_t)size * sizeof(int);
+    table[count].param = size;
+    payloads[count++] = arr;
+    if (fences) {
+        table[count].kind = DSALIB_SORTED_FILE_SECTION_FENCES;
+        table[count].bytes = (uint64_t)fence_count * sizeof(int);
+        table[count].param = stride;
+        payloads[count++] = fences;
+    }
+    if (bloom) {
+        table[count].kind = DSALIB_SORTED_FILE_SECTION_BLOOM;
+        table[count].bytes = (uint64_t)bloom->num_blocks * DSALIB_BLOOM_BLOCK_WORDS * sizeof(uint32_t);
+        table[count].param = bloom->num_blocks;
+        payloads[count++] = bloom->blocks;
+    }
+
+    uint64_t offset = align_up(sizeof(dsalib_sorted_file_header_t) + count * sizeof(dsalib_sorted_file_section_t));
+    for (uint32_t s = 0; s < count; s++) {
+        table[s].offset = offset;
+        table[s].checksum = dsalib_sorted_file_checksum(payloads[s], (size_t)table[s].bytes);
+        offset = align_up(offset + table[s].bytes);
+    }
+
+    dsalib_sorted_file_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DSALIB_SORTED_FILE_MAGIC, sizeof(DSALIB_SORTED_FILE_MAGIC));
+    header.version = DSALIB_SORTED_FILE_VERSION;
+    header.endian_tag = ENDIAN_TAG;
+    header.file_size = table[count - 1].offset + table[count - 1].bytes;
+    header.section_count = count;
+    header.table_checksum = dsalib_sorted_file_checksum(table, count * sizeof(dsalib_sorted_file_section_t));
+
+    bool ok = false;
+    FILE* out = fopen(path, "wb");
+    if (out) {
+        uint64_t position = 0;
+        ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+             fwrite(table, sizeof(dsalib_sorted_file_section_t), count, out) == count;
+        position = sizeof(header) + count * sizeof(dsalib_sorted_file_section_t);
+        for (uint32_t s = 0; ok && s < count; s++) {
+            // Empty sections may have a NULL payload, which fwrite must not see.
+            ok = write_padding(out, &position, table[s].offset) &&
+                 (table[s].bytes == 0 || fwrite(payloads[s], 1, (size_t)table[s].bytes, out) == table[s].bytes);
+            position += table[s].bytes;
+        }
+        ok = (fclose(out) == 0) && ok;
+    }
+
+    free(fences);
+    dsalib_bloom_filter_destroy(bloom);
+    return ok;
+}
+
+/* Checks one section entry against the file bounds and its kind's rules. */
+static bool section_valid(const dsalib_sorted_file_section_t* section, uint64_t file_size) {
+    if (section->offset % DSALIB_SORTED_FILE_ALIGNMENT != 0) return false;
+    if (section->offset > file_size || section->bytes > file_size - section->offset) return false;
+    switch (section->kind) {
+    case DSALIB_SORTED_FILE_SECTION_ARRAY:
+        return section->param <= UINT64_MAX / sizeof(int) && section->bytes == section->param * sizeof(int);
+    case DSALIB_SORTED_FILE_SECTION_FENCES:
+        return section->param > 0 && section->bytes % sizeof(int) == 0;
+    case DSALIB_SORTED_FILE_SECTION_BLOOM:
+        return section->param > 0 && section->param <= UINT32_MAX &&
+               section->bytes == section->param * DSALIB_BLOOM_BLOCK_WORDS * sizeof(uint32_t);
+    default:
+        return true; // Unknown sections from newer writers are skipped.
+    }
+}
+
+static bool attach_sections(dsalib_sorted_file_t* file, int flags) {
+    const unsigned char* base = file->mapping;
+    const dsalib_sorted_file_header_t* header = file->mapping;
+
+    if (file->mapping_size < sizeof(*header)) return false;
+    if (memcmp(header->magic, DSALIB_SORTED_FILE_MAGIC, sizeof(DSALIB_SORTED_FILE_MAGIC)) != 0) return false;
+    if (header->version != DSALIB_SORTED_FILE_VERSION || header->endian_tag != ENDIAN_TAG) return false;
+    if (header->file_size != file->mapping_size) return false;
+    if (header->section_count > (file->mapping_size - sizeof(*header)) / sizeof(dsalib_sorted_file_section_t)) {
+        return false;
+    }
+
+    const dsalib_sorted_file_section_t* table = (const void*)(base + sizeof(*header));
+    size_t table_bytes = header->section_count * sizeof(dsalib_sorted_file_section_t);
+    if (dsalib_sorted_file_checksum(table, table_bytes) != header->table_checksum) return false;
+
+    bool has_array = false;
+    for (uint32_t s = 0; s < header->section_count; s++) {
+        const dsalib_sorted_file_section_t* section = &table[s];
+        if (!section_valid(section, header->file_size)) return false;
+        const void* payload = base + section->offset;
+        if ((flags & DSALIB_SORTED_FILE_VERIFY) &&
+            dsalib_sorted_file_checksum(payload, (size_t)section->bytes) != section->checksum) {
+            return false;
+        }
+        switch (section->kind) {
+        case DSALIB_SORTED_FILE_SECTION_ARRAY:
+            file->data = payload;
+            file->size = (size_t)section->param;
+            has_array = true;
+            break;
+        case DSALIB_SORTED_FILE_SECTION_FENCES:
+            file->fences = payload;
+            file->fence_count = (size_t)(section->bytes / sizeof(int));
+            file->fence_stride = (size_t)section->param;
+            break;
+        case DSALIB_SORTED_FILE_SECTION_BLOOM:
+            // The filter only reads its blocks, so a read-only view is safe.
+            file->bloom.blocks = (uint32_t*)payload;
+            file->bloom.num_blocks = (uint32_t)section->param;
+            file->has_bloom = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // The fence index must describe exactly this array.
+    if (file->fences && file->fence_count != (file->size + file->fence_stride - 1) / file->fence_stride) {
+        return false;
+    }
+    return has_array;
+}
+
+dsalib_sorted_file_t* dsalib_sorted_file_open(const char* path, int flags) {
+    if (!path) return NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    int map_flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    if (flags & DSALIB_SORTED_FILE_POPULATE) map_flags |= MAP_POPULATE;
+#endif
+    void* mapping = mmap(NULL, (size_t)st.st_size, PROT_READ, map_flags, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return NULL;
+
+#if defined(MADV_HUGEPAGE)
+    if (flags & DSALIB_SORTED_FILE_HUGEPAGE) madvise(mapping, (size_t)st.st_size, MADV_HUGEPAGE);
+#endif
+    if (flags & DSALIB_SORTED_FILE_WILLNEED) madvise(mapping, (size_t)st.st_size, MADV_WILLNEED);
+
+    dsalib_sorted_file_t* file = calloc(1, sizeof(dsalib_sorted_file_t));
+    if (!file) {
+        munmap(mapping, (size_t)st.st_size);
+        return NULL;
+    }
+    file->mapping = mapping;
+    file->mapping_size = (size_t)st.st_size;
+    if (!attach_sections(file, flags)) {
+        dsalib_sorted_file_close(file);
+        return NULL;
+    }
+    return file;
+}
+
+void dsalib_sorted_file_close(dsalib_sorted_file_t* file) {
+    if (!file) return;
+    munmap(file->mapping, file->mapping_size);
+    free(file);
+}
+
+size_t dsalib_sorted_file_lower_bound(const dsalib_sorted_file_t* file, int target) {
+    if (!file) return 0;
+    if (!file->fences) return dsalib_lower_bound(file->data, file->size, target);
+
+    // fences[f] >= target > fences[f - 1], so the answer is in that stride.
+    size_t f = dsalib_lower_bound(file->fences, file->fence_count, target);
+    size_t lo = f == 0 ? 0 : (f - 1) * file->fence_stride;
+    size_t hi = f * file->fence_stride < file->size ? f * file->fence_stride : file->size;
+    return lo + dsalib_lower_bound(file->data + lo, hi - lo, target);
+}
+
+int dsalib_sorted_file_search(const dsalib_sorted_file_t* file, int target) {
+    if (!file) return -1;
+    if (file->has_bloom && !dsalib_bloom_filter_contains(&file->bloom, target)) return -1;
+    size_t i = dsalib_sorted_file_lower_bound(file, target);
+    if (i < file->size && file->data[i] == target) return (int)i;
+    return -1;
+}
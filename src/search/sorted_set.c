@@ -0,0 +1,245 @@
+#include "dsalib/search/sorted_set.h"
+
+#include "dsalib/search/binary_search.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * Returns the first index >= pos with l[index] >= x. Probes pos, pos+1,
+ * pos+3, pos+7, ... and finishes with dsalib_lower_bound() on the last gap,
+ * so the cost is logarithmic in the distance travelled, not in nl.
+ */
+static size_t gallop(const int* l, size_t nl, size_t pos, int x) {
+    size_t step = 1;
+    size_t hi = pos;
+    while (hi < nl && l[hi] < x) {
+        pos = hi + 1;
+        hi += step;
+        step <<= 1;
+    }
+    size_t end = hi < nl ? hi + 1 : nl;
+    return pos + dsalib_lower_bound(l + pos, end - pos, x);
+}
+
+static bool is_skewed(size_t small, size_t large) {
+    return small == 0 || large / small >= DSALIB_SORTED_SET_GALLOP_RATIO;
+}
+
+#if defined(__SSE2__)
+/*
+ * Compares every lane of va against every lane of vb by rotating vb three
+ * times. Bit k of the result is set when a[k] occurs somewhere in vb.
+ */
+static int block_match_mask(__m128i va, __m128i vb) {
+    __m128i eq = _mm_cmpeq_epi32(va, vb);
+    eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+    eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+    eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+    return _mm_movemask_ps(_mm_castsi128_ps(eq));
+}
+#endif
+
+size_t dsalib_sorted_intersect_merge(const int* a, size_t na, const int* b, size_t nb, int* out) {
+    if (!out || (na && !a) || (nb && !b)) return 0;
+
+    size_t i = 0, j = 0, n = 0;
+#if defined(__SSE2__)
+    while (i + 4 <= na && j + 4 <= nb) {
+        __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + j));
+        int mask = block_match_mask(va, vb);
+        for (int k = 0; k < 4; k++) {
+            if (mask & (1 << k)) out[n++] = a[i + k];
+        }
+        int amax = a[i + 3];
+        int bmax = b[j + 3];
+        if (amax <= bmax) i += 4;
+        if (bmax <= amax) j += 4;
+    }
+#endif
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            out[n++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return n;
+}
+
+size_t dsalib_sorted_intersect_gallop(const int* a, size_t na, const int* b, size_t nb, int* out) {
+    if (!out || (na && !a) || (nb && !b)) return 0;
+
+    const int* s = na <= nb ? a : b;
+    const int* l = na <= nb ? b : a;
+    size_t ns = na <= nb ? na : nb;
+    size_t nl = na <= nb ? nb : na;
+
+    size_t pos = 0, n = 0;
+    for (size_t i = 0; i < ns; i++) {
+        pos = gallop(l, nl, pos, s[i]);
+        if (pos == nl) break;
+        if (l[pos] == s[i]) out[n++] = s[i];
+    }
+    return n;
+}
+
+size_t dsalib_sorted_intersect(const int* a, size_t na, const int* b, size_t nb, int* out) {
+    size_t ns = na <= nb ? na : nb;
+    size_t nl = na <= nb ? nb : na;
+    if (is_skewed(ns, nl)) {
+        return dsalib_sorted_intersect_gallop(a, na, b, nb, out);
+    }
+    return dsalib_sorted_intersect_merge(a, na, b, nb, out);
+}
+
+size_t dsalib_sorted_union(const int* a, size_t na, const int* b, size_t nb, int* out) {
+    if (!out || (na && !a) || (nb && !b)) return 0;
+
+    size_t n = 0;
+    if (is_skewed(na < nb ? na : nb, na < nb ? nb : na)) {
+        // Copy runs of the large input between elements of the small one.
+        const int* s = na < nb ? a : b;
+        const int* l = na < nb ? b : a;
+        size_t ns = na < nb ? na : nb;
+        size_t nl = na < nb ? nb : na;
+        size_t pos = 0;
+        for (size_t i = 0; i < ns; i++) {
+            size_t next = gallop(l, nl, pos, s[i]);
+            memcpy(out + n, l + pos, (next - pos) * sizeof(int));
+            n += next - pos;
+            pos = next;
+            if (pos < nl && l[pos] == s[i]) pos++;
+            out[n++] = s[i];
+        }
+        memcpy(out + n, l + pos, (nl - pos) * sizeof(int));
+        return n + (nl - pos);
+    }
+
+    size_t i = 0, j = 0;
+    while (i < na && j < nb) {
+        int x = a[i];
+        int y = b[j];
+        out[n++] = x <= y ? x : y;
+        i += x <= y;
+        j += y <= x;
+    }
+    memcpy(out + n, a + i, (na - i) * sizeof(int));
+    n += na - i;
+    memcpy(out + n, b + j, (nb - j) * sizeof(int));
+    return n + (nb - j);
+}
+
+size_t dsalib_sorted_difference(const int* a, size_t na, const int* b, size_t nb, int* out) {
+    if (!out || (na && !a) || (nb && !b)) return 0;
+
+    size_t n = 0;
+    if (is_skewed(na < nb ? na : nb, na < nb ? nb : na)) {
+        if (na < nb) {
+            // Few candidates: look each one up in b.
+            size_t pos = 0;
+            for (size_t i = 0; i < na; i++) {
+                pos = gallop(b, nb, pos, a[i]);
+                if (pos == nb || b[pos] != a[i]) out[n++] = a[i];
+            }
+            return n;
+        }
+        // Few removals: copy the runs of a between elements of b.
+        size_t pos = 0;
+        for (size_t j = 0; j < nb && pos < na; j++) {
+            size_t next = gallop(a, na, pos, b[j]);
+            memcpy(out + n, a + pos, (next - pos) * sizeof(int));
+            n += next - pos;
+            pos = next;
+            if (pos < na && a[pos] == b[j]) pos++;
+        }
+        memcpy(out + n, a + pos, (na - pos) * sizeof(int));
+        return n + (na - pos);
+    }
+
+    size_t i = 0, j = 0;
+    int matched = 0;
+#if defined(__SSE2__)
+    // matched accumulates hits for the current a block across b blocks.
+    while (i + 4 <= na && j + 4 <= nb) {
+        __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + j));
+        matched |= block_match_mask(va, vb);
+        int amax = a[i + 3];
+        int bmax = b[j + 3];
+        if (amax <= bmax) {
+            for (int k = 0; k < 4; k++) {
+                if (!(matched & (1 << k))) out[n++] = a[i + k];
+            }
+            matched = 0;
+            i += 4;
+        }
+        if (bmax <= amax) j += 4;
+    }
+#endif
+    size_t block_start = i;
+    for (; i < na; i++) {
+        if (i - block_start < 4 && (matched & (1 << (i - block_start)))) continue;
+        while (j < nb && b[j] < a[i]) j++;
+        if (j < nb && b[j] == a[i]) {
+            j++;
+        } else {
+            out[n++] = a[i];
+        }
+    }
+    return n;
+}
+
+/* Heap order over list cursors: smaller head value first, then lower list id. */
+static bool cursor_less(const int* const* lists, const size_t* pos, size_t x, size_t y) {
+    int vx = lists[x][pos[x]];
+    int vy = lists[y][pos[y]];
+    return vx < vy || (vx == vy && x < y);
+}
+
+static void sift_down(const int* const* lists, const size_t* pos, size_t* heap, size_t len, size_t i) {
+    for (;;) {
+        size_t left = 2 * i + 1;
+        if (left >= len) return;
+        size_t child = left;
+        if (left + 1 < len && cursor_less(lists, pos, heap[left + 1], heap[left])) child = left + 1;
+        if (!cursor_less(lists, pos, heap[child], heap[i])) return;
+        size_t tmp = heap[i];
+        heap[i] = heap[child];
+        heap[child] = tmp;
+        i = child;
+    }
+}
+
+size_t dsalib_sorted_merge_k(const int* const* lists, const size_t* sizes, size_t k, size_t* work, int* out) {
+    if (!lists || !sizes || !work || !out) return 0;
+
+    size_t* heap = work;
+    size_t* pos = work + k;
+    size_t len = 0;
+    for (size_t i = 0; i < k; i++) {
+        pos[i] = 0;
+        if (sizes[i] > 0 && lists[i]) heap[len++] = i;
+    }
+    for (size_t i = len / 2; i-- > 0;) {
+        sift_down(lists, pos, heap, len, i);
+    }
+
+    size_t n = 0;
+    while (len > 0) {
+        size_t top = heap[0];
+        out[n++] = lists[top][pos[top]];
+        if (++pos[top] == sizes[top]) heap[0] = heap[--len];
+        sift_down(lists, pos, heap, len, 0);
+    }
+    return n;
+}
@@ -0,0 +1,81 @@
+#include "dsalib/util/parallel.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+    dsalib_parallel_fn fn;
+    void* ctx;
+    size_t begin;
+    size_t end;
+    size_t worker;
+} chunk_t;
+
+static void* run_chunk(void* arg) {
+    chunk_t* chunk = arg;
+    chunk->fn(chunk->ctx, chunk->begin, chunk->end, chunk->worker);
+    return NULL;
+}
+
+/* Chunk t of num_threads over [0, n): the first n % num_threads get one extra. */
+static chunk_t make_chunk(size_t n, size_t num_threads, size_t t, dsalib_parallel_fn fn, void* ctx) {
+    chunk_t chunk;
+    chunk.fn = fn;
+    chunk.ctx = ctx;
+    chunk.begin = n / num_threads * t + (t < n % num_threads ? t : n % num_threads);
+    chunk.end = chunk.begin + n / num_threads + (t < n % num_threads);
+    chunk.worker = t;
+    return chunk;
+}
+
+bool dsalib_parallel_for(size_t n, size_t num_threads, dsalib_parallel_fn fn, void* ctx) {
+    if (!fn) return false;
+    if (num_threads == 0) num_threads = 1;
+    if (num_threads > n) num_threads = n ? n : 1;
+
+    if (num_threads == 1) {
+        fn(ctx, 0, n, 0);
+        return true;
+    }
+
+    chunk_t* chunks = malloc(num_threads * sizeof(chunk_t));
+    pthread_t* threads = malloc(num_threads * sizeof(pthread_t));
+    bool* started = calloc(num_threads, sizeof(bool));
+    if (!chunks || !threads || !started) {
+        free(chunks);
+        free(threads);
+        free(started);
+        // Same chunks, run one after another, so every worker slot is used.
+        for (size_t t = 0; t < num_threads; t++) {
+            chunk_t chunk = make_chunk(n, num_threads, t, fn, ctx);
+            run_chunk(&chunk);
+        }
+        return true;
+    }
+
+    for (size_t t = 0; t < num_threads; t++) {
+        chunks[t] = make_chunk(n, num_threads, t, fn, ctx);
+    }
+    for (size_t t = 1; t < num_threads; t++) {
+        started[t] = pthread_create(&threads[t], NULL, run_chunk, &chunks[t]) == 0;
+    }
+    run_chunk(&chunks[0]);
+    for (size_t t = 1; t < num_threads; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        } else {
+            run_chunk(&chunks[t]);
+        }
+    }
+
+    free(chunks);
+    free(threads);
+    free(started);
+    return true;
+}
+
+size_t dsalib_parallel_hardware_threads(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? (size_t)online : 1;
+}
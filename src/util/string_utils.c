@@ -0,0 +1,258 @@
+#include "dsalib/util/string_utils.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * The aligned strlen loop may read past the terminator, but never past the
+ * 16-byte block holding it, so it cannot cross into an unmapped page.
+ * AddressSanitizer still flags those bytes, so it is told to look away.
+ */
+#if defined(__GNUC__)
+#define NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define NO_SANITIZE_ADDRESS
+#endif
+
+#if defined(__SSE2__)
+/* Bit i is set when p[i] == the byte broadcast in needle, for i < 64. */
+static uint64_t match_mask64(const char* p, __m128i needle) {
+    const __m128i* in = (const __m128i*)p;
+    uint64_t m0 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(in), needle));
+    uint64_t m1 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(in + 1), needle));
+    uint64_t m2 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(in + 2), needle));
+    uint64_t m3 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(in + 3), needle));
+    return m0 | (m1 << 16) | (m2 << 32) | (m3 << 48);
+}
+#endif
+
+NO_SANITIZE_ADDRESS size_t dsalib_string_length(const char* s) {
+    if (!s) return 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    size_t misalignment = (uintptr_t)s & 15;
+    const __m128i* block = (const __m128i*)(s - misalignment);
+    unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(block), zero)) >> misalignment;
+    if (mask) return (size_t)__builtin_ctz(mask);
+    // Single blocks up to a 64-byte boundary, then four blocks per test.
+    for (block++; (uintptr_t)block & 63; block++) {
+        mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(block), zero));
+        if (mask) return (size_t)((const char*)block - s) + (size_t)__builtin_ctz(mask);
+    }
+    for (;; block += 4) {
+        __m128i least = _mm_min_epu8(_mm_min_epu8(_mm_load_si128(block), _mm_load_si128(block + 1)),
+                                     _mm_min_epu8(_mm_load_si128(block + 2), _mm_load_si128(block + 3)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(least, zero))) break;
+    }
+    for (;; block++) {
+        mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(block), zero));
+        if (mask) return (size_t)((const char*)block - s) + (size_t)__builtin_ctz(mask);
+    }
+#else
+    return strlen(s);
+#endif
+}
+
+const char* dsalib_string_find_byte(const char* buf, size_t length, char c) {
+    if (!buf) return NULL;
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; i + 64 <= length; i += 64) {
+        const __m128i* in = (const __m128i*)(buf + i);
+        __m128i any = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(_mm_loadu_si128(in), needle),
+                                                _mm_cmpeq_epi8(_mm_loadu_si128(in + 1), needle)),
+                                   _mm_or_si128(_mm_cmpeq_epi8(_mm_loadu_si128(in + 2), needle),
+                                                _mm_cmpeq_epi8(_mm_loadu_si128(in + 3), needle)));
+        if (_mm_movemask_epi8(any)) return buf + i + __builtin_ctzll(match_mask64(buf + i, needle));
+    }
+#endif
+    for (; i < length; i++) {
+        if (buf[i] == c) return buf + i;
+    }
+    return NULL;
+}
+
+size_t dsalib_string_count_byte(const char* buf, size_t length, char c) {
+    if (!buf) return 0;
+    size_t count = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; i + 64 <= length; i += 64) {
+        count += (size_t)__builtin_popcountll(match_mask64(buf + i, needle));
+    }
+#endif
+    for (; i < length; i++) {
+        count += buf[i] == c;
+    }
+    return count;
+}
+
+const char* dsalib_string_find(const char* haystack,
+                               size_t haystack_length,
+                               const char* needle,
+                               size_t needle_length) {
+    if (!haystack || (needle_length && !needle)) return NULL;
+    if (needle_length == 0) return haystack;
+    if (needle_length > haystack_length) return NULL;
+    if (needle_length == 1) return dsalib_string_find_byte(haystack, haystack_length, needle[0]);
+
+    size_t last = needle_length - 1;
+    size_t positions = haystack_length - last; // Candidate start positions
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i first_byte = _mm_set1_epi8(needle[0]);
+    const __m128i last_byte = _mm_set1_epi8(needle[last]);
+    for (; i + 16 <= positions; i += 16) {
+        __m128i starts = _mm_loadu_si128((const __m128i*)(haystack + i));
+        __m128i ends = _mm_loadu_si128((const __m128i*)(haystack + i + last));
+        unsigned mask = (unsigned)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(starts, first_byte), _mm_cmpeq_epi8(ends, last_byte)));
+        while (mask) {
+            size_t candidate = i + (size_t)__builtin_ctz(mask);
+            if (memcmp(haystack + candidate + 1, needle + 1, last - 1) == 0) return haystack + candidate;
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < positions; i++) {
+        if (haystack[i] == needle[0] && haystack[i + last] == needle[last] &&
+            memcmp(haystack + i + 1, needle + 1, last - 1) == 0) {
+            return haystack + i;
+        }
+    }
+    return NULL;
+}
+
+/* Records field [start, end) as field number count if it fits. */
+static void emit_span(const char* buf,
+                      size_t start,
+                      size_t end,
+                      bool strip_cr,
+                      dsalib_string_span_t* spans,
+                      size_t max_spans,
+                      size_t count) {
+    if (count >= max_spans) return;
+    if (strip_cr && end > start && buf[end - 1] == '\r') end--;
+    spans[count].data = buf + start;
+    spans[count].length = end - start;
+}
+
+static size_t split_impl(const char* buf,
+                         size_t length,
+                         char delim,
+                         bool lines,
+                         dsalib_string_span_t* spans,
+                         size_t max_spans) {
+    if (!spans) max_spans = 0;
+    size_t count = 0;
+    size_t start = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    // One 64-bit mask per 64 bytes; each set bit ends a field.
+    const __m128i needle = _mm_set1_epi8(delim);
+    for (; i + 64 <= length; i += 64) {
+        uint64_t mask = match_mask64(buf + i, needle);
+        while (mask) {
+            size_t end = i + (size_t)__builtin_ctzll(mask);
+            emit_span(buf, start, end, lines, spans, max_spans, count++);
+            start = end + 1;
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (buf[i] == delim) {
+            emit_span(buf, start, i, lines, spans, max_spans, count++);
+            start = i + 1;
+        }
+    }
+    if (!lines || start < length) emit_span(buf, start, length, lines, spans, max_spans, count++);
+    return count;
+}
+
+size_t dsalib_string_split(const char* buf,
+                           size_t length,
+                           char delim,
+                           dsalib_string_span_t* spans,
+                           size_t max_spans) {
+    if (!buf) return 0;
+    return split_impl(buf, length, delim, false, spans, max_spans);
+}
+
+size_t dsalib_string_split_lines(const char* buf, size_t length, dsalib_string_span_t* spans, size_t max_spans) {
+    if (!buf) return 0;
+    return split_impl(buf, length, '\n', true, spans, max_spans);
+}
+
+static bool is_digit(char c) {
+    return (unsigned char)(c - '0') < 10;
+}
+
+/*
+ * Accumulates digits from p[*i] into a magnitude that must stay within
+ * INT_MAX (or INT_MAX + 1 when negative). Returns false on overflow.
+ */
+static bool parse_digits(const char* p, size_t length, size_t* i, bool negative, unsigned* magnitude) {
+    unsigned limit = negative ? (unsigned)INT_MAX + 1U : (unsigned)INT_MAX;
+    unsigned value = 0;
+    size_t j = *i;
+    while (j < length && is_digit(p[j])) {
+        unsigned digit = (unsigned)(p[j] - '0');
+        if (value > (limit - digit) / 10) return false;
+        value = value * 10 + digit;
+        j++;
+    }
+    *i = j;
+    *magnitude = value;
+    return true;
+}
+
+static int apply_sign(unsigned magnitude, bool negative) {
+    if (!negative) return (int)magnitude;
+    return magnitude == (unsigned)INT_MAX + 1U ? INT_MIN : -(int)magnitude;
+}
+
+bool dsalib_string_parse_int(dsalib_string_span_t span, int* value) {
+    if (!span.data || !value) return false;
+    size_t i = 0;
+    bool negative = false;
+    if (i < span.length && (span.data[i] == '-' || span.data[i] == '+')) {
+        negative = span.data[i] == '-';
+        i++;
+    }
+    if (i == span.length) return false;
+
+    unsigned magnitude;
+    if (!parse_digits(span.data, span.length, &i, negative, &magnitude) || i != span.length) return false;
+    *value = apply_sign(magnitude, negative);
+    return true;
+}
+
+size_t dsalib_string_parse_ints(const char* buf, size_t length, int* out, size_t max, size_t* consumed) {
+    size_t count = 0;
+    size_t i = 0;
+    if (buf && out) {
+        while (count < max) {
+            while (i < length && !is_digit(buf[i])) i++;
+            if (i == length) break;
+
+            size_t start = i;
+            bool negative = i > 0 && buf[i - 1] == '-';
+            unsigned magnitude;
+            if (!parse_digits(buf, length, &i, negative, &magnitude)) {
+                i = negative ? start - 1 : start;
+                break;
+            }
+            out[count++] = apply_sign(magnitude, negative);
+        }
+    }
+    if (consumed) *consumed = i;
+    return count;
+}
@@ -0,0 +1,281 @@
+#include <dsalib/graph/astar.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* O(V^2) Dijkstra over a dense cost matrix (LLONG_MAX = no edge). */
+static long long reference_dijkstra(const long long* cost, size_t n, size_t source, size_t target) {
+    long long* dist = malloc(n * sizeof(long long));
+    char* done = calloc(n, 1);
+    for (size_t i = 0; i < n; i++) dist[i] = LLONG_MAX;
+    dist[source] = 0;
+    for (;;) {
+        size_t u = n;
+        for (size_t i = 0; i < n; i++) {
+            if (!done[i] && dist[i] != LLONG_MAX && (u == n || dist[i] < dist[u])) u = i;
+        }
+        if (u == n) break;
+        done[u] = 1;
+        for (size_t v = 0; v < n; v++) {
+            if (cost[u * n + v] != LLONG_MAX && dist[u] + cost[u * n + v] < dist[v]) dist[v] = dist[u] + cost[u * n + v];
+        }
+    }
+    long long result = dist[target] == LLONG_MAX ? DSALIB_SEARCH_UNREACHABLE : dist[target];
+    free(dist);
+    free(done);
+    return result;
+}
+
+/* Dense move-cost matrix of a grid, following the same movement rules. */
+static long long* grid_costs(const dsalib_grid_t* grid) {
+    size_t n = (size_t)grid->width * grid->height;
+    long long* cost = malloc(n * n * sizeof(long long));
+    for (size_t i = 0; i < n * n; i++) cost[i] = LLONG_MAX;
+    for (size_t y = 0; y < grid->height; y++) {
+        for (size_t x = 0; x < grid->width; x++) {
+            if (!grid->cells[y * grid->width + x]) continue;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if ((dx == 0 && dy == 0) || (!grid->diagonal && dx != 0 && dy != 0)) continue;
+                    long long nx = (long long)x + dx, ny = (long long)y + dy;
+                    if (nx < 0 || ny < 0 || nx >= grid->width || ny >= grid->height) continue;
+                    size_t v = (size_t)ny * grid->width + (size_t)nx;
+                    if (!grid->cells[v]) continue;
+                    if (dx != 0 && dy != 0 &&
+                        (!grid->cells[y * grid->width + (size_t)nx] || !grid->cells[(size_t)ny * grid->width + x])) {
+                        continue;
+                    }
+                    int base = dx != 0 && dy != 0 ? DSALIB_GRID_COST_DIAGONAL : DSALIB_GRID_COST_STRAIGHT;
+                    cost[(y * grid->width + x) * n + v] = (long long)base * grid->cells[v];
+                }
+            }
+        }
+    }
+    return cost;
+}
+
+/* Checks the state's last path is a chain of edges summing to expected. */
+static void check_path(const dsalib_search_state_t* state, const long long* cost, size_t n, uint32_t source,
+                       uint32_t target, long long expected) {
+    size_t length = dsalib_search_path(state, NULL);
+    if (expected == DSALIB_SEARCH_UNREACHABLE) {
+        assert(length == 0);
+        return;
+    }
+    uint32_t* path = malloc(length * sizeof(uint32_t));
+    assert(dsalib_search_path(state, path) == length);
+    assert(path[0] == source && path[length - 1] == target);
+    long long total = 0;
+    for (size_t i = 1; i < length; i++) {
+        assert(cost[path[i - 1] * n + path[i]] != LLONG_MAX);
+        total += cost[path[i - 1] * n + path[i]];
+    }
+    assert(total == expected);
+    free(path);
+}
+
+/* Admissible custom heuristic for tests: half the octile distance. */
+static long long half_octile(void* ctx, uint32_t node, uint32_t goal) {
+    return dsalib_heuristic_octile(ctx, node, goal) / 2;
+}
+
+/* Admissible for unit weights: at least one more edge unless at the goal. */
+static long long not_there_yet(void* ctx, uint32_t node, uint32_t goal) {
+    (void)ctx;
+    return node != goal;
+}
+
+void test_astar_grid() {
+    printf("Testing A* on grids...\n");
+
+    // Test 1: A wall forces a detour
+    //   S . # . .
+    //   . . # . .
+    //   . . . . T
+    uint8_t cells[15] = {1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1};
+    dsalib_grid_t grid = {cells, 5, 3, false};
+    dsalib_search_state_t* state = dsalib_search_state_create(15);
+    assert(state != NULL);
+    assert(dsalib_astar_grid(&grid, 0, 14, dsalib_heuristic_manhattan, &grid, state) == 60);
+    uint32_t path[15];
+    assert(dsalib_search_path(state, path) == 7 && path[0] == 0 && path[6] == 14);
+    assert(dsalib_bidirectional_dijkstra_grid(&grid, 0, 14, state) == 60);
+    assert(dsalib_search_path(state, NULL) == 7);
+    grid.diagonal = true;
+    assert(dsalib_astar_grid(&grid, 0, 14, dsalib_heuristic_octile, &grid, state) == 54);
+    assert(dsalib_astar_grid(&grid, 0, 0, dsalib_heuristic_octile, &grid, state) == 0);
+    assert(dsalib_search_path(state, path) == 1 && path[0] == 0);
+    cells[12] = 0; // Close the gap under the wall
+    assert(dsalib_astar_grid(&grid, 0, 14, dsalib_heuristic_octile, &grid, state) == DSALIB_SEARCH_UNREACHABLE);
+    assert(dsalib_bidirectional_dijkstra_grid(&grid, 0, 14, state) == DSALIB_SEARCH_UNREACHABLE);
+    assert(dsalib_search_path(state, path) == 0);
+    printf("  ✓ Test 1 passed: Detours, diagonal moves and walls\n");
+
+    // Test 2: Random weighted grids against a reference Dijkstra
+    dsalib_search_state_destroy(state);
+    state = dsalib_search_state_create(16 * 16);
+    size_t queries = 0;
+    for (int round = 0; round < 40; round++) {
+        uint32_t w = 3 + (uint32_t)(rand() % 14), h = 3 + (uint32_t)(rand() % 14);
+        size_t n = (size_t)w * h;
+        uint8_t* random_cells = malloc(n);
+        for (size_t i = 0; i < n; i++) {
+            random_cells[i] = rand() % 4 == 0 ? 0 : (uint8_t)(1 + (round % 2 ? rand() % 9 : 0));
+        }
+        dsalib_grid_t random_grid = {random_cells, w, h, round % 4 >= 2};
+        long long* cost = grid_costs(&random_grid);
+        dsalib_heuristic_fn builtin = random_grid.diagonal ? dsalib_heuristic_octile : dsalib_heuristic_manhattan;
+        for (int q = 0; q < 20; q++) {
+            uint32_t s = (uint32_t)((size_t)rand() % n), t = (uint32_t)((size_t)rand() % n);
+            long long expected = random_cells[s] && random_cells[t] ? reference_dijkstra(cost, n, s, t)
+                                                                     : DSALIB_SEARCH_UNREACHABLE;
+            assert(dsalib_astar_grid(&random_grid, s, t, NULL, NULL, state) == expected);
+            check_path(state, cost, n, s, t, expected);
+            assert(dsalib_astar_grid(&random_grid, s, t, builtin, &random_grid, state) == expected);
+            check_path(state, cost, n, s, t, expected);
+            assert(dsalib_astar_grid(&random_grid, s, t, half_octile, &random_grid, state) == expected);
+            assert(dsalib_bidirectional_dijkstra_grid(&random_grid, s, t, state) == expected);
+            check_path(state, cost, n, s, t, expected);
+            queries++;
+        }
+        free(cost);
+        free(random_cells);
+    }
+    dsalib_search_state_destroy(state);
+    printf("  ✓ Test 2 passed: %zu random queries match a reference Dijkstra\n", queries);
+
+    // Test 3: The heuristic reduces expansions on an open grid
+    uint8_t* open = malloc(100 * 100);
+    for (int i = 0; i < 100 * 100; i++) open[i] = 1;
+    dsalib_grid_t open_grid = {open, 100, 100, true};
+    state = dsalib_search_state_create(100 * 100);
+    assert(dsalib_astar_grid(&open_grid, 0, 100 * 100 - 1, NULL, NULL, state) == 99 * 14);
+    size_t dijkstra = state->expanded;
+    assert(dsalib_astar_grid(&open_grid, 0, 100 * 100 - 1, dsalib_heuristic_octile, &open_grid, state) == 99 * 14);
+    size_t astar = state->expanded;
+    assert(astar == 100 && dijkstra > 50 * astar);
+    assert(dsalib_bidirectional_dijkstra_grid(&open_grid, 0, 100 * 100 - 1, state) == 99 * 14);
+    assert(state->expanded < dijkstra);
+    printf("  ✓ Test 3 passed: A* expands %zu nodes vs %zu for Dijkstra\n", astar, dijkstra);
+
+    // Test 4: Generation wrap-around leaves no stale records behind
+    state->generation = UINT32_MAX - 2;
+    for (int i = 0; i < 6; i++) {
+        uint32_t t = (uint32_t)(rand() % (100 * 100));
+        long long expected = dsalib_astar_grid(&open_grid, 5, t, NULL, NULL, state);
+        assert(dsalib_astar_grid(&open_grid, 5, t, dsalib_heuristic_octile, &open_grid, state) == expected);
+        assert(dsalib_bidirectional_dijkstra_grid(&open_grid, 5, t, state) == expected);
+    }
+    assert(state->generation < 100);
+    free(open);
+    printf("  ✓ Test 4 passed: Generation wrap-around\n");
+
+    // Test 5: Invalid input
+    assert(dsalib_astar_grid(NULL, 0, 1, NULL, NULL, state) == DSALIB_SEARCH_UNREACHABLE);
+    assert(dsalib_astar_grid(&open_grid, 0, 100 * 100, NULL, NULL, state) == DSALIB_SEARCH_UNREACHABLE);
+    assert(dsalib_astar_grid(&open_grid, 0, 1, NULL, NULL, NULL) == DSALIB_SEARCH_UNREACHABLE);
+    dsalib_search_state_t* small = dsalib_search_state_create(10);
+    assert(dsalib_astar_grid(&open_grid, 0, 1, NULL, NULL, small) == DSALIB_SEARCH_UNREACHABLE);
+    assert(dsalib_bidirectional_dijkstra_grid(&open_grid, 0, 1, small) == DSALIB_SEARCH_UNREACHABLE);
+    assert(dsalib_search_state_create(0) == NULL);
+    assert(dsalib_search_path(NULL, path) == 0 && dsalib_search_path(small, path) == 0);
+    assert(dsalib_heuristic_octile(NULL, 0, 1) == 0);
+    dsalib_search_state_destroy(small);
+    dsalib_search_state_destroy(state);
+    dsalib_search_state_destroy(NULL);
+    printf("  ✓ Test 5 passed: Invalid arguments\n");
+
+    printf("All A* grid tests passed!\n\n");
+}
+
+void test_astar_csr() {
+    printf("Testing searches on CSR graphs...\n");
+
+    // Test 1: Random directed graphs against a reference Dijkstra
+    size_t queries = 0;
+    for (int round = 0; round < 30; round++) {
+        size_t n = 2 + (size_t)(rand() % 60);
+        size_t m = (size_t)rand() % (4 * n);
+        dsalib_edge_t* edges = malloc((m ? m : 1) * sizeof(dsalib_edge_t));
+        int* weights = malloc((m ? m : 1) * sizeof(int));
+        long long* cost = malloc(n * n * sizeof(long long));
+        for (size_t i = 0; i < n * n; i++) cost[i] = LLONG_MAX;
+        // Edges sorted by source, so weights[] lines up with the CSR order.
+        for (size_t i = 0; i < m; i++) {
+            edges[i].u = (uint32_t)(i * n / m);
+            edges[i].v = (uint32_t)((size_t)rand() % n);
+            weights[i] = round % 3 == 0 ? 0 : rand() % 100;
+            size_t cell = edges[i].u * n + edges[i].v;
+            if (weights[i] < cost[cell]) cost[cell] = weights[i];
+        }
+        dsalib_csr_graph_t* graph = dsalib_csr_graph_create(n, edges, m);
+        int* reverse_weights = malloc((m ? m : 1) * sizeof(int));
+        dsalib_csr_graph_t* reverse = dsalib_csr_graph_transpose(graph, weights, reverse_weights);
+        assert(reverse != NULL && reverse->num_edges == m);
+        dsalib_search_state_t* state = dsalib_search_state_create(n);
+        for (int q = 0; q < 20; q++) {
+            uint32_t s = (uint32_t)((size_t)rand() % n), t = (uint32_t)((size_t)rand() % n);
+            long long expected = reference_dijkstra(cost, n, s, t);
+            assert(dsalib_astar_csr(graph, weights, s, t, NULL, NULL, state) == expected);
+            check_path(state, cost, n, s, t, expected);
+            assert(dsalib_bidirectional_dijkstra_csr(graph, weights, reverse, reverse_weights, s, t, state) ==
+                   expected);
+            check_path(state, cost, n, s, t, expected);
+            queries++;
+        }
+        dsalib_search_state_destroy(state);
+        dsalib_csr_graph_destroy(reverse);
+        dsalib_csr_graph_destroy(graph);
+        free(reverse_weights);
+        free(cost);
+        free(weights);
+        free(edges);
+    }
+    printf("  ✓ Test 1 passed: %zu random queries match a reference Dijkstra\n", queries);
+
+    // Test 2: Unit weights, a symmetric graph and a custom heuristic
+    // Ring 0-1-2-...-9-0 plus the chord 0-5, both directions.
+    dsalib_edge_t ring[22];
+    size_t m = 0;
+    for (uint32_t i = 0; i < 10; i++) {
+        ring[m++] = (dsalib_edge_t){i, (i + 1) % 10};
+        ring[m++] = (dsalib_edge_t){(i + 1) % 10, i};
+    }
+    ring[m++] = (dsalib_edge_t){0, 5};
+    ring[m++] = (dsalib_edge_t){5, 0};
+    dsalib_csr_graph_t* graph = dsalib_csr_graph_create(10, ring, m);
+    dsalib_search_state_t* state = dsalib_search_state_create(10);
+    assert(dsalib_astar_csr(graph, NULL, 1, 6, NULL, NULL, state) == 3);
+    assert(dsalib_bidirectional_dijkstra_csr(graph, NULL, NULL, NULL, 1, 6, state) == 3);
+    uint32_t path[10];
+    assert(dsalib_search_path(state, path) == 4 && path[0] == 1 && path[1] == 0 && path[2] == 5 && path[3] == 6);
+    assert(dsalib_astar_csr(graph, NULL, 1, 6, not_there_yet, NULL, state) == 3);
+    assert(dsalib_astar_csr(NULL, NULL, 0, 1, NULL, NULL, state) == DSALIB_SEARCH_UNREACHABLE);
+    assert(dsalib_astar_csr(graph, NULL, 0, 10, NULL, NULL, state) == DSALIB_SEARCH_UNREACHABLE);
+    int weights[22] = {0};
+    assert(dsalib_csr_graph_transpose(graph, weights, NULL) == NULL);
+    assert(dsalib_csr_graph_transpose(NULL, NULL, NULL) == NULL);
+    dsalib_search_state_destroy(state);
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 2 passed: Unit weights, symmetric graphs and a custom heuristic\n");
+
+    printf("All CSR search tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("A* Search Test Suite\n");
+    printf("================================\n\n");
+
+    srand(44);
+    test_astar_grid();
+    test_astar_csr();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
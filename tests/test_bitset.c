@@ -0,0 +1,193 @@
+#include <dsalib/containers/bitset.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Fills bits and ref with random bits of the given density (percent). */
+static void fill_random(dsalib_bitset_t* bits, bool* ref, int density) {
+    dsalib_bitset_reset(bits);
+    for (size_t i = 0; i < bits->size; i++) {
+        ref[i] = rand() % 100 < density;
+        if (ref[i]) dsalib_bitset_set(bits, i);
+    }
+}
+
+static void check_equal(const dsalib_bitset_t* bits, const bool* ref) {
+    size_t count = 0;
+    for (size_t i = 0; i < bits->size; i++) {
+        assert(dsalib_bitset_test(bits, i) == ref[i]);
+        count += ref[i];
+    }
+    assert(dsalib_bitset_count(bits) == count);
+}
+
+void test_bitset_basic() {
+    printf("Testing bitset basics...\n");
+
+    // Test 1: Set, clear, test and count
+    dsalib_bitset_t* bits = dsalib_bitset_create(130);
+    assert(bits != NULL && bits->size == 130 && bits->num_words == 3);
+    assert(dsalib_bitset_count(bits) == 0);
+    dsalib_bitset_set(bits, 0);
+    dsalib_bitset_set(bits, 64);
+    dsalib_bitset_set(bits, 129);
+    dsalib_bitset_set(bits, 130); // Out of range: ignored
+    assert(dsalib_bitset_test(bits, 0) && dsalib_bitset_test(bits, 64) && dsalib_bitset_test(bits, 129));
+    assert(!dsalib_bitset_test(bits, 1) && !dsalib_bitset_test(bits, 130));
+    assert(dsalib_bitset_count(bits) == 3);
+    dsalib_bitset_clear(bits, 64);
+    assert(!dsalib_bitset_test(bits, 64) && dsalib_bitset_count(bits) == 2);
+    printf("  ✓ Test 1 passed: Set, clear, test and count\n");
+
+    // Test 2: Iteration with next_set
+    assert(dsalib_bitset_next_set(bits, 0) == 0);
+    assert(dsalib_bitset_next_set(bits, 1) == 129);
+    assert(dsalib_bitset_next_set(bits, 130) == 130);
+    dsalib_bitset_reset(bits);
+    assert(dsalib_bitset_next_set(bits, 0) == 130);
+    printf("  ✓ Test 2 passed: next_set iteration\n");
+
+    // Test 3: Rank and select
+    int values[] = {3, 64, 65, 100, 129};
+    dsalib_bitset_t* from = dsalib_bitset_from_array(values, 5, 130);
+    assert(from != NULL && dsalib_bitset_count(from) == 5);
+    assert(dsalib_bitset_rank(from, 0) == 0 && dsalib_bitset_rank(from, 4) == 1);
+    assert(dsalib_bitset_rank(from, 65) == 2 && dsalib_bitset_rank(from, 1000) == 5);
+    size_t pos = 0;
+    assert(dsalib_bitset_select(from, 2, &pos) && pos == 65);
+    assert(!dsalib_bitset_select(from, 5, &pos));
+    assert(dsalib_bitset_build_index(from));
+    assert(dsalib_bitset_rank(from, 101) == 4);
+    assert(dsalib_bitset_select(from, 4, &pos) && pos == 129);
+    int out[5];
+    assert(dsalib_bitset_to_array(from, out) == 5);
+    for (int i = 0; i < 5; i++) assert(out[i] == values[i]);
+    printf("  ✓ Test 3 passed: Rank, select and conversion\n");
+
+    // Test 4: Invalid input
+    int bad[] = {1, 130};
+    assert(dsalib_bitset_from_array(bad, 2, 130) == NULL);
+    bad[1] = -1;
+    assert(dsalib_bitset_from_array(bad, 2, 130) == NULL);
+    dsalib_bitset_t* other = dsalib_bitset_create(131);
+    assert(!dsalib_bitset_and(bits, other) && !dsalib_bitset_or(bits, NULL));
+    assert(dsalib_bitset_and_count(bits, other) == 0);
+    assert(dsalib_bitset_count(NULL) == 0 && !dsalib_bitset_test(NULL, 0));
+    assert(!dsalib_bitset_select(NULL, 0, &pos) && !dsalib_bitset_build_index(NULL));
+    assert(dsalib_bitset_to_array(NULL, out) == 0);
+    dsalib_bitset_set(NULL, 0);
+    dsalib_bitset_destroy(NULL);
+    dsalib_bitset_t* empty = dsalib_bitset_create(0);
+    assert(empty != NULL && dsalib_bitset_count(empty) == 0 && dsalib_bitset_next_set(empty, 0) == 0);
+    assert(dsalib_bitset_build_index(empty) && !dsalib_bitset_select(empty, 0, &pos));
+    dsalib_bitset_destroy(empty);
+    dsalib_bitset_destroy(other);
+    dsalib_bitset_destroy(from);
+    dsalib_bitset_destroy(bits);
+    printf("  ✓ Test 4 passed: Invalid arguments\n");
+
+    printf("All bitset basic tests passed!\n\n");
+}
+
+void test_bitset_random() {
+    printf("Testing bitset against a bool array...\n");
+
+    // Sizes around word, vector and index-block boundaries
+    size_t sizes[] = {1, 63, 64, 65, 255, 511, 512, 513, 4097, 20000};
+    int densities[] = {1, 50, 99};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        bool* ra = malloc(n * sizeof(bool));
+        bool* rb = malloc(n * sizeof(bool));
+        int* arr = malloc(n * sizeof(int));
+        dsalib_bitset_t* a = dsalib_bitset_create(n);
+        dsalib_bitset_t* b = dsalib_bitset_create(n);
+        for (int d = 0; d < 3; d++) {
+            // Test 1: Set operations and and_count
+            fill_random(a, ra, densities[d]);
+            fill_random(b, rb, densities[(d + 1) % 3]);
+            size_t both = 0;
+            for (size_t i = 0; i < n; i++) both += ra[i] && rb[i];
+            assert(dsalib_bitset_and_count(a, b) == both);
+            assert(dsalib_bitset_or(a, b));
+            for (size_t i = 0; i < n; i++) ra[i] = ra[i] || rb[i];
+            check_equal(a, ra);
+            assert(dsalib_bitset_xor(a, b));
+            for (size_t i = 0; i < n; i++) ra[i] = ra[i] != rb[i];
+            check_equal(a, ra);
+            assert(dsalib_bitset_andnot(b, a));
+            for (size_t i = 0; i < n; i++) rb[i] = rb[i] && !ra[i];
+            check_equal(b, rb);
+            fill_random(a, ra, densities[d]);
+            assert(dsalib_bitset_and(a, b));
+            for (size_t i = 0; i < n; i++) ra[i] = ra[i] && rb[i];
+            check_equal(a, ra);
+
+            // Test 2: Rank, select and next_set, with and without the index
+            fill_random(a, ra, densities[d]);
+            for (int indexed = 0; indexed < 2; indexed++) {
+                if (indexed) assert(dsalib_bitset_build_index(a));
+                size_t rank = 0, next = n;
+                for (size_t i = n; i-- > 0;) {
+                    if (ra[i]) next = i;
+                    assert(dsalib_bitset_next_set(a, i) == next);
+                }
+                for (size_t i = 0; i < n; i++) {
+                    assert(dsalib_bitset_rank(a, i) == rank);
+                    if (ra[i]) {
+                        size_t pos = 0;
+                        assert(dsalib_bitset_select(a, rank, &pos) && pos == i);
+                        rank++;
+                    }
+                }
+                assert(dsalib_bitset_rank(a, n) == rank && !dsalib_bitset_select(a, rank, NULL));
+            }
+
+            // Test 3: Round trip through a sorted array
+            size_t count = dsalib_bitset_to_array(a, arr);
+            assert(count == dsalib_bitset_count(a));
+            for (size_t i = 1; i < count; i++) assert(arr[i - 1] < arr[i]);
+            dsalib_bitset_t* copy = dsalib_bitset_from_array(arr, count, n);
+            check_equal(copy, ra);
+            dsalib_bitset_destroy(copy);
+        }
+        dsalib_bitset_destroy(a);
+        dsalib_bitset_destroy(b);
+        free(ra);
+        free(rb);
+        free(arr);
+    }
+    printf("  ✓ Test 1 passed: and / or / xor / andnot / and_count\n");
+    printf("  ✓ Test 2 passed: rank / select / next_set with and without the index\n");
+    printf("  ✓ Test 3 passed: Sorted array round trip\n");
+
+    // Test 4: Modifications invalidate the index
+    dsalib_bitset_t* bits = dsalib_bitset_create(2000);
+    dsalib_bitset_set(bits, 1500);
+    assert(dsalib_bitset_build_index(bits) && bits->index_valid);
+    dsalib_bitset_set(bits, 10);
+    assert(!bits->index_valid);
+    assert(dsalib_bitset_rank(bits, 1600) == 2 && dsalib_bitset_count(bits) == 2);
+    assert(dsalib_bitset_build_index(bits) && dsalib_bitset_rank(bits, 1600) == 2);
+    dsalib_bitset_destroy(bits);
+    printf("  ✓ Test 4 passed: Stale index is ignored\n");
+
+    printf("All bitset reference tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Bitset Test Suite\n");
+    printf("================================\n\n");
+
+    srand(43);
+    test_bitset_basic();
+    test_bitset_random();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include <dsalib/containers/btree_map.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Walks the leaf chain and checks ordering and the stored size. */
+static void assert_ordered(const dsalib_btree_map_t* map) {
+    dsalib_btree_map_iter_t it = dsalib_btree_map_seek(map, -2147483647 - 1);
+    size_t n = 0;
+    int key, prev = 0;
+    while (dsalib_btree_map_iter_next(&it, &key, NULL)) {
+        assert(n == 0 || prev < key);
+        prev = key;
+        n++;
+    }
+    assert(n == dsalib_btree_map_size(map));
+}
+
+void test_btree_map_basic() {
+    printf("Testing btree_map basics...\n");
+
+    // Test 1: Empty map
+    dsalib_btree_map_t* map = dsalib_btree_map_create();
+    assert(map != NULL);
+    assert(dsalib_btree_map_size(map) == 0);
+    assert(!dsalib_btree_map_find(map, 1, NULL));
+    assert(!dsalib_btree_map_erase(map, 1));
+    printf("  ✓ Test 1 passed: Empty map\n");
+
+    // Test 2: Insert, find and overwrite
+    int value;
+    assert(dsalib_btree_map_insert(map, 10, 100));
+    assert(dsalib_btree_map_insert(map, 5, 50));
+    assert(dsalib_btree_map_insert(map, 10, 101));
+    assert(dsalib_btree_map_size(map) == 2);
+    assert(dsalib_btree_map_find(map, 10, &value) && value == 101);
+    assert(dsalib_btree_map_find(map, 5, &value) && value == 50);
+    printf("  ✓ Test 2 passed: Insert, find and overwrite\n");
+
+    // Test 3: Erase
+    assert(dsalib_btree_map_erase(map, 5));
+    assert(!dsalib_btree_map_find(map, 5, NULL));
+    assert(dsalib_btree_map_size(map) == 1);
+    printf("  ✓ Test 3 passed: Erase\n");
+
+    // Test 4: NULL handling
+    assert(!dsalib_btree_map_insert(NULL, 1, 1));
+    assert(!dsalib_btree_map_find(NULL, 1, NULL));
+    assert(!dsalib_btree_map_erase(NULL, 1));
+    assert(dsalib_btree_map_size(NULL) == 0);
+    dsalib_btree_map_destroy(NULL);
+    printf("  ✓ Test 4 passed: NULL handling\n");
+
+    dsalib_btree_map_destroy(map);
+    printf("All btree_map basic tests passed!\n\n");
+}
+
+void test_btree_map_randomized() {
+    printf("Testing btree_map against a reference array...\n");
+
+    // Test 1: Random inserts and erases across many splits and merges
+    const int universe = 20000;
+    int* present = calloc(universe, sizeof(int));
+    int* values = calloc(universe, sizeof(int));
+    size_t expected = 0;
+    dsalib_btree_map_t* map = dsalib_btree_map_create();
+    for (int step = 0; step < 200000; step++) {
+        int key = rand() % universe;
+        if (rand() % 3 != 0) {
+            int value = rand();
+            assert(dsalib_btree_map_insert(map, key, value));
+            if (!present[key]) expected++;
+            present[key] = 1;
+            values[key] = value;
+        } else {
+            assert(dsalib_btree_map_erase(map, key) == (present[key] != 0));
+            if (present[key]) expected--;
+            present[key] = 0;
+        }
+    }
+    assert(dsalib_btree_map_size(map) == expected);
+    for (int key = 0; key < universe; key++) {
+        int value;
+        assert(dsalib_btree_map_find(map, key, &value) == (present[key] != 0));
+        if (present[key]) assert(value == values[key]);
+    }
+    assert_ordered(map);
+    printf("  ✓ Test 1 passed: %zu keys after mixed operations\n", expected);
+
+    // Test 2: Range scan
+    int keys[64];
+    size_t n = dsalib_btree_map_range(map, 1000, 1100, keys, NULL, 64);
+    size_t want = 0;
+    for (int key = 1000; key < 1100 && want < 64; key++) {
+        if (present[key]) assert(keys[want++] == key);
+    }
+    assert(n == want);
+    printf("  ✓ Test 2 passed: Range scan matches reference\n");
+
+    // Test 3: Erase everything, the tree collapses back to one leaf
+    for (int key = 0; key < universe; key++) {
+        dsalib_btree_map_erase(map, key);
+    }
+    assert(dsalib_btree_map_size(map) == 0);
+    assert(map->height == 1);
+    printf("  ✓ Test 3 passed: Tree shrinks when emptied\n");
+
+    dsalib_btree_map_destroy(map);
+    free(present);
+    free(values);
+    printf("All btree_map randomized tests passed!\n\n");
+}
+
+void test_btree_map_bulk_load() {
+    printf("Testing btree_map_bulk_load...\n");
+
+    // Test 1: Bulk load and look up every key
+    const size_t n = 10007;
+    int* keys = malloc(n * sizeof(int));
+    int* values = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (int)(i * 3);
+        values[i] = (int)i;
+    }
+    dsalib_btree_map_t* map = dsalib_btree_map_bulk_load(keys, values, n);
+    assert(map != NULL);
+    assert(dsalib_btree_map_size(map) == n);
+    for (size_t i = 0; i < n; i++) {
+        int value;
+        assert(dsalib_btree_map_find(map, keys[i], &value) && value == (int)i);
+        assert(!dsalib_btree_map_find(map, keys[i] + 1, NULL));
+    }
+    assert_ordered(map);
+    printf("  ✓ Test 1 passed: %zu keys bulk loaded\n", n);
+
+    // Test 2: The bulk-loaded tree accepts further updates
+    for (size_t i = 0; i < n; i += 2) {
+        assert(dsalib_btree_map_erase(map, keys[i]));
+        assert(dsalib_btree_map_insert(map, keys[i] + 1, -1));
+    }
+    assert(dsalib_btree_map_size(map) == n);
+    assert_ordered(map);
+    printf("  ✓ Test 2 passed: Updates after bulk load\n");
+    dsalib_btree_map_destroy(map);
+
+    // Test 3: Unsorted input and empty input
+    int unsorted[] = {1, 3, 2};
+    assert(dsalib_btree_map_bulk_load(unsorted, unsorted, 3) == NULL);
+    map = dsalib_btree_map_bulk_load(NULL, NULL, 0);
+    assert(map != NULL && dsalib_btree_map_size(map) == 0);
+    dsalib_btree_map_destroy(map);
+    printf("  ✓ Test 3 passed: Invalid and empty input\n");
+
+    free(keys);
+    free(values);
+    printf("All btree_map_bulk_load tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("B+-Tree Map Test Suite\n");
+    printf("================================\n\n");
+
+    srand(28);
+    test_btree_map_basic();
+    test_btree_map_randomized();
+    test_btree_map_bulk_load();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
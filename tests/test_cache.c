@@ -0,0 +1,242 @@
+#include <dsalib/containers/cache.h>
+#include <dsalib/util/parallel.h>
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void test_cache_lru() {
+    printf("Testing LRU cache...\n");
+
+    // Test 1: Least recently used key goes first
+    dsalib_cache_t* cache = dsalib_cache_create(3, DSALIB_CACHE_LRU);
+    assert(cache != NULL);
+    int value;
+    dsalib_cache_put(cache, 1, 10);
+    dsalib_cache_put(cache, 2, 20);
+    dsalib_cache_put(cache, 3, 30);
+    assert(dsalib_cache_get(cache, 1, &value) && value == 10);
+    dsalib_cache_put(cache, 4, 40); // Evicts 2
+    assert(!dsalib_cache_get(cache, 2, NULL));
+    dsalib_cache_put(cache, 3, 31); // Update refreshes 3
+    dsalib_cache_put(cache, 5, 50); // Evicts 1
+    assert(!dsalib_cache_get(cache, 1, NULL));
+    assert(dsalib_cache_get(cache, 3, &value) && value == 31);
+    assert(dsalib_cache_get(cache, 4, &value) && value == 40);
+    assert(dsalib_cache_get(cache, 5, &value) && value == 50);
+    assert(dsalib_cache_size(cache) == 3);
+    printf("  ✓ Test 1 passed: Recency order and updates\n");
+
+    // Test 2: Counters and erase
+    dsalib_cache_stats_t stats = dsalib_cache_stats(cache);
+    assert(stats.hits == 4 && stats.misses == 2 && stats.evictions == 2);
+    assert(dsalib_cache_erase(cache, 4));
+    assert(!dsalib_cache_erase(cache, 4));
+    assert(dsalib_cache_size(cache) == 2);
+    dsalib_cache_put(cache, 6, 60); // Fills the erased slot, no eviction
+    assert(dsalib_cache_stats(cache).evictions == 2);
+    assert(dsalib_cache_get(cache, 3, NULL) && dsalib_cache_get(cache, 5, NULL) && dsalib_cache_get(cache, 6, NULL));
+    dsalib_cache_destroy(cache);
+    printf("  ✓ Test 2 passed: Hit/miss/eviction counters and erase\n");
+
+    printf("All LRU tests passed!\n\n");
+}
+
+void test_cache_clock() {
+    printf("Testing CLOCK cache...\n");
+
+    // Test 1: Referenced keys get a second chance
+    dsalib_cache_t* cache = dsalib_cache_create(3, DSALIB_CACHE_CLOCK);
+    dsalib_cache_put(cache, 1, 10);
+    dsalib_cache_put(cache, 2, 20);
+    dsalib_cache_put(cache, 3, 30);
+    assert(dsalib_cache_get(cache, 1, NULL));
+    dsalib_cache_put(cache, 4, 40); // Hand skips 1, evicts 2
+    assert(!dsalib_cache_get(cache, 2, NULL));
+    assert(dsalib_cache_get(cache, 1, NULL) && dsalib_cache_get(cache, 3, NULL) && dsalib_cache_get(cache, 4, NULL));
+    dsalib_cache_put(cache, 5, 50); // All referenced: a full sweep clears them, evicts 3 at the hand
+    assert(!dsalib_cache_get(cache, 3, NULL));
+    assert(dsalib_cache_get(cache, 1, NULL) && dsalib_cache_get(cache, 4, NULL));
+    assert(dsalib_cache_size(cache) == 3);
+    dsalib_cache_destroy(cache);
+    printf("  ✓ Test 1 passed: Second-chance eviction\n");
+
+    printf("All CLOCK tests passed!\n\n");
+}
+
+void test_cache_s3fifo() {
+    printf("Testing S3-FIFO cache...\n");
+
+    // Test 1: A scan of one-hit keys does not flush a reused working set
+    dsalib_cache_t* cache = dsalib_cache_create(100, DSALIB_CACHE_S3FIFO);
+    for (int round = 0; round < 3; round++) {
+        for (int key = 0; key < 50; key++) {
+            if (!dsalib_cache_get(cache, key, NULL)) dsalib_cache_put(cache, key, key);
+        }
+    }
+    for (int key = 1000; key < 11000; key++) {
+        if (!dsalib_cache_get(cache, key, NULL)) dsalib_cache_put(cache, key, key);
+    }
+    for (int key = 0; key < 50; key++) {
+        assert(dsalib_cache_get(cache, key, NULL));
+    }
+    assert(dsalib_cache_size(cache) == 100);
+    printf("  ✓ Test 1 passed: Working set survives a 10000-key scan\n");
+
+    // Test 2: A recently evicted (ghost) key is readmitted to main
+    dsalib_cache_destroy(cache);
+    cache = dsalib_cache_create(10, DSALIB_CACHE_S3FIFO);
+    for (int key = 0; key < 20; key++) {
+        dsalib_cache_put(cache, key, key);
+    }
+    assert(!dsalib_cache_get(cache, 5, NULL)); // Now a ghost
+    dsalib_cache_put(cache, 5, 100);
+    for (int key = 100; key < 120; key++) {
+        dsalib_cache_put(cache, key, key); // Only churns the small queue
+    }
+    int value;
+    assert(dsalib_cache_get(cache, 5, &value) && value == 100);
+    dsalib_cache_destroy(cache);
+    printf("  ✓ Test 2 passed: Ghost hit bypasses the small queue\n");
+
+    printf("All S3-FIFO tests passed!\n\n");
+}
+
+void test_cache_random() {
+    printf("Testing caches against a reference...\n");
+
+    // Test 1: Every hit returns the latest value; size never exceeds capacity
+    dsalib_cache_policy_t policies[] = {DSALIB_CACHE_LRU, DSALIB_CACHE_CLOCK, DSALIB_CACHE_S3FIFO};
+    size_t capacities[] = {1, 2, 7, 64, 1000};
+    int latest[2048];
+    for (int p = 0; p < 3; p++) {
+        for (int c = 0; c < 5; c++) {
+            dsalib_cache_t* cache = dsalib_cache_create(capacities[c], policies[p]);
+            size_t hits = 0, misses = 0;
+            for (int i = 0; i < 2048; i++) {
+                latest[i] = -1;
+            }
+            for (int op = 0; op < 100000; op++) {
+                int key = rand() % 2048;
+                int roll = rand() % 10;
+                int value;
+                if (roll < 6) {
+                    if (dsalib_cache_get(cache, key, &value)) {
+                        assert(value == latest[key]);
+                        hits++;
+                    } else {
+                        misses++;
+                    }
+                } else if (roll < 9) {
+                    latest[key] = rand();
+                    dsalib_cache_put(cache, key, latest[key]);
+                    assert(dsalib_cache_get(cache, key, &value) && value == latest[key]);
+                    hits++;
+                } else if (dsalib_cache_erase(cache, key)) {
+                    assert(!dsalib_cache_get(cache, key, NULL));
+                    misses++;
+                }
+                assert(dsalib_cache_size(cache) <= capacities[c]);
+            }
+            dsalib_cache_stats_t stats = dsalib_cache_stats(cache);
+            assert(stats.hits == hits && stats.misses == misses);
+            size_t cached = 0, size = dsalib_cache_size(cache);
+            for (int key = 0; key < 2048; key++) {
+                cached += dsalib_cache_erase(cache, key);
+            }
+            assert(cached == size && dsalib_cache_size(cache) == 0);
+            dsalib_cache_destroy(cache);
+        }
+    }
+    printf("  ✓ Test 1 passed: 3 policies x 5 capacities x 100k random operations\n");
+
+    // Test 2: Invalid input
+    assert(dsalib_cache_create(0, DSALIB_CACHE_LRU) == NULL);
+    assert(dsalib_cache_create(4, (dsalib_cache_policy_t)42) == NULL);
+    assert(!dsalib_cache_get(NULL, 1, NULL));
+    assert(!dsalib_cache_put(NULL, 1, 1));
+    assert(!dsalib_cache_erase(NULL, 1));
+    assert(dsalib_cache_stats(NULL).hits == 0);
+    dsalib_cache_destroy(NULL);
+    printf("  ✓ Test 2 passed: Invalid arguments\n");
+
+    printf("All reference tests passed!\n\n");
+}
+
+typedef struct {
+    dsalib_sharded_cache_t* cache;
+    atomic_size_t bad_reads;
+} sharded_ctx_t;
+
+/* Every value ever stored for key is key * 7, so any hit can be checked. */
+static void sharded_worker(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)begin;
+    (void)end;
+    sharded_ctx_t* shared = ctx;
+    uint64_t state = worker + 1;
+    for (int op = 0; op < 50000; op++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        int key = (int)((state >> 33) % 5000);
+        int value;
+        if (dsalib_sharded_cache_get(shared->cache, key, &value)) {
+            if (value != key * 7) atomic_fetch_add(&shared->bad_reads, 1);
+        } else if (op % 16 == 0) {
+            dsalib_sharded_cache_erase(shared->cache, key);
+        } else {
+            dsalib_sharded_cache_put(shared->cache, key, key * 7);
+        }
+    }
+}
+
+void test_sharded_cache() {
+    printf("Testing sharded cache...\n");
+
+    // Test 1: Concurrent gets, puts and erases
+    sharded_ctx_t ctx;
+    ctx.cache = dsalib_sharded_cache_create(8, 1000, DSALIB_CACHE_S3FIFO);
+    assert(ctx.cache != NULL && ctx.cache->num_shards == 8);
+    atomic_init(&ctx.bad_reads, 0);
+    assert(dsalib_parallel_for(4, 4, sharded_worker, &ctx));
+    assert(atomic_load(&ctx.bad_reads) == 0);
+    dsalib_cache_stats_t stats = dsalib_sharded_cache_stats(ctx.cache);
+    assert(stats.hits + stats.misses == 4 * 50000);
+    assert(stats.hits > 0 && stats.evictions > 0);
+    assert(dsalib_sharded_cache_size(ctx.cache) <= 8 * 125);
+    dsalib_sharded_cache_destroy(ctx.cache);
+    printf("  ✓ Test 1 passed: 4 threads, consistent values and counters\n");
+
+    // Test 2: Shard rounding and invalid input
+    dsalib_sharded_cache_t* cache = dsalib_sharded_cache_create(0, 10, DSALIB_CACHE_LRU);
+    assert(cache->num_shards == 16);
+    assert(dsalib_sharded_cache_put(cache, 3, 4));
+    int value;
+    assert(dsalib_sharded_cache_get(cache, 3, &value) && value == 4);
+    dsalib_sharded_cache_destroy(cache);
+    assert(dsalib_sharded_cache_create(4, 0, DSALIB_CACHE_LRU) == NULL);
+    assert(!dsalib_sharded_cache_get(NULL, 1, NULL));
+    assert(dsalib_sharded_cache_size(NULL) == 0);
+    dsalib_sharded_cache_destroy(NULL);
+    printf("  ✓ Test 2 passed: Shard counts and invalid arguments\n");
+
+    printf("All sharded cache tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Cache Test Suite\n");
+    printf("================================\n\n");
+
+    srand(41);
+    test_cache_lru();
+    test_cache_clock();
+    test_cache_s3fifo();
+    test_cache_random();
+    test_sharded_cache();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
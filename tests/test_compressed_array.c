@@ -0,0 +1,127 @@
+#include <dsalib/containers/compressed_array.h>
+#include <dsalib/search/binary_search.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void check_against(const int* arr, size_t n) {
+    dsalib_compressed_array_t* array = dsalib_compressed_array_create(arr, n);
+    assert(array != NULL);
+    assert(dsalib_compressed_array_size(array) == n);
+
+    int* decoded = malloc((n ? n : 1) * sizeof(int));
+    assert(dsalib_compressed_array_decode(array, decoded) == n);
+    for (size_t i = 0; i < n; i++) {
+        assert(decoded[i] == arr[i]);
+    }
+    for (size_t i = 0; i < n; i += 13) {
+        int value;
+        assert(dsalib_compressed_array_get(array, i, &value) && value == arr[i]);
+    }
+    for (size_t i = 0; i < n; i += 7) {
+        int probes[] = {arr[i], arr[i] == INT_MIN ? arr[i] : arr[i] - 1, arr[i] == INT_MAX ? arr[i] : arr[i] + 1};
+        for (int p = 0; p < 3; p++) {
+            size_t expected = dsalib_lower_bound(arr, n, probes[p]);
+            assert(dsalib_compressed_array_lower_bound(array, probes[p]) == expected);
+            assert(dsalib_compressed_array_contains(array, probes[p]) == (expected < n && arr[expected] == probes[p]));
+        }
+    }
+    free(decoded);
+    dsalib_compressed_array_destroy(array);
+}
+
+void test_compressed_array_roundtrip() {
+    printf("Testing compressed_array round-trip...\n");
+
+    // Test 1: Small gaps, including a short last block
+    size_t n = 10000;
+    int* arr = malloc(n * sizeof(int));
+    int value = -5000;
+    for (size_t i = 0; i < n; i++) {
+        value += rand() % 300;
+        arr[i] = value;
+    }
+    check_against(arr, n);
+    printf("  ✓ Test 1 passed: Decode, get, lower_bound and contains match the input\n");
+
+    // Test 2: Constant runs (zero-bit blocks)
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int)(i / 1000);
+    }
+    check_against(arr, n);
+    printf("  ✓ Test 2 passed: Duplicates and zero-width blocks\n");
+
+    // Test 3: Full 32-bit deltas
+    arr[0] = INT_MIN;
+    for (size_t i = 1; i < 300; i++) {
+        arr[i] = INT_MAX;
+    }
+    check_against(arr, 300);
+    printf("  ✓ Test 3 passed: 32-bit deltas across INT_MIN..INT_MAX\n");
+
+    // Test 4: Every size around the block boundary
+    for (size_t size = 0; size <= 260; size++) {
+        for (size_t i = 0; i < size; i++) {
+            arr[i] = (int)(i * 3);
+        }
+        check_against(arr, size);
+    }
+    printf("  ✓ Test 4 passed: Sizes 0..260\n");
+
+    free(arr);
+    printf("All compressed_array round-trip tests passed!\n\n");
+}
+
+void test_compressed_array_edge_cases() {
+    printf("Testing compressed_array edge cases...\n");
+
+    // Test 5: Invalid input
+    int unsorted[] = {3, 1, 2};
+    assert(dsalib_compressed_array_create(unsorted, 3) == NULL);
+    assert(dsalib_compressed_array_create(NULL, 3) == NULL);
+    printf("  ✓ Test 5 passed: Unsorted and NULL input rejected\n");
+
+    // Test 6: NULL handling
+    int value;
+    assert(dsalib_compressed_array_size(NULL) == 0);
+    assert(dsalib_compressed_array_memory(NULL) == 0);
+    assert(dsalib_compressed_array_lower_bound(NULL, 1) == 0);
+    assert(!dsalib_compressed_array_contains(NULL, 1));
+    assert(!dsalib_compressed_array_get(NULL, 0, &value));
+    assert(dsalib_compressed_array_decode(NULL, &value) == 0);
+    dsalib_compressed_array_destroy(NULL);
+    printf("  ✓ Test 6 passed: NULL handled gracefully\n");
+
+    // Test 7: Small deltas compress well
+    size_t n = 1 << 16;
+    int* arr = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = (int)(i * 100);
+    }
+    dsalib_compressed_array_t* array = dsalib_compressed_array_create(arr, n);
+    assert(dsalib_compressed_array_memory(array) * 3 < n * sizeof(int));
+    assert(!dsalib_compressed_array_get(array, n, &value));
+    dsalib_compressed_array_destroy(array);
+    free(arr);
+    printf("  ✓ Test 7 passed: 7-bit deltas use under a third of the raw size\n");
+
+    printf("All compressed_array edge case tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Compressed Array Test Suite\n");
+    printf("================================\n\n");
+
+    srand(31);
+    test_compressed_array_roundtrip();
+    test_compressed_array_edge_cases();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include <dsalib/containers/concurrent_map.h>
+#include <dsalib/util/parallel.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void test_concurrent_map_basic() {
+    printf("Testing concurrent_map basics...\n");
+
+    // Test 1: Insert, overwrite, find and erase
+    dsalib_concurrent_map_t* map = dsalib_concurrent_map_create(4, 0);
+    assert(map != NULL && map->num_shards == 4);
+    int value;
+    assert(!dsalib_concurrent_map_find(map, 7, &value));
+    assert(dsalib_concurrent_map_insert(map, 7, 70));
+    assert(dsalib_concurrent_map_insert(map, INT_MIN, -1));
+    assert(dsalib_concurrent_map_insert(map, INT_MAX, 1));
+    assert(dsalib_concurrent_map_find(map, 7, &value) && value == 70);
+    assert(dsalib_concurrent_map_insert(map, 7, 71));
+    assert(dsalib_concurrent_map_find(map, 7, &value) && value == 71);
+    assert(dsalib_concurrent_map_find(map, INT_MIN, &value) && value == -1);
+    assert(dsalib_concurrent_map_find(map, INT_MAX, NULL));
+    assert(dsalib_concurrent_map_size(map) == 3);
+    assert(dsalib_concurrent_map_erase(map, 7));
+    assert(!dsalib_concurrent_map_erase(map, 7));
+    assert(!dsalib_concurrent_map_find(map, 7, &value));
+    assert(dsalib_concurrent_map_size(map) == 2);
+    dsalib_concurrent_map_destroy(map);
+    printf("  ✓ Test 1 passed: Insert, overwrite, find and erase\n");
+
+    // Test 2: Growth and backward-shift deletion against a reference
+    size_t n = 20000;
+    int* present = calloc(n, sizeof(int));
+    map = dsalib_concurrent_map_create(2, 0);
+    for (int round = 0; round < 200000; round++) {
+        int key = rand() % (int)n;
+        if (rand() % 3) {
+            assert(dsalib_concurrent_map_insert(map, key, key * 3));
+            present[key] = 1;
+        } else {
+            assert(dsalib_concurrent_map_erase(map, key) == (present[key] == 1));
+            present[key] = 0;
+        }
+    }
+    size_t expected = 0;
+    for (size_t key = 0; key < n; key++) {
+        bool found = dsalib_concurrent_map_find(map, (int)key, &value);
+        assert(found == (present[key] == 1));
+        if (found) assert(value == (int)key * 3);
+        expected += present[key];
+    }
+    assert(dsalib_concurrent_map_size(map) == expected);
+    dsalib_concurrent_map_reclaim(map);
+    assert(map->shards[0].retired == NULL);
+    assert(dsalib_concurrent_map_find(map, (int)n / 2, NULL) == (present[n / 2] == 1));
+    dsalib_concurrent_map_destroy(map);
+    free(present);
+    printf("  ✓ Test 2 passed: 200k random inserts/erases match a reference\n");
+
+    // Test 3: Shard rounding and invalid input
+    map = dsalib_concurrent_map_create(5, 1000);
+    assert(map->num_shards == 8);
+    dsalib_concurrent_map_destroy(map);
+    map = dsalib_concurrent_map_create(0, 0);
+    assert(map->num_shards == 64);
+    dsalib_concurrent_map_destroy(map);
+    assert(!dsalib_concurrent_map_insert(NULL, 1, 1));
+    assert(!dsalib_concurrent_map_find(NULL, 1, &value));
+    assert(!dsalib_concurrent_map_erase(NULL, 1));
+    assert(dsalib_concurrent_map_size(NULL) == 0);
+    dsalib_concurrent_map_reclaim(NULL);
+    dsalib_concurrent_map_destroy(NULL);
+    printf("  ✓ Test 3 passed: Shard counts and NULL arguments\n");
+
+    printf("All concurrent_map basic tests passed!\n\n");
+}
+
+#define KEYS_PER_WRITER 20000
+
+typedef struct {
+    dsalib_concurrent_map_t* map;
+    size_t writers;
+    atomic_size_t writers_done;
+    atomic_size_t bad_reads;
+} stress_t;
+
+/*
+ * Workers below `writers` insert their own key range (value = key + 1),
+ * erase every third key and re-insert some of them; the rest read random
+ * keys until the writers finish. Readers only accept "absent" or the one
+ * value a key can ever have.
+ */
+static void stress_worker(void* ctx, size_t begin, size_t end, size_t worker) {
+    (void)begin;
+    (void)end;
+    stress_t* stress = ctx;
+    if (worker < stress->writers) {
+        int base = (int)worker * KEYS_PER_WRITER;
+        for (int k = 0; k < KEYS_PER_WRITER; k++) {
+            dsalib_concurrent_map_insert(stress->map, base + k, base + k + 1);
+        }
+        for (int k = 0; k < KEYS_PER_WRITER; k += 3) {
+            dsalib_concurrent_map_erase(stress->map, base + k);
+        }
+        for (int k = 0; k < KEYS_PER_WRITER; k += 6) {
+            dsalib_concurrent_map_insert(stress->map, base + k, base + k + 1);
+        }
+        atomic_fetch_add(&stress->writers_done, 1);
+        return;
+    }
+    uint64_t state = worker * 0x9E3779B97F4A7C15ULL + 1;
+    int limit = (int)stress->writers * KEYS_PER_WRITER;
+    while (atomic_load(&stress->writers_done) < stress->writers) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        int key = (int)((state >> 33) % (uint64_t)limit);
+        int value;
+        if (dsalib_concurrent_map_find(stress->map, key, &value) && value != key + 1) {
+            atomic_fetch_add(&stress->bad_reads, 1);
+        }
+    }
+}
+
+void test_concurrent_map_threads() {
+    printf("Testing concurrent_map under concurrency...\n");
+
+    // Test 1: Concurrent writers (growing small shards) and readers
+    stress_t stress;
+    stress.map = dsalib_concurrent_map_create(4, 0);
+    stress.writers = 3;
+    atomic_init(&stress.writers_done, 0);
+    atomic_init(&stress.bad_reads, 0);
+    assert(dsalib_parallel_for(6, 6, stress_worker, &stress));
+    assert(atomic_load(&stress.bad_reads) == 0);
+
+    size_t expected = 0;
+    for (int key = 0; key < 3 * KEYS_PER_WRITER; key++) {
+        int local = key % KEYS_PER_WRITER;
+        bool should_exist = local % 3 != 0 || local % 6 == 0;
+        int value;
+        assert(dsalib_concurrent_map_find(stress.map, key, &value) == should_exist);
+        if (should_exist) {
+            assert(value == key + 1);
+            expected++;
+        }
+    }
+    assert(dsalib_concurrent_map_size(stress.map) == expected);
+    dsalib_concurrent_map_destroy(stress.map);
+    printf("  ✓ Test 1 passed: 3 writers and 3 readers, no torn or stale values\n");
+
+    printf("All concurrent_map concurrency tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Concurrent Map Test Suite\n");
+    printf("================================\n\n");
+
+    srand(40);
+    test_concurrent_map_basic();
+    test_concurrent_map_threads();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
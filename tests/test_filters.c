@@ -0,0 +1,139 @@
+#include <dsalib/containers/bloom_filter.h>
+#include <dsalib/containers/cuckoo_filter.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEYS 20000
+
+void test_bloom_filter() {
+    printf("Testing bloom_filter...\n");
+
+    // Test 1: No false negatives
+    int* keys = malloc(KEYS * sizeof(int));
+    for (int i = 0; i < KEYS; i++) {
+        keys[i] = i * 7 + 3;
+    }
+    dsalib_bloom_filter_t* filter = dsalib_bloom_filter_build(keys, KEYS, 0.01);
+    assert(filter != NULL);
+    for (int i = 0; i < KEYS; i++) {
+        assert(dsalib_bloom_filter_contains(filter, keys[i]));
+    }
+    printf("  ✓ Test 1 passed: Every added key is reported present\n");
+
+    // Test 2: False-positive rate near the target
+    size_t false_positives = 0;
+    for (int i = 0; i < KEYS; i++) {
+        false_positives += dsalib_bloom_filter_contains(filter, -1 - i);
+    }
+    assert(false_positives < KEYS * 0.02);
+    printf("  ✓ Test 2 passed: FPR %.4f with 1%% target\n", (double)false_positives / KEYS);
+
+    // Test 3: Batch query matches single queries
+    int probe[] = {3, 10, 17, -5, 24, 31};
+    bool out[6];
+    size_t maybe = dsalib_bloom_filter_contains_batch(filter, probe, 6, out);
+    size_t expected = 0;
+    for (int i = 0; i < 6; i++) {
+        assert(out[i] == dsalib_bloom_filter_contains(filter, probe[i]));
+        expected += out[i];
+    }
+    assert(maybe == expected && out[0] && out[1] && out[2]);
+    printf("  ✓ Test 3 passed: Batch query\n");
+
+    // Test 4: Invalid arguments
+    assert(dsalib_bloom_filter_create(10, 0.0) == NULL);
+    assert(dsalib_bloom_filter_create(10, 1.0) == NULL);
+    assert(!dsalib_bloom_filter_contains(NULL, 3));
+    dsalib_bloom_filter_destroy(NULL);
+    printf("  ✓ Test 4 passed: Invalid arguments\n");
+
+    dsalib_bloom_filter_destroy(filter);
+    free(keys);
+    printf("All bloom_filter tests passed!\n\n");
+}
+
+void test_cuckoo_filter() {
+    printf("Testing cuckoo_filter...\n");
+
+    // Test 1: No false negatives
+    int* keys = malloc(KEYS * sizeof(int));
+    for (int i = 0; i < KEYS; i++) {
+        keys[i] = rand();
+    }
+    dsalib_cuckoo_filter_t* filter = dsalib_cuckoo_filter_build(keys, KEYS, 0.001);
+    assert(filter != NULL);
+    assert(dsalib_cuckoo_filter_size(filter) == KEYS);
+    for (int i = 0; i < KEYS; i++) {
+        assert(dsalib_cuckoo_filter_contains(filter, keys[i]));
+    }
+    printf("  ✓ Test 1 passed: Every added key is reported present\n");
+
+    // Test 2: False-positive rate near the target
+    size_t false_positives = 0;
+    for (int i = 0; i < KEYS; i++) {
+        false_positives += dsalib_cuckoo_filter_contains(filter, -1 - i);
+    }
+    assert(false_positives < KEYS * 0.005);
+    printf("  ✓ Test 2 passed: FPR %.4f with 0.1%% target\n", (double)false_positives / KEYS);
+
+    // Test 3: Deletes
+    for (int i = 0; i < KEYS / 2; i++) {
+        assert(dsalib_cuckoo_filter_remove(filter, keys[i]));
+    }
+    assert(dsalib_cuckoo_filter_size(filter) == KEYS - KEYS / 2);
+    for (int i = KEYS / 2; i < KEYS; i++) {
+        assert(dsalib_cuckoo_filter_contains(filter, keys[i]));
+    }
+    size_t still_reported = 0;
+    for (int i = 0; i < KEYS / 2; i++) {
+        still_reported += dsalib_cuckoo_filter_contains(filter, keys[i]);
+    }
+    assert(still_reported < KEYS * 0.005);
+    printf("  ✓ Test 3 passed: Removed keys disappear, others remain\n");
+
+    // Test 4: Batch query
+    bool* out = malloc(KEYS * sizeof(bool));
+    assert(dsalib_cuckoo_filter_contains_batch(filter, keys + KEYS / 2, KEYS - KEYS / 2, out) == KEYS - KEYS / 2);
+    printf("  ✓ Test 4 passed: Batch query\n");
+
+    // Test 5: Overfilling reports failure instead of losing keys
+    dsalib_cuckoo_filter_t* small = dsalib_cuckoo_filter_create(8, 0.01);
+    int added = 0;
+    while (added < 1000 && dsalib_cuckoo_filter_add(small, added)) added++;
+    assert(added < 1000);
+    for (int i = 0; i < added; i++) {
+        assert(dsalib_cuckoo_filter_contains(small, i));
+    }
+    dsalib_cuckoo_filter_destroy(small);
+    printf("  ✓ Test 5 passed: Full filter rejects inserts (%d stored)\n", added);
+
+    // Test 6: Invalid arguments
+    assert(dsalib_cuckoo_filter_create(10, 2.0) == NULL);
+    assert(!dsalib_cuckoo_filter_add(NULL, 1));
+    assert(!dsalib_cuckoo_filter_remove(NULL, 1));
+    dsalib_cuckoo_filter_destroy(NULL);
+    printf("  ✓ Test 6 passed: Invalid arguments\n");
+
+    free(out);
+    free(keys);
+    dsalib_cuckoo_filter_destroy(filter);
+    printf("All cuckoo_filter tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Membership Filter Test Suite\n");
+    printf("================================\n\n");
+
+    srand(29);
+    test_bloom_filter();
+    test_cuckoo_filter();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
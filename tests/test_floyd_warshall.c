@@ -0,0 +1,142 @@
+#include <dsalib/graph/floyd_warshall.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INF DSALIB_FLOYD_WARSHALL_INF
+
+/* Random directed graph; with negative weights it is a DAG (u < v), so there are no negative cycles. */
+static int* random_matrix(size_t n, size_t m, bool negative) {
+    dsalib_weighted_edge_t* edges = malloc(m * sizeof(dsalib_weighted_edge_t));
+    for (size_t e = 0; e < m; e++) {
+        edges[e].u = (uint32_t)(rand() % (int)n);
+        edges[e].v = (uint32_t)(rand() % (int)n);
+        edges[e].weight = rand() % 1000;
+        if (negative) {
+            if (edges[e].u > edges[e].v) {
+                uint32_t tmp = edges[e].u;
+                edges[e].u = edges[e].v;
+                edges[e].v = tmp;
+            }
+            if (edges[e].u != edges[e].v && rand() % 4 == 0) edges[e].weight = -edges[e].weight;
+        }
+    }
+    int* dist = malloc(n * n * sizeof(int));
+    assert(dsalib_floyd_warshall_init(dist, n, edges, m));
+    free(edges);
+    return dist;
+}
+
+static void check_blocked_matches_naive(size_t n, size_t m, bool negative, size_t num_threads) {
+    int* expected = random_matrix(n, m, negative);
+    int* actual = malloc(n * n * sizeof(int));
+    memcpy(actual, expected, n * n * sizeof(int));
+    assert(dsalib_floyd_warshall_naive(expected, n));
+    assert(dsalib_floyd_warshall(actual, n, num_threads));
+    assert(memcmp(expected, actual, n * n * sizeof(int)) == 0);
+    free(expected);
+    free(actual);
+}
+
+void test_floyd_warshall_basic() {
+    printf("Testing floyd_warshall basics...\n");
+
+    // Test 1: Small graph with a known answer
+    dsalib_weighted_edge_t edges[] = {{0, 1, 4}, {0, 2, 1}, {2, 1, 2}, {1, 3, 1}, {2, 3, 5}, {1, 3, 7}};
+    int dist[16];
+    assert(dsalib_floyd_warshall_init(dist, 4, edges, 6));
+    assert(dist[1 * 4 + 3] == 1);
+    assert(dsalib_floyd_warshall(dist, 4, 1));
+    assert(dist[0 * 4 + 1] == 3);
+    assert(dist[0 * 4 + 3] == 4);
+    assert(dist[2 * 4 + 3] == 3);
+    assert(dist[3 * 4 + 0] == INF);
+    assert(dist[1 * 4 + 1] == 0);
+    printf("  ✓ Test 1 passed: Shortest paths on a 4-vertex graph\n");
+
+    // Test 2: Saturation instead of wrap-around
+    dsalib_weighted_edge_t large[] = {{0, 1, INT_MAX - 1}, {1, 2, 10}, {2, 3, -5}, {3, 4, INT_MIN}, {4, 5, -100}};
+    int sat[36], ref[36];
+    dsalib_floyd_warshall_init(sat, 6, large, 5);
+    memcpy(ref, sat, sizeof(sat));
+    assert(dsalib_floyd_warshall(sat, 6, 1));
+    assert(dsalib_floyd_warshall_naive(ref, 6));
+    assert(sat[0 * 6 + 2] == INT_MAX);
+    assert(sat[2 * 6 + 4] == INT_MIN);
+    assert(sat[3 * 6 + 5] == INT_MIN);
+    assert(sat[5 * 6 + 0] == INF);
+    assert(memcmp(sat, ref, sizeof(sat)) == 0);
+    printf("  ✓ Test 2 passed: Sums clamp at INT_MAX/INT_MIN\n");
+
+    // Test 3: INF plus a negative weight stays INF
+    dsalib_weighted_edge_t negative[] = {{0, 1, -5}, {2, 0, 3}};
+    int neg[9];
+    dsalib_floyd_warshall_init(neg, 3, negative, 2);
+    assert(dsalib_floyd_warshall(neg, 3, 1));
+    assert(neg[0 * 3 + 2] == INF);
+    assert(neg[1 * 3 + 0] == INF);
+    assert(neg[2 * 3 + 1] == -2);
+    printf("  ✓ Test 3 passed: Unreachable pairs stay unreachable\n");
+
+    // Test 4: Negative cycles are reported
+    dsalib_weighted_edge_t cycle[] = {{0, 1, 2}, {1, 2, -3}, {2, 0, -1}};
+    int cyc[9];
+    dsalib_floyd_warshall_init(cyc, 3, cycle, 3);
+    assert(!dsalib_floyd_warshall(cyc, 3, 2));
+    dsalib_floyd_warshall_init(cyc, 3, cycle, 3);
+    assert(!dsalib_floyd_warshall_naive(cyc, 3));
+    printf("  ✓ Test 4 passed: Negative cycle detected\n");
+
+    // Test 5: NULL handling and out-of-range edges
+    dsalib_weighted_edge_t out_of_range[] = {{0, 9, 1}};
+    assert(dsalib_floyd_warshall_init(cyc, 3, out_of_range, 1));
+    assert(cyc[1] == INF && cyc[2] == INF);
+    assert(!dsalib_floyd_warshall_init(NULL, 3, NULL, 0));
+    assert(!dsalib_floyd_warshall_init(cyc, 3, NULL, 1));
+    assert(!dsalib_floyd_warshall(NULL, 3, 1));
+    assert(!dsalib_floyd_warshall_naive(NULL, 3));
+    assert(dsalib_floyd_warshall(cyc, 0, 1));
+    printf("  ✓ Test 5 passed: NULL arguments and invalid edges\n");
+
+    printf("All floyd_warshall basic tests passed!\n\n");
+}
+
+void test_floyd_warshall_blocked() {
+    printf("Testing blocked floyd_warshall...\n");
+
+    // Test 1: Sizes around the tile edge
+    size_t sizes[] = {1, 63, 64, 65, 130};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        check_blocked_matches_naive(sizes[s], sizes[s] * 3, false, 1);
+    }
+    printf("  ✓ Test 1 passed: Partial tiles match the naive loop\n");
+
+    // Test 2: Negative weights
+    check_blocked_matches_naive(200, 800, true, 1);
+    printf("  ✓ Test 2 passed: Negative edges without negative cycles\n");
+
+    // Test 3: Multithreaded phases
+    check_blocked_matches_naive(300, 1500, false, 4);
+    check_blocked_matches_naive(300, 1500, true, 3);
+    printf("  ✓ Test 3 passed: 3 and 4 threads match the naive loop\n");
+
+    printf("All blocked floyd_warshall tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Floyd-Warshall Test Suite\n");
+    printf("================================\n\n");
+
+    srand(36);
+    test_floyd_warshall_basic();
+    test_floyd_warshall_blocked();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <dsalib/graph/mst.h>
+
+#include <assert.h>
+#include <stdio.h>
+
+void test_mst_kruskal() {
+    printf("Testing mst_kruskal...\n");
+
+    // Test 1: Sample graph from docs/graphs.md, treated as undirected
+    dsalib_weighted_edge_t edges[] = {
+        {0, 1, 4},
+        {0, 2, 2},
+        {1, 2, 1},
+        {1, 3, 5},
+        {2, 3, 8},
+        {2, 4, 10},
+        {3, 4, 2},
+        {3, 5, 6},
+        {4, 5, 3},
+    };
+    dsalib_weighted_edge_t out[5];
+    long long total = -1;
+    assert(dsalib_mst_kruskal(6, edges, 9, out, &total) == 5);
+    assert(total == 13);
+    for (size_t i = 1; i < 5; i++) {
+        assert(out[i - 1].weight <= out[i].weight);
+    }
+    printf("  ✓ Test 1 passed: Sample graph MST weight is 13\n");
+
+    // Test 2: Disconnected graph yields a forest
+    dsalib_weighted_edge_t forest[] = {
+        {0, 1, 7},
+        {2, 3, 1},
+        {3, 2, 9},
+    };
+    assert(dsalib_mst_kruskal(4, forest, 3, out, &total) == 2);
+    assert(total == 8);
+    printf("  ✓ Test 2 passed: Spanning forest for disconnected graph\n");
+
+    // Test 3: Invalid arguments
+    assert(dsalib_mst_kruskal(0, edges, 9, out, &total) == 0);
+    assert(total == 0);
+    assert(dsalib_mst_kruskal(6, edges, 9, NULL, NULL) == 0);
+    printf("  ✓ Test 3 passed: Invalid arguments\n");
+
+    printf("All mst_kruskal tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Minimum Spanning Tree Test Suite\n");
+    printf("================================\n\n");
+
+    test_mst_kruskal();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <dsalib/search/linear_search.h>
+#include <dsalib/search/parallel_scan.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool is_multiple(void* ctx, int value) {
+    return value % *(int*)ctx == 0;
+}
+
+static long long reference_find_if(const int* arr, size_t size, int divisor) {
+    for (size_t i = 0; i < size; i++) {
+        if (arr[i] % divisor == 0) return (long long)i;
+    }
+    return -1;
+}
+
+void test_parallel_scan_basic() {
+    printf("Testing parallel_scan basics...\n");
+
+    // Test 1: Small arrays run on the calling thread with the same contract
+    int arr[] = {5, 2, 8, 1, 9, 8, -3, 9};
+    assert(dsalib_parallel_find(arr, 8, 8, 4) == 2);
+    assert(dsalib_parallel_find(arr, 8, 100, 4) == -1);
+    assert(dsalib_parallel_count(arr, 8, 9, 4) == 2);
+    int three = 3;
+    assert(dsalib_parallel_find_if(arr, 8, is_multiple, &three, 4) == 4);
+    dsalib_minmax_t mm;
+    assert(dsalib_parallel_minmax(arr, 8, 4, &mm));
+    assert(mm.min == -3 && mm.min_index == 6 && mm.max == 9 && mm.max_index == 4);
+    assert(dsalib_parallel_minmax(arr, 1, 0, &mm) && mm.min == 5 && mm.max == 5 && mm.max_index == 0);
+    printf("  ✓ Test 1 passed: Small arrays\n");
+
+    // Test 2: Invalid input
+    assert(dsalib_parallel_find(NULL, 5, 1, 2) == -1);
+    assert(dsalib_parallel_find(arr, 0, 5, 2) == -1);
+    assert(dsalib_parallel_find_if(arr, 8, NULL, NULL, 2) == -1);
+    assert(dsalib_parallel_count(NULL, 5, 1, 2) == 0);
+    assert(!dsalib_parallel_minmax(arr, 0, 2, &mm) && !dsalib_parallel_minmax(arr, 8, 2, NULL));
+    printf("  ✓ Test 2 passed: Invalid arguments\n");
+
+    printf("All parallel_scan basic tests passed!\n\n");
+}
+
+void test_parallel_scan_random() {
+    printf("Testing parallel_scan against sequential scans...\n");
+
+    size_t sizes[] = {DSALIB_SCAN_CHUNK - 1, 3 * DSALIB_SCAN_CHUNK, 7 * DSALIB_SCAN_CHUNK + 123};
+    size_t threads[] = {0, 1, 2, 3, 4, 16};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        int* arr = malloc(n * sizeof(int));
+        for (size_t i = 0; i < n; i++) arr[i] = rand() % 1000000;
+        // Extremes repeated in several chunks; the first copy must be reported.
+        arr[n - 5] = INT_MIN;
+        arr[n / 2] = INT_MIN;
+        arr[n / 3] = INT_MAX;
+        arr[n - 1] = INT_MAX;
+        for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+            size_t p = threads[t];
+            // Test 1: Find keeps the first-index contract
+            for (int q = 0; q < 20; q++) {
+                int target = q < 10 ? arr[(size_t)rand() % n] : rand() % 2000000;
+                assert(dsalib_parallel_find(arr, n, target, p) == dsalib_linear_search(arr, n, target));
+            }
+            assert(dsalib_parallel_find(arr, n, INT_MAX, p) == (long long)(n / 3));
+
+            // Test 2: Find with a predicate
+            int divisors[] = {2, 997, 500000, 2000003};
+            for (int d = 0; d < 4; d++) {
+                assert(dsalib_parallel_find_if(arr, n, is_multiple, &divisors[d], p) ==
+                       reference_find_if(arr, n, divisors[d]));
+            }
+
+            // Test 3: Count
+            for (int q = 0; q < 5; q++) {
+                int target = arr[(size_t)rand() % n];
+                size_t expected = 0;
+                for (size_t i = 0; i < n; i++) expected += arr[i] == target;
+                assert(dsalib_parallel_count(arr, n, target, p) == expected);
+            }
+
+            // Test 4: Min / max with first indices
+            dsalib_minmax_t mm;
+            assert(dsalib_parallel_minmax(arr, n, p, &mm));
+            assert(mm.min == INT_MIN && mm.min_index == n / 2);
+            assert(mm.max == INT_MAX && mm.max_index == n / 3);
+        }
+        free(arr);
+    }
+    printf("  ✓ Test 1 passed: find matches dsalib_linear_search\n");
+    printf("  ✓ Test 2 passed: find_if matches a sequential scan\n");
+    printf("  ✓ Test 3 passed: count matches a sequential scan\n");
+    printf("  ✓ Test 4 passed: minmax reports the first extreme\n");
+
+    // Test 5: A match in every chunk; the lowest one wins however workers race
+    size_t n = 16 * DSALIB_SCAN_CHUNK;
+    int* arr = calloc(n, sizeof(int));
+    for (size_t c = 0; c < 16; c++) arr[c * DSALIB_SCAN_CHUNK + DSALIB_SCAN_CHUNK / 2] = 7;
+    for (int rep = 0; rep < 50; rep++) {
+        size_t first = (size_t)(rand() % 16) * DSALIB_SCAN_CHUNK + (size_t)rand() % DSALIB_SCAN_CHUNK;
+        int saved = arr[first];
+        arr[first] = 7;
+        long long expected = dsalib_linear_search(arr, n, 7);
+        assert(dsalib_parallel_find(arr, n, 7, 8) == expected);
+        arr[first] = saved;
+    }
+    free(arr);
+    printf("  ✓ Test 5 passed: Early termination keeps the first match\n");
+
+    printf("All parallel_scan reference tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Parallel Scan Test Suite\n");
+    printf("================================\n\n");
+
+    srand(45);
+    test_parallel_scan_basic();
+    test_parallel_scan_random();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
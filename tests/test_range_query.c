@@ -0,0 +1,219 @@
+#include <dsalib/search/range_query.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void test_sparse_table() {
+    printf("Testing sparse_table...\n");
+
+    // Test 1: Every range of a small array
+    int arr[] = {5, 2, 8, 6, 3, 7, 1, 9, 4};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+    dsalib_sparse_table_t* min_table = dsalib_sparse_table_create(arr, n, DSALIB_RANGE_MIN);
+    dsalib_sparse_table_t* max_table = dsalib_sparse_table_create(arr, n, DSALIB_RANGE_MAX);
+    assert(min_table != NULL && max_table != NULL);
+    assert(min_table->num_levels == 4);
+    for (size_t left = 0; left < n; left++) {
+        int min = INT_MAX, max = INT_MIN;
+        for (size_t right = left + 1; right <= n; right++) {
+            if (arr[right - 1] < min) min = arr[right - 1];
+            if (arr[right - 1] > max) max = arr[right - 1];
+            int value;
+            assert(dsalib_sparse_table_query(min_table, left, right, &value) && value == min);
+            assert(dsalib_sparse_table_query(max_table, left, right, &value) && value == max);
+        }
+    }
+    printf("  ✓ Test 1 passed: All %zu ranges match a scan\n", n * (n + 1) / 2);
+
+    // Test 2: Invalid ranges
+    int value;
+    assert(!dsalib_sparse_table_query(min_table, 3, 3, &value));
+    assert(!dsalib_sparse_table_query(min_table, 4, 2, &value));
+    assert(!dsalib_sparse_table_query(min_table, 0, n + 1, &value));
+    assert(!dsalib_sparse_table_query(NULL, 0, 1, &value));
+    assert(dsalib_sparse_table_create(NULL, 4, DSALIB_RANGE_MIN) == NULL);
+    assert(dsalib_sparse_table_create(arr, 0, DSALIB_RANGE_MIN) == NULL);
+    dsalib_sparse_table_destroy(min_table);
+    dsalib_sparse_table_destroy(max_table);
+    dsalib_sparse_table_destroy(NULL);
+    printf("  ✓ Test 2 passed: Invalid arguments\n");
+
+    // Test 3: Random ranges over a larger array with extreme values
+    n = 10007;
+    int* big = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        big[i] = rand() % 7 == 0 ? (rand() % 2 ? INT_MIN : INT_MAX) : rand() - RAND_MAX / 2;
+    }
+    min_table = dsalib_sparse_table_create(big, n, DSALIB_RANGE_MIN);
+    max_table = dsalib_sparse_table_create(big, n, DSALIB_RANGE_MAX);
+    for (int q = 0; q < 2000; q++) {
+        size_t left = (size_t)rand() % n;
+        size_t right = left + 1 + (size_t)rand() % (n - left);
+        int min = INT_MAX, max = INT_MIN;
+        for (size_t i = left; i < right; i++) {
+            if (big[i] < min) min = big[i];
+            if (big[i] > max) max = big[i];
+        }
+        assert(dsalib_sparse_table_query(min_table, left, right, &value) && value == min);
+        assert(dsalib_sparse_table_query(max_table, left, right, &value) && value == max);
+    }
+    dsalib_sparse_table_destroy(min_table);
+    dsalib_sparse_table_destroy(max_table);
+    free(big);
+    printf("  ✓ Test 3 passed: Random ranges over 10007 elements\n");
+
+    printf("All sparse_table tests passed!\n\n");
+}
+
+void test_fenwick() {
+    printf("Testing fenwick...\n");
+
+    // Test 1: Build matches running sums, then point updates
+    size_t n = 1000;
+    int* arr = malloc(n * sizeof(int));
+    long long* sums = malloc((n + 1) * sizeof(long long));
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = rand() % 2001 - 1000;
+    }
+    dsalib_fenwick_t* fenwick = dsalib_fenwick_create(arr, n);
+    assert(fenwick != NULL);
+    for (int round = 0; round < 50; round++) {
+        sums[0] = 0;
+        for (size_t i = 0; i < n; i++) {
+            sums[i + 1] = sums[i] + arr[i];
+        }
+        for (size_t count = 0; count <= n; count += 7) {
+            assert(dsalib_fenwick_prefix_sum(fenwick, count) == sums[count]);
+        }
+        size_t left = (size_t)rand() % n, right = left + (size_t)rand() % (n - left + 1);
+        assert(dsalib_fenwick_range_sum(fenwick, left, right) == sums[right] - sums[left]);
+
+        size_t index = (size_t)rand() % n;
+        int delta = rand() % 201 - 100;
+        arr[index] += delta;
+        assert(dsalib_fenwick_add(fenwick, index, delta));
+    }
+    assert(dsalib_fenwick_prefix_sum(fenwick, n + 10) == dsalib_fenwick_prefix_sum(fenwick, n));
+    dsalib_fenwick_destroy(fenwick);
+    printf("  ✓ Test 1 passed: Prefix and range sums under point updates\n");
+
+    // Test 2: lower_bound by prefix sum over non-negative weights
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = rand() % 4;
+    }
+    fenwick = dsalib_fenwick_create(arr, n);
+    sums[0] = 0;
+    for (size_t i = 0; i < n; i++) {
+        sums[i + 1] = sums[i] + arr[i];
+    }
+    for (long long target = -1; target <= sums[n] + 1; target++) {
+        size_t expected = 0;
+        while (expected < n && sums[expected + 1] < target) expected++;
+        if (target <= 0) expected = 0;
+        assert(dsalib_fenwick_lower_bound(fenwick, target) == expected);
+    }
+    dsalib_fenwick_destroy(fenwick);
+    printf("  ✓ Test 2 passed: lower_bound finds the first prefix reaching the target\n");
+
+    // Test 3: Empty start, large values and invalid input
+    fenwick = dsalib_fenwick_create(NULL, 5);
+    assert(dsalib_fenwick_prefix_sum(fenwick, 5) == 0);
+    assert(dsalib_fenwick_add(fenwick, 4, INT_MAX));
+    assert(dsalib_fenwick_add(fenwick, 0, INT_MAX));
+    assert(dsalib_fenwick_prefix_sum(fenwick, 5) == 2LL * INT_MAX);
+    assert(dsalib_fenwick_lower_bound(fenwick, (long long)INT_MAX + 1) == 4);
+    assert(!dsalib_fenwick_add(fenwick, 5, 1));
+    assert(dsalib_fenwick_range_sum(fenwick, 3, 2) == 0);
+    dsalib_fenwick_destroy(fenwick);
+    assert(dsalib_fenwick_create(arr, 0) == NULL);
+    assert(!dsalib_fenwick_add(NULL, 0, 1));
+    assert(dsalib_fenwick_prefix_sum(NULL, 3) == 0);
+    assert(dsalib_fenwick_lower_bound(NULL, 3) == 0);
+    dsalib_fenwick_destroy(NULL);
+    printf("  ✓ Test 3 passed: Sums beyond int range and invalid arguments\n");
+
+    free(arr);
+    free(sums);
+    printf("All fenwick tests passed!\n\n");
+}
+
+void test_prefix_sum() {
+    printf("Testing prefix_sum...\n");
+
+    // Test 1: Inclusive and exclusive scans over odd lengths
+    size_t sizes[] = {0, 1, 3, 4, 5, 17, 1001};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        int* arr = malloc((n ? n : 1) * sizeof(int));
+        long long* inclusive = malloc((n ? n : 1) * sizeof(long long));
+        long long* exclusive = malloc((n ? n : 1) * sizeof(long long));
+        for (size_t i = 0; i < n; i++) {
+            arr[i] = rand() % 3 == 0 ? INT_MIN : rand();
+        }
+        assert(dsalib_prefix_sum_inclusive(arr, n, inclusive, 1));
+        assert(dsalib_prefix_sum_exclusive(arr, n, exclusive, 1));
+        long long sum = 0;
+        for (size_t i = 0; i < n; i++) {
+            assert(exclusive[i] == sum);
+            sum += arr[i];
+            assert(inclusive[i] == sum);
+        }
+        free(arr);
+        free(inclusive);
+        free(exclusive);
+    }
+    printf("  ✓ Test 1 passed: Scans match a running sum, including INT_MIN\n");
+
+    // Test 2: Parallel scan over several chunks
+    size_t n = (1 << 20) + 13;
+    int* arr = malloc(n * sizeof(int));
+    long long* expected = malloc(n * sizeof(long long));
+    long long* out = malloc(n * sizeof(long long));
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = rand() - RAND_MAX / 2;
+    }
+    assert(dsalib_prefix_sum_inclusive(arr, n, expected, 1));
+    for (size_t threads = 2; threads <= 4; threads++) {
+        assert(dsalib_prefix_sum_inclusive(arr, n, out, threads));
+        for (size_t i = 0; i < n; i++) {
+            assert(out[i] == expected[i]);
+        }
+        assert(dsalib_prefix_sum_exclusive(arr, n, out, threads));
+        assert(out[0] == 0);
+        for (size_t i = 1; i < n; i++) {
+            assert(out[i] == expected[i - 1]);
+        }
+    }
+    free(arr);
+    free(expected);
+    free(out);
+    printf("  ✓ Test 2 passed: 2-4 threads match the single-threaded scan\n");
+
+    // Test 3: NULL handling
+    long long dummy;
+    int one = 1;
+    assert(!dsalib_prefix_sum_inclusive(NULL, 1, &dummy, 1));
+    assert(!dsalib_prefix_sum_exclusive(&one, 1, NULL, 1));
+    printf("  ✓ Test 3 passed: NULL arguments\n");
+
+    printf("All prefix_sum tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Range Query Test Suite\n");
+    printf("================================\n\n");
+
+    srand(38);
+    test_sparse_table();
+    test_fenwick();
+    test_prefix_sum();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
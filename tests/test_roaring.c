@@ -0,0 +1,173 @@
+#include <dsalib/containers/roaring.h>
+#include <dsalib/search/sorted_set.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define UNIVERSE (1 << 20)
+
+/* Random values: dense runs (bitmap containers) and scattered values (arrays). */
+static size_t random_values(int* out, size_t n) {
+    size_t count = 0;
+    while (count < n) {
+        if (rand() % 4 == 0) {
+            int start = rand() % (UNIVERSE - 10000);
+            for (int i = 0; i < 10000 && count < n; i++) {
+                if (rand() % 3) out[count++] = start + i;
+            }
+        } else {
+            out[count++] = rand() % UNIVERSE;
+        }
+    }
+    return count;
+}
+
+static int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/* Sorts and removes duplicates in place; returns the new size. */
+static size_t make_set(int* arr, size_t n) {
+    qsort(arr, n, sizeof(int), compare_int);
+    size_t m = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (m == 0 || arr[m - 1] != arr[i]) arr[m++] = arr[i];
+    }
+    return m;
+}
+
+static void check_equal(const dsalib_roaring_t* set, const int* expected, size_t n, int* scratch) {
+    assert(dsalib_roaring_cardinality(set) == n);
+    assert(dsalib_roaring_to_array(set, scratch) == n);
+    for (size_t i = 0; i < n; i++) assert(scratch[i] == expected[i]);
+}
+
+void test_roaring_basic() {
+    printf("Testing roaring basics...\n");
+
+    // Test 1: Add, remove, contains
+    dsalib_roaring_t* set = dsalib_roaring_create();
+    assert(set != NULL && dsalib_roaring_cardinality(set) == 0);
+    assert(dsalib_roaring_add(set, 5));
+    assert(!dsalib_roaring_add(set, 5));
+    assert(dsalib_roaring_add(set, 70000) && dsalib_roaring_add(set, 0x7FFFFFFF));
+    assert(set->num_containers == 3);
+    assert(dsalib_roaring_contains(set, 5) && dsalib_roaring_contains(set, 0x7FFFFFFF));
+    assert(!dsalib_roaring_contains(set, 6) && !dsalib_roaring_contains(set, -5));
+    assert(dsalib_roaring_remove(set, 70000) && !dsalib_roaring_remove(set, 70000));
+    assert(set->num_containers == 2 && dsalib_roaring_cardinality(set) == 2);
+    printf("  ✓ Test 1 passed: Add, remove and contains\n");
+
+    // Test 2: Array <-> bitmap container switch
+    size_t sparse = dsalib_roaring_memory(set);
+    for (int i = 0; i < 65536; i++) assert(dsalib_roaring_add(set, 65536 + i));
+    assert(dsalib_roaring_cardinality(set) == 2 + 65536);
+    assert(dsalib_roaring_memory(set) <= sparse + 8192 + 64); // A bitmap, not a 128 KiB array
+    for (int i = 0; i < 65536 - 2 * DSALIB_ROARING_ARRAY_MAX; i++) {
+        assert(dsalib_roaring_remove(set, 65536 + 2 * DSALIB_ROARING_ARRAY_MAX + i));
+    }
+    for (int i = 0; i < 2 * DSALIB_ROARING_ARRAY_MAX; i += 2) assert(dsalib_roaring_remove(set, 65537 + i));
+    assert(dsalib_roaring_cardinality(set) == 2 + DSALIB_ROARING_ARRAY_MAX);
+    assert(dsalib_roaring_contains(set, 65536) && !dsalib_roaring_contains(set, 65537));
+    assert(dsalib_roaring_add(set, 65537) && dsalib_roaring_remove(set, 65536 + 2 * DSALIB_ROARING_ARRAY_MAX - 2));
+    assert(dsalib_roaring_contains(set, 65537) && !dsalib_roaring_contains(set, 65536 + 2 * DSALIB_ROARING_ARRAY_MAX - 2));
+    dsalib_roaring_destroy(set);
+    printf("  ✓ Test 2 passed: Containers switch representation at %d values\n", DSALIB_ROARING_ARRAY_MAX);
+
+    // Test 3: Invalid input
+    int unsorted[] = {3, 1};
+    int negative[] = {-1, 1};
+    assert(dsalib_roaring_from_array(unsorted, 2) == NULL);
+    assert(dsalib_roaring_from_array(negative, 2) == NULL);
+    assert(dsalib_roaring_from_array(NULL, 1) == NULL);
+    dsalib_roaring_t* empty = dsalib_roaring_from_array(NULL, 0);
+    assert(empty != NULL && dsalib_roaring_cardinality(empty) == 0);
+    assert(!dsalib_roaring_add(empty, -1) && !dsalib_roaring_remove(empty, 1));
+    assert(!dsalib_roaring_add(NULL, 1) && !dsalib_roaring_contains(NULL, 1));
+    assert(dsalib_roaring_and(NULL, empty) == NULL && dsalib_roaring_or(empty, NULL) == NULL);
+    assert(dsalib_roaring_cardinality(NULL) == 0 && dsalib_roaring_memory(NULL) == 0);
+    assert(dsalib_roaring_to_array(NULL, unsorted) == 0);
+    dsalib_roaring_destroy(empty);
+    dsalib_roaring_destroy(NULL);
+    printf("  ✓ Test 3 passed: Invalid arguments\n");
+
+    printf("All roaring basic tests passed!\n\n");
+}
+
+void test_roaring_random() {
+    printf("Testing roaring against sorted arrays...\n");
+
+    size_t n = 200000;
+    int* a = malloc(n * sizeof(int));
+    int* b = malloc(n * sizeof(int));
+    int* expected = malloc(2 * n * sizeof(int));
+    int* scratch = malloc(2 * n * sizeof(int));
+    for (int round = 0; round < 5; round++) {
+        size_t na = make_set(a, random_values(a, n / (size_t)(1 + round * 3)));
+        size_t nb = make_set(b, random_values(b, n / (size_t)(5 - round)));
+
+        // Test 1: Conversion both ways
+        dsalib_roaring_t* ra = dsalib_roaring_from_array(a, na);
+        dsalib_roaring_t* rb = dsalib_roaring_from_array(b, nb);
+        check_equal(ra, a, na, scratch);
+        check_equal(rb, b, nb, scratch);
+
+        // Test 2: And / or match the sorted_set kernels
+        dsalib_roaring_t* both = dsalib_roaring_and(ra, rb);
+        check_equal(both, expected, dsalib_sorted_intersect(a, na, b, nb, expected), scratch);
+        dsalib_roaring_t* either = dsalib_roaring_or(ra, rb);
+        check_equal(either, expected, dsalib_sorted_union(a, na, b, nb, expected), scratch);
+
+        // Test 3: Incremental updates match a rebuilt set
+        for (int i = 0; i < 20000; i++) {
+            int v = rand() % UNIVERSE;
+            bool present = dsalib_roaring_contains(ra, v);
+            bool add = rand() % 2;
+            if (add) {
+                assert(dsalib_roaring_add(ra, v) == !present);
+            } else {
+                assert(dsalib_roaring_remove(ra, v) == present);
+            }
+            assert(dsalib_roaring_contains(ra, v) == add);
+        }
+        size_t m = dsalib_roaring_to_array(ra, expected);
+        assert(m == dsalib_roaring_cardinality(ra));
+        for (size_t i = 1; i < m; i++) assert(expected[i - 1] < expected[i]);
+        dsalib_roaring_t* rebuilt = dsalib_roaring_from_array(expected, m);
+        check_equal(rebuilt, expected, m, scratch);
+        for (size_t i = 0; i < m; i += 97) assert(dsalib_roaring_contains(ra, expected[i]));
+
+        dsalib_roaring_destroy(rebuilt);
+        dsalib_roaring_destroy(both);
+        dsalib_roaring_destroy(either);
+        dsalib_roaring_destroy(ra);
+        dsalib_roaring_destroy(rb);
+    }
+    printf("  ✓ Test 1 passed: Sorted array round trip\n");
+    printf("  ✓ Test 2 passed: and / or match dsalib_sorted_intersect / dsalib_sorted_union\n");
+    printf("  ✓ Test 3 passed: Random adds and removes\n");
+
+    free(a);
+    free(b);
+    free(expected);
+    free(scratch);
+    printf("All roaring reference tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Roaring Test Suite\n");
+    printf("================================\n\n");
+
+    srand(43);
+    test_roaring_basic();
+    test_roaring_random();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
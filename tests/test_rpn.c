@@ -0,0 +1,156 @@
+#include <dsalib/math/rpn.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int eval_constant(const char* expression) {
+    int result = 0;
+    assert(dsalib_rpn_evaluate(expression, &result));
+    return result;
+}
+
+static int eval_infix(const char* expression, const char* const* names, size_t num_vars, const int* vars) {
+    dsalib_rpn_program_t* program = dsalib_rpn_compile_infix(expression, names, num_vars);
+    assert(program != NULL);
+    int result = 0;
+    assert(dsalib_rpn_eval(program, vars, &result));
+    dsalib_rpn_destroy(program);
+    return result;
+}
+
+void test_rpn_compile() {
+    printf("Testing RPN compilation...\n");
+
+    // Test 1: Constant RPN expressions (docs/projects.md example)
+    assert(eval_constant("15 7 1 1 + - / 3 * 2 1 1 + + -") == 5);
+    assert(eval_constant("10 5 / 3 *") == 6);
+    assert(eval_constant("3 -4 -") == 7);
+    assert(eval_constant("17 5 %") == 2);
+    printf("  ✓ Test 1 passed: Constant RPN expressions\n");
+
+    // Test 2: Malformed expressions are rejected
+    int result;
+    assert(!dsalib_rpn_evaluate("1 +", &result));
+    assert(!dsalib_rpn_evaluate("1 2", &result));
+    assert(!dsalib_rpn_evaluate("1 x +", &result));
+    assert(!dsalib_rpn_evaluate("", &result));
+    assert(!dsalib_rpn_evaluate("99999999999", &result));
+    assert(!dsalib_rpn_evaluate("1 0 /", &result));
+    assert(dsalib_rpn_compile_infix("(1 + 2", NULL, 0) == NULL);
+    assert(dsalib_rpn_compile_infix("1 + 2)", NULL, 0) == NULL);
+    assert(dsalib_rpn_compile_infix("1 2", NULL, 0) == NULL);
+    assert(dsalib_rpn_compile_infix("1 *", NULL, 0) == NULL);
+    assert(dsalib_rpn_compile_infix("()", NULL, 0) == NULL);
+    assert(dsalib_rpn_compile(NULL, NULL, 0) == NULL);
+    printf("  ✓ Test 2 passed: Malformed expressions rejected\n");
+
+    // Test 3: Constant folding and literal operands
+    const char* names[] = {"a", "b"};
+    dsalib_rpn_program_t* program = dsalib_rpn_compile("a 2 3 * +", names, 2);
+    assert(program->length == 2 && program->code[1].op == DSALIB_RPN_ADD_CONST && program->code[1].arg == 6);
+    assert(program->max_depth == 1);
+    dsalib_rpn_destroy(program);
+    program = dsalib_rpn_compile("a b b * b * +", names, 2);
+    assert(program->max_depth == 3);
+    dsalib_rpn_destroy(program);
+    printf("  ✓ Test 3 passed: Folding and max depth\n");
+
+    printf("All RPN compilation tests passed!\n\n");
+}
+
+void test_rpn_infix() {
+    printf("Testing infix compilation...\n");
+
+    // Test 4: Precedence, associativity, parentheses and unary minus
+    const char* names[] = {"price", "qty", "fee"};
+    int vars[] = {250, 4, 30};
+    assert(eval_infix("1 + 2 * 3", NULL, 0, NULL) == 7);
+    assert(eval_infix("(1 + 2) * 3", NULL, 0, NULL) == 9);
+    assert(eval_infix("20 - 5 - 3", NULL, 0, NULL) == 12);
+    assert(eval_infix("100 / 10 / 5", NULL, 0, NULL) == 2);
+    assert(eval_infix("-2 * -(3 + 1)", NULL, 0, NULL) == 8);
+    assert(eval_infix("(price * qty + fee) / 100 - -qty", names, 3, vars) == 14);
+    assert(eval_infix("price % (qty + 3)", names, 3, vars) == 5);
+    printf("  ✓ Test 4 passed: Infix precedence and variables\n");
+
+    // Test 5: Saturating arithmetic
+    assert(eval_infix("2147483647 + 1", NULL, 0, NULL) == INT_MAX);
+    assert(eval_infix("-2147483647 - 10", NULL, 0, NULL) == INT_MIN);
+    assert(eval_infix("65536 * 65536", NULL, 0, NULL) == INT_MAX);
+    const char* x[] = {"x"};
+    int minimum[] = {INT_MIN};
+    assert(eval_infix("x / -1", x, 1, minimum) == INT_MAX);
+    assert(eval_infix("-x", x, 1, minimum) == INT_MAX);
+    printf("  ✓ Test 5 passed: Saturation at INT_MIN/INT_MAX\n");
+
+    printf("All infix tests passed!\n\n");
+}
+
+void test_rpn_batch() {
+    printf("Testing batched evaluation...\n");
+
+    // Test 6: Batch results match per-row evaluation
+    const char* names[] = {"a", "b", "c"};
+    const size_t rows = 1000;
+    int* a = malloc(rows * sizeof(int));
+    int* b = malloc(rows * sizeof(int));
+    int* c = malloc(rows * sizeof(int));
+    int* out = malloc(rows * sizeof(int));
+    for (size_t i = 0; i < rows; i++) {
+        a[i] = rand() - RAND_MAX / 2;
+        b[i] = rand() % 2000 - 1000;
+        c[i] = rand() % 10; // Some zero divisors
+    }
+    const int* columns[] = {a, b, c};
+    const char* expressions[] = {"(a + b * 3) / c - 7", "a * b % (c - 5)", "-(a - b) * 2 + c"};
+    for (size_t e = 0; e < 3; e++) {
+        dsalib_rpn_program_t* program = dsalib_rpn_compile_infix(expressions[e], names, 3);
+        assert(program != NULL);
+        size_t ok = dsalib_rpn_eval_batch(program, columns, rows, out);
+        size_t expected_ok = 0;
+        for (size_t i = 0; i < rows; i++) {
+            int vars[] = {a[i], b[i], c[i]};
+            int value;
+            if (dsalib_rpn_eval(program, vars, &value)) {
+                assert(out[i] == value);
+                expected_ok++;
+            } else {
+                assert(out[i] == 0);
+            }
+        }
+        assert(ok == expected_ok);
+        dsalib_rpn_destroy(program);
+    }
+    printf("  ✓ Test 6 passed: Batch matches scalar, division by zero counted\n");
+
+    // Test 7: NULL handling
+    assert(dsalib_rpn_eval_batch(NULL, columns, rows, out) == 0);
+    assert(!dsalib_rpn_eval(NULL, NULL, out));
+    dsalib_rpn_destroy(NULL);
+    printf("  ✓ Test 7 passed: NULL handled gracefully\n");
+
+    free(a);
+    free(b);
+    free(c);
+    free(out);
+    printf("All batched evaluation tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("RPN Engine Test Suite\n");
+    printf("================================\n\n");
+
+    srand(34);
+    test_rpn_compile();
+    test_rpn_infix();
+    test_rpn_batch();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
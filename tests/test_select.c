@@ -0,0 +1,217 @@
+#include <dsalib/search/select.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/* arr[rank] equals sorted[rank] and arr is partitioned around it. */
+static void check_selected(const int* arr, const int* sorted, size_t size, size_t rank) {
+    assert(arr[rank] == sorted[rank]);
+    for (size_t i = 0; i < rank; i++) {
+        assert(arr[i] <= arr[rank]);
+    }
+    for (size_t i = rank + 1; i < size; i++) {
+        assert(arr[i] >= arr[rank]);
+    }
+}
+
+/* Fills arr with one of several adversarial or realistic patterns. */
+static void fill(int* arr, size_t size, int pattern) {
+    for (size_t i = 0; i < size; i++) {
+        switch (pattern) {
+        case 0: arr[i] = rand() - RAND_MAX / 2; break;
+        case 1: arr[i] = rand() % 8; break;
+        case 2: arr[i] = (int)i; break;
+        case 3: arr[i] = (int)(size - i); break;
+        case 4: arr[i] = 42; break;
+        default: arr[i] = i % 2 ? INT_MAX : INT_MIN; break;
+        }
+    }
+}
+
+void test_nth_element() {
+    printf("Testing nth_element...\n");
+
+    // Test 1: Several patterns and ranks
+    size_t sizes[] = {1, 2, 15, 17, 100, 5000};
+    int* arr = malloc(5000 * sizeof(int));
+    int* sorted = malloc(5000 * sizeof(int));
+    int* original = malloc(5000 * sizeof(int));
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        for (int pattern = 0; pattern < 6; pattern++) {
+            fill(original, size, pattern);
+            memcpy(sorted, original, size * sizeof(int));
+            qsort(sorted, size, sizeof(int), compare_int);
+            size_t ranks[] = {0, size / 2, size - 1, dsalib_quantile_rank(size, 0.99)};
+            for (int r = 0; r < 4; r++) {
+                memcpy(arr, original, size * sizeof(int));
+                assert(dsalib_nth_element(arr, size, ranks[r]));
+                check_selected(arr, sorted, size, ranks[r]);
+            }
+        }
+    }
+    printf("  ✓ Test 1 passed: Random, duplicate, sorted, reversed and constant inputs\n");
+
+    // Test 2: Median-of-three killer input still selects correctly
+    size_t size = 4096;
+    for (size_t i = 0; i < size / 2; i++) {
+        arr[i] = i % 2 ? (int)(size / 2 + i) : (int)(i + 1);
+        arr[size / 2 + i] = (int)(2 * (i + 1));
+    }
+    memcpy(sorted, arr, size * sizeof(int));
+    qsort(sorted, size, sizeof(int), compare_int);
+    assert(dsalib_nth_element(arr, size, size / 2));
+    check_selected(arr, sorted, size, size / 2);
+    printf("  ✓ Test 2 passed: Adversarial pattern\n");
+
+    // Test 3: Invalid input
+    assert(!dsalib_nth_element(NULL, 4, 0));
+    assert(!dsalib_nth_element(arr, 4, 4));
+    assert(!dsalib_nth_element(arr, 0, 0));
+    printf("  ✓ Test 3 passed: Invalid arguments\n");
+
+    free(arr);
+    free(sorted);
+    free(original);
+    printf("All nth_element tests passed!\n\n");
+}
+
+void test_multi_select() {
+    printf("Testing multi_select...\n");
+
+    // Test 1: p50/p90/p99/p99.9 in one call
+    size_t size = 100000;
+    int* arr = malloc(size * sizeof(int));
+    int* sorted = malloc(size * sizeof(int));
+    for (int pattern = 0; pattern < 2; pattern++) {
+        fill(arr, size, pattern);
+        memcpy(sorted, arr, size * sizeof(int));
+        qsort(sorted, size, sizeof(int), compare_int);
+        double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+        size_t ranks[4];
+        for (int q = 0; q < 4; q++) {
+            ranks[q] = dsalib_quantile_rank(size, quantiles[q]);
+        }
+        assert(dsalib_multi_select(arr, size, ranks, 4));
+        for (int q = 0; q < 4; q++) {
+            check_selected(arr, sorted, size, ranks[q]);
+        }
+    }
+    printf("  ✓ Test 1 passed: Four quantiles selected and partitioned\n");
+
+    // Test 2: Duplicate and extreme ranks
+    fill(arr, 1000, 0);
+    memcpy(sorted, arr, 1000 * sizeof(int));
+    qsort(sorted, 1000, sizeof(int), compare_int);
+    size_t ranks[] = {0, 0, 1, 500, 500, 998, 999};
+    assert(dsalib_multi_select(arr, 1000, ranks, 7));
+    for (int r = 0; r < 7; r++) {
+        assert(arr[ranks[r]] == sorted[ranks[r]]);
+    }
+    printf("  ✓ Test 2 passed: Repeated ranks and both ends\n");
+
+    // Test 3: Invalid input and quantile ranks
+    size_t unsorted[] = {5, 3};
+    size_t too_large[] = {1000};
+    assert(!dsalib_multi_select(arr, 1000, unsorted, 2));
+    assert(!dsalib_multi_select(arr, 1000, too_large, 1));
+    assert(!dsalib_multi_select(NULL, 1000, ranks, 1));
+    assert(dsalib_multi_select(arr, 1000, ranks, 0));
+    assert(dsalib_quantile_rank(100, 0.5) == 49);
+    assert(dsalib_quantile_rank(100, 0.99) == 98);
+    assert(dsalib_quantile_rank(100, 1.5) == 99);
+    assert(dsalib_quantile_rank(100, -1.0) == 0);
+    assert(dsalib_quantile_rank(0, 0.5) == 0);
+    printf("  ✓ Test 3 passed: Invalid arguments and quantile ranks\n");
+
+    free(arr);
+    free(sorted);
+    printf("All multi_select tests passed!\n\n");
+}
+
+void test_topk() {
+    printf("Testing topk...\n");
+
+    // Test 1: Array and single pushes agree with sorting
+    size_t size = 100003;
+    int* arr = malloc(size * sizeof(int));
+    int* sorted = malloc(size * sizeof(int));
+    fill(arr, size, 0);
+    memcpy(sorted, arr, size * sizeof(int));
+    qsort(sorted, size, sizeof(int), compare_int);
+    size_t k = 100;
+    dsalib_topk_t* batch = dsalib_topk_create(k);
+    dsalib_topk_t* single = dsalib_topk_create(k);
+    assert(dsalib_topk_push_array(batch, arr, size / 2));
+    assert(dsalib_topk_push_array(batch, arr + size / 2, size - size / 2));
+    for (size_t i = 0; i < size; i++) {
+        dsalib_topk_push(single, arr[i]);
+    }
+    int top[100], top_single[100];
+    assert(dsalib_topk_result(batch, top) == k);
+    assert(dsalib_topk_result(single, top_single) == k);
+    for (size_t i = 0; i < k; i++) {
+        assert(top[i] == sorted[size - 1 - i]);
+        assert(top_single[i] == top[i]);
+    }
+    int threshold;
+    assert(dsalib_topk_threshold(batch, &threshold) && threshold == sorted[size - k]);
+    printf("  ✓ Test 1 passed: Top 100 of 100003 match a full sort\n");
+
+    // Test 2: Fewer values than k, ascending input and duplicates
+    dsalib_topk_reset(batch);
+    assert(!dsalib_topk_threshold(batch, &threshold));
+    int few[] = {3, 1, 3, 2};
+    assert(dsalib_topk_push_array(batch, few, 4));
+    assert(dsalib_topk_result(batch, top) == 4);
+    assert(top[0] == 3 && top[1] == 3 && top[2] == 2 && top[3] == 1);
+    dsalib_topk_destroy(batch);
+
+    batch = dsalib_topk_create(3);
+    fill(arr, 1000, 2);
+    assert(dsalib_topk_push_array(batch, arr, 1000));
+    assert(dsalib_topk_result(batch, top) == 3);
+    assert(top[0] == 999 && top[1] == 998 && top[2] == 997);
+    assert(!dsalib_topk_push(batch, 997));
+    assert(dsalib_topk_push(batch, 2000));
+    printf("  ✓ Test 2 passed: Partial fill, ascending input and ties\n");
+
+    // Test 3: Invalid input
+    assert(dsalib_topk_create(0) == NULL);
+    assert(!dsalib_topk_push(NULL, 1));
+    assert(!dsalib_topk_push_array(batch, NULL, 4));
+    assert(dsalib_topk_result(NULL, top) == 0);
+    dsalib_topk_destroy(batch);
+    dsalib_topk_destroy(single);
+    dsalib_topk_destroy(NULL);
+    printf("  ✓ Test 3 passed: Invalid arguments\n");
+
+    free(arr);
+    free(sorted);
+    printf("All topk tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Selection Test Suite\n");
+    printf("================================\n\n");
+
+    srand(39);
+    test_nth_element();
+    test_multi_select();
+    test_topk();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <dsalib/containers/sliding_window.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void brute_force(const int* arr, size_t begin, size_t end, int* min, int* max, long long* sum) {
+    *min = INT_MAX;
+    *max = INT_MIN;
+    *sum = 0;
+    for (size_t i = begin; i < end; i++) {
+        if (arr[i] < *min) *min = arr[i];
+        if (arr[i] > *max) *max = arr[i];
+        *sum += arr[i];
+    }
+}
+
+void test_sliding_window_stream() {
+    printf("Testing sliding_window streaming...\n");
+
+    // Test 1: Small example, including the partially filled window
+    int data[] = {5, 1, 4, 2, 8, 3, 3, 7};
+    int expected_min[] = {5, 1, 1, 1, 2, 2, 3, 3};
+    int expected_max[] = {5, 5, 5, 4, 8, 8, 8, 7};
+    dsalib_sliding_window_t* w = dsalib_sliding_window_create(3);
+    assert(w != NULL);
+    int value;
+    assert(!dsalib_sliding_window_min(w, &value));
+    for (size_t i = 0; i < 8; i++) {
+        assert(dsalib_sliding_window_push(w, data[i]));
+        assert(dsalib_sliding_window_min(w, &value) && value == expected_min[i]);
+        assert(dsalib_sliding_window_max(w, &value) && value == expected_max[i]);
+    }
+    assert(dsalib_sliding_window_count(w) == 3);
+    assert(dsalib_sliding_window_sum(w) == 13);
+    dsalib_sliding_window_destroy(w);
+    printf("  ✓ Test 1 passed: Min/max/sum over a window of 3\n");
+
+    // Test 2: Random streams against brute force, windows that are and are not powers of two
+    size_t n = 5000;
+    int* arr = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = rand() % 1000 - 500;
+    }
+    size_t windows[] = {1, 2, 7, 16, 100, 4999, 5000, 6000};
+    for (size_t k = 0; k < sizeof(windows) / sizeof(windows[0]); k++) {
+        w = dsalib_sliding_window_create(windows[k]);
+        for (size_t i = 0; i < n; i++) {
+            dsalib_sliding_window_push(w, arr[i]);
+            size_t begin = i + 1 > windows[k] ? i + 1 - windows[k] : 0;
+            int min, max;
+            long long sum;
+            brute_force(arr, begin, i + 1, &min, &max, &sum);
+            assert(dsalib_sliding_window_min(w, &value) && value == min);
+            assert(dsalib_sliding_window_max(w, &value) && value == max);
+            assert(dsalib_sliding_window_sum(w) == sum);
+        }
+        dsalib_sliding_window_reset(w);
+        assert(dsalib_sliding_window_count(w) == 0 && dsalib_sliding_window_sum(w) == 0);
+        dsalib_sliding_window_destroy(w);
+    }
+    free(arr);
+    printf("  ✓ Test 2 passed: Random streams match brute force\n");
+
+    // Test 3: Sum overflow detection
+    w = dsalib_sliding_window_create(4);
+    dsalib_sliding_window_push(w, INT_MAX);
+    assert(dsalib_sliding_window_sum_int(w, &value) && value == INT_MAX);
+    dsalib_sliding_window_push(w, 1);
+    assert(!dsalib_sliding_window_sum_int(w, &value) && value == INT_MAX);
+    assert(dsalib_sliding_window_sum(w) == (long long)INT_MAX + 1);
+    for (int i = 0; i < 4; i++) {
+        dsalib_sliding_window_push(w, INT_MIN);
+    }
+    assert(!dsalib_sliding_window_sum_int(w, &value) && value == INT_MIN);
+    assert(dsalib_sliding_window_sum(w) == 4LL * INT_MIN);
+    dsalib_sliding_window_destroy(w);
+    printf("  ✓ Test 3 passed: Sums beyond int range are detected and clamped\n");
+
+    // Test 4: Invalid input
+    assert(dsalib_sliding_window_create(0) == NULL);
+    assert(!dsalib_sliding_window_push(NULL, 1));
+    assert(!dsalib_sliding_window_min(NULL, &value));
+    assert(!dsalib_sliding_window_sum_int(NULL, &value));
+    assert(dsalib_sliding_window_count(NULL) == 0);
+    assert(dsalib_sliding_window_sum(NULL) == 0);
+    dsalib_sliding_window_destroy(NULL);
+    printf("  ✓ Test 4 passed: Invalid arguments\n");
+
+    printf("All sliding_window streaming tests passed!\n\n");
+}
+
+void test_sliding_window_array() {
+    printf("Testing sliding_window array functions...\n");
+
+    // Test 1: Small and large windows against brute force
+    size_t n = 3001;
+    int* arr = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = rand() - RAND_MAX / 2;
+    }
+    int* mins = malloc(n * sizeof(int));
+    int* maxs = malloc(n * sizeof(int));
+    long long* sums = malloc(n * sizeof(long long));
+    size_t windows[] = {1, 2, 3, 5, 8, 9, 16, 33, 1000, 1501, 3000, 3001};
+    for (size_t k = 0; k < sizeof(windows) / sizeof(windows[0]); k++) {
+        size_t window = windows[k];
+        size_t count = n - window + 1;
+        assert(dsalib_sliding_min(arr, n, window, mins) == count);
+        assert(dsalib_sliding_max(arr, n, window, maxs) == count);
+        assert(dsalib_sliding_sum(arr, n, window, sums) == count);
+        for (size_t i = 0; i < count; i++) {
+            int min, max;
+            long long sum;
+            brute_force(arr, i, i + window, &min, &max, &sum);
+            assert(mins[i] == min && maxs[i] == max && sums[i] == sum);
+        }
+    }
+    printf("  ✓ Test 1 passed: Min/max/sum of every window match brute force\n");
+
+    // Test 2: Extreme values and sorted runs
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = i % 3 == 0 ? INT_MIN : (i % 3 == 1 ? INT_MAX : (int)i);
+    }
+    assert(dsalib_sliding_min(arr, n, 2, mins) == n - 1);
+    assert(dsalib_sliding_max(arr, n, 20, maxs) == n - 19);
+    for (size_t i = 0; i + 1 < n; i++) {
+        assert(mins[i] == INT_MIN || (i % 3 == 1 && mins[i] == (int)(i + 1)));
+    }
+    for (size_t i = 0; i + 19 < n; i++) {
+        assert(maxs[i] == INT_MAX);
+    }
+    printf("  ✓ Test 2 passed: INT_MIN/INT_MAX inputs\n");
+
+    // Test 3: Invalid input
+    assert(dsalib_sliding_min(arr, n, 0, mins) == 0);
+    assert(dsalib_sliding_min(arr, n, n + 1, mins) == 0);
+    assert(dsalib_sliding_max(NULL, n, 4, maxs) == 0);
+    assert(dsalib_sliding_sum(arr, n, 4, NULL) == 0);
+    printf("  ✓ Test 3 passed: Invalid arguments\n");
+
+    free(arr);
+    free(mins);
+    free(maxs);
+    free(sums);
+    printf("All sliding_window array tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Sliding Window Test Suite\n");
+    printf("================================\n\n");
+
+    srand(37);
+    test_sliding_window_stream();
+    test_sliding_window_array();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
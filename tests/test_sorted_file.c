@@ -0,0 +1,129 @@
+#include <dsalib/search/binary_search.h>
+#include <dsalib/search/sorted_file.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_PATH "test_sorted_file.bin"
+
+static int* make_sorted(size_t size) {
+    int* arr = malloc(size * sizeof(int));
+    for (size_t i = 0; i < size; i++) {
+        arr[i] = (int)(i / 3) * 5 - 1000; // Includes duplicates and negatives
+    }
+    return arr;
+}
+
+void test_sorted_file_roundtrip() {
+    printf("Testing sorted_file write/open...\n");
+
+    const size_t n = 100000;
+    int* arr = make_sorted(n);
+
+    // Test 1: Array-only file
+    assert(dsalib_sorted_file_write(TEST_PATH, arr, n, NULL));
+    dsalib_sorted_file_t* file = dsalib_sorted_file_open(TEST_PATH, DSALIB_SORTED_FILE_VERIFY);
+    assert(file != NULL);
+    assert(file->size == n && file->fences == NULL && !file->has_bloom);
+    assert(((size_t)file->data % DSALIB_SORTED_FILE_ALIGNMENT) == 0);
+    for (size_t i = 0; i < n; i += 97) {
+        assert(file->data[i] == arr[i]);
+    }
+    dsalib_sorted_file_close(file);
+    printf("  ✓ Test 1 passed: Array round-trips through the mapping\n");
+
+    // Test 2: Fences and bloom give the same answers as a plain search
+    dsalib_sorted_file_options_t options = {64, 0.01};
+    assert(dsalib_sorted_file_write(TEST_PATH, arr, n, &options));
+    file = dsalib_sorted_file_open(TEST_PATH, DSALIB_SORTED_FILE_VERIFY | DSALIB_SORTED_FILE_WILLNEED |
+                                                  DSALIB_SORTED_FILE_HUGEPAGE | DSALIB_SORTED_FILE_POPULATE);
+    assert(file != NULL);
+    assert(file->fences != NULL && file->fence_stride == 64 && file->has_bloom);
+    for (int target = -1010; target < 170000; target += 7) {
+        size_t expected = dsalib_lower_bound(arr, n, target);
+        assert(dsalib_sorted_file_lower_bound(file, target) == expected);
+        int found = dsalib_sorted_file_search(file, target);
+        if (expected < n && arr[expected] == target) {
+            assert(found >= 0 && arr[found] == target);
+        } else {
+            assert(found == -1);
+        }
+    }
+    dsalib_sorted_file_close(file);
+    printf("  ✓ Test 2 passed: Fence and bloom sections match plain search\n");
+
+    // Test 3: Empty array
+    assert(dsalib_sorted_file_write(TEST_PATH, NULL, 0, &options));
+    file = dsalib_sorted_file_open(TEST_PATH, DSALIB_SORTED_FILE_VERIFY);
+    assert(file != NULL && file->size == 0);
+    assert(dsalib_sorted_file_lower_bound(file, 5) == 0);
+    assert(dsalib_sorted_file_search(file, 5) == -1);
+    dsalib_sorted_file_close(file);
+    printf("  ✓ Test 3 passed: Empty array\n");
+
+    free(arr);
+    printf("All sorted_file round-trip tests passed!\n\n");
+}
+
+void test_sorted_file_validation() {
+    printf("Testing sorted_file validation...\n");
+
+    int arr[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // Test 1: Unsorted input is rejected by the writer
+    int unsorted[] = {3, 1, 2};
+    assert(!dsalib_sorted_file_write(TEST_PATH, unsorted, 3, NULL));
+    printf("  ✓ Test 1 passed: Unsorted input rejected\n");
+
+    // Test 2: Corrupted payload fails checksum verification
+    assert(dsalib_sorted_file_write(TEST_PATH, arr, 8, NULL));
+    FILE* f = fopen(TEST_PATH, "r+b");
+    assert(f != NULL);
+    fseek(f, DSALIB_SORTED_FILE_ALIGNMENT + 4, SEEK_SET);
+    fputc(0x7F, f);
+    fclose(f);
+    assert(dsalib_sorted_file_open(TEST_PATH, DSALIB_SORTED_FILE_VERIFY) == NULL);
+    dsalib_sorted_file_t* file = dsalib_sorted_file_open(TEST_PATH, 0);
+    assert(file != NULL); // Without VERIFY only the header is checked
+    dsalib_sorted_file_close(file);
+    printf("  ✓ Test 2 passed: Checksum mismatch detected\n");
+
+    // Test 3: Bad magic and truncated files
+    assert(dsalib_sorted_file_write(TEST_PATH, arr, 8, NULL));
+    f = fopen(TEST_PATH, "r+b");
+    fputc('X', f);
+    fclose(f);
+    assert(dsalib_sorted_file_open(TEST_PATH, 0) == NULL);
+    f = fopen(TEST_PATH, "wb");
+    fputs("DSASORT", f);
+    fclose(f);
+    assert(dsalib_sorted_file_open(TEST_PATH, 0) == NULL);
+    printf("  ✓ Test 3 passed: Bad magic and truncated file rejected\n");
+
+    // Test 4: Missing file and NULL arguments
+    remove(TEST_PATH);
+    assert(dsalib_sorted_file_open(TEST_PATH, 0) == NULL);
+    assert(dsalib_sorted_file_open(NULL, 0) == NULL);
+    assert(!dsalib_sorted_file_write(NULL, arr, 8, NULL));
+    assert(dsalib_sorted_file_search(NULL, 1) == -1);
+    dsalib_sorted_file_close(NULL);
+    printf("  ✓ Test 4 passed: Missing file and NULL arguments\n");
+
+    printf("All sorted_file validation tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Sorted File Test Suite\n");
+    printf("================================\n\n");
+
+    test_sorted_file_roundtrip();
+    test_sorted_file_validation();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
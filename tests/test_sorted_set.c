@@ -0,0 +1,236 @@
+#include <dsalib/search/sorted_set.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Builds a sorted, duplicate-free array with random gaps in [1, max_gap]. */
+static int* make_set(size_t size, int start, int max_gap) {
+    int* arr = malloc((size ? size : 1) * sizeof(int));
+    int value = start;
+    for (size_t i = 0; i < size; i++) {
+        value += 1 + rand() % max_gap;
+        arr[i] = value;
+    }
+    return arr;
+}
+
+static int contains(const int* arr, size_t size, int x) {
+    for (size_t i = 0; i < size; i++) {
+        if (arr[i] == x) return 1;
+    }
+    return 0;
+}
+
+static size_t naive_intersect(const int* a, size_t na, const int* b, size_t nb, int* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < na; i++) {
+        if (contains(b, nb, a[i])) out[n++] = a[i];
+    }
+    return n;
+}
+
+static size_t naive_difference(const int* a, size_t na, const int* b, size_t nb, int* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < na; i++) {
+        if (!contains(b, nb, a[i])) out[n++] = a[i];
+    }
+    return n;
+}
+
+static int cmp_int(const void* x, const void* y) {
+    int a = *(const int*)x;
+    int b = *(const int*)y;
+    return (a > b) - (a < b);
+}
+
+void test_intersect() {
+    printf("Testing sorted_intersect...\n");
+
+    // Test 1: Basic overlap
+    int a[] = {1, 3, 5, 7, 9, 11, 13, 15, 17};
+    int b[] = {2, 3, 4, 7, 8, 9, 10, 15, 16, 17, 20};
+    int out[16];
+    int expected[] = {3, 7, 9, 15, 17};
+    assert(dsalib_sorted_intersect(a, 9, b, 11, out) == 5);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    printf("  ✓ Test 1 passed: Basic overlap\n");
+
+    // Test 2: All three strategies agree
+    assert(dsalib_sorted_intersect_merge(a, 9, b, 11, out) == 5);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    assert(dsalib_sorted_intersect_gallop(a, 9, b, 11, out) == 5);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    printf("  ✓ Test 2 passed: Merge and gallop agree\n");
+
+    // Test 3: Empty and NULL inputs
+    assert(dsalib_sorted_intersect(a, 9, NULL, 0, out) == 0);
+    assert(dsalib_sorted_intersect(NULL, 0, b, 11, out) == 0);
+    assert(dsalib_sorted_intersect(NULL, 5, b, 11, out) == 0);
+    assert(dsalib_sorted_intersect(a, 9, b, 11, NULL) == 0);
+    printf("  ✓ Test 3 passed: Empty and NULL inputs\n");
+
+    // Test 4: Randomized against naive reference, across size ratios
+    size_t ratios[] = {1, 2, 7, 31, 32, 100, 1000};
+    for (size_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++) {
+        size_t nl = 3000;
+        size_t ns = nl / ratios[r];
+        int* l = make_set(nl, -5000, 4);
+        int* s = make_set(ns, -5000, (int)(4 * ratios[r]));
+        int* got = malloc(ns * sizeof(int) + sizeof(int));
+        int* want = malloc(ns * sizeof(int) + sizeof(int));
+        size_t n_want = naive_intersect(s, ns, l, nl, want);
+        size_t n_got = dsalib_sorted_intersect(s, ns, l, nl, got);
+        assert(n_got == n_want && memcmp(got, want, n_want * sizeof(int)) == 0);
+        n_got = dsalib_sorted_intersect_merge(l, nl, s, ns, got);
+        assert(n_got == n_want && memcmp(got, want, n_want * sizeof(int)) == 0);
+        n_got = dsalib_sorted_intersect_gallop(l, nl, s, ns, got);
+        assert(n_got == n_want && memcmp(got, want, n_want * sizeof(int)) == 0);
+        free(l);
+        free(s);
+        free(got);
+        free(want);
+    }
+    printf("  ✓ Test 4 passed: Randomized inputs match reference\n");
+
+    printf("All sorted_intersect tests passed!\n\n");
+}
+
+void test_union() {
+    printf("Testing sorted_union...\n");
+
+    // Test 1: Basic union
+    int a[] = {1, 4, 6, 9};
+    int b[] = {2, 4, 7, 9, 12};
+    int out[16];
+    int expected[] = {1, 2, 4, 6, 7, 9, 12};
+    assert(dsalib_sorted_union(a, 4, b, 5, out) == 7);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    printf("  ✓ Test 1 passed: Basic union\n");
+
+    // Test 2: One side empty
+    assert(dsalib_sorted_union(a, 4, NULL, 0, out) == 4);
+    assert(memcmp(out, a, sizeof(a)) == 0);
+    printf("  ✓ Test 2 passed: One side empty\n");
+
+    // Test 3: Randomized (both strategies) against qsort + dedup
+    size_t ratios[] = {1, 3, 50, 500};
+    for (size_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++) {
+        size_t nl = 2000;
+        size_t ns = nl / ratios[r];
+        int* l = make_set(nl, 0, 3);
+        int* s = make_set(ns, 0, (int)(3 * ratios[r]));
+        int* want = malloc((ns + nl) * sizeof(int));
+        int* got = malloc((ns + nl) * sizeof(int));
+        memcpy(want, l, nl * sizeof(int));
+        memcpy(want + nl, s, ns * sizeof(int));
+        qsort(want, ns + nl, sizeof(int), cmp_int);
+        size_t n_want = 0;
+        for (size_t i = 0; i < ns + nl; i++) {
+            if (n_want == 0 || want[n_want - 1] != want[i]) want[n_want++] = want[i];
+        }
+        assert(dsalib_sorted_union(s, ns, l, nl, got) == n_want);
+        assert(memcmp(got, want, n_want * sizeof(int)) == 0);
+        assert(dsalib_sorted_union(l, nl, s, ns, got) == n_want);
+        assert(memcmp(got, want, n_want * sizeof(int)) == 0);
+        free(l);
+        free(s);
+        free(want);
+        free(got);
+    }
+    printf("  ✓ Test 3 passed: Randomized inputs match reference\n");
+
+    printf("All sorted_union tests passed!\n\n");
+}
+
+void test_difference() {
+    printf("Testing sorted_difference...\n");
+
+    // Test 1: Basic difference
+    int a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    int b[] = {2, 3, 5, 8, 13};
+    int out[16];
+    int expected[] = {1, 4, 6, 7, 9, 10};
+    assert(dsalib_sorted_difference(a, 10, b, 5, out) == 6);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    printf("  ✓ Test 1 passed: Basic difference\n");
+
+    // Test 2: Nothing to remove / everything removed
+    assert(dsalib_sorted_difference(a, 10, NULL, 0, out) == 10);
+    assert(dsalib_sorted_difference(a, 10, a, 10, out) == 0);
+    printf("  ✓ Test 2 passed: Nothing or everything removed\n");
+
+    // Test 3: Randomized in both directions and ratios
+    size_t ratios[] = {1, 2, 40, 400};
+    for (size_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++) {
+        size_t nl = 2000;
+        size_t ns = nl / ratios[r];
+        int* l = make_set(nl, 100, 3);
+        int* s = make_set(ns, 100, (int)(3 * ratios[r]));
+        int* want = malloc(nl * sizeof(int));
+        int* got = malloc(nl * sizeof(int));
+        size_t n_want = naive_difference(l, nl, s, ns, want);
+        assert(dsalib_sorted_difference(l, nl, s, ns, got) == n_want);
+        assert(memcmp(got, want, n_want * sizeof(int)) == 0);
+        n_want = naive_difference(s, ns, l, nl, want);
+        assert(dsalib_sorted_difference(s, ns, l, nl, got) == n_want);
+        assert(memcmp(got, want, n_want * sizeof(int)) == 0);
+        free(l);
+        free(s);
+        free(want);
+        free(got);
+    }
+    printf("  ✓ Test 3 passed: Randomized inputs match reference\n");
+
+    printf("All sorted_difference tests passed!\n\n");
+}
+
+void test_merge_k() {
+    printf("Testing sorted_merge_k...\n");
+
+    // Test 1: Three lists with duplicates
+    int l0[] = {1, 4, 4, 9};
+    int l1[] = {2, 4, 10};
+    int l2[] = {0, 3};
+    const int* lists[] = {l0, l1, l2};
+    size_t sizes[] = {4, 3, 2};
+    size_t work[6];
+    int out[9];
+    int expected[] = {0, 1, 2, 3, 4, 4, 4, 9, 10};
+    assert(dsalib_sorted_merge_k(lists, sizes, 3, work, out) == 9);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    printf("  ✓ Test 1 passed: Merge three lists\n");
+
+    // Test 2: Empty lists are skipped
+    size_t sizes2[] = {0, 3, 0};
+    assert(dsalib_sorted_merge_k(lists, sizes2, 3, work, out) == 3);
+    assert(out[0] == 2 && out[1] == 4 && out[2] == 10);
+    assert(dsalib_sorted_merge_k(lists, sizes, 0, work, out) == 0);
+    printf("  ✓ Test 2 passed: Empty lists\n");
+
+    // Test 3: NULL arguments
+    assert(dsalib_sorted_merge_k(NULL, sizes, 3, work, out) == 0);
+    assert(dsalib_sorted_merge_k(lists, sizes, 3, NULL, out) == 0);
+    printf("  ✓ Test 3 passed: NULL arguments\n");
+
+    printf("All sorted_merge_k tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Sorted Set Operations Test Suite\n");
+    printf("================================\n\n");
+
+    srand(26);
+    test_intersect();
+    test_union();
+    test_difference();
+    test_merge_k();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
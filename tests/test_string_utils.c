@@ -0,0 +1,160 @@
+#include <dsalib/util/string_utils.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool span_equals(dsalib_string_span_t span, const char* text) {
+    return span.length == strlen(text) && memcmp(span.data, text, span.length) == 0;
+}
+
+void test_string_scanning() {
+    printf("Testing string scanning...\n");
+
+    // Test 1: Length at every alignment and size
+    char buf[300];
+    for (size_t offset = 0; offset < 16; offset++) {
+        for (size_t len = 0; len < 200; len++) {
+            memset(buf, 'x', sizeof(buf));
+            buf[offset + len] = '\0';
+            assert(dsalib_string_length(buf + offset) == len);
+        }
+    }
+    assert(dsalib_string_length(NULL) == 0);
+    printf("  ✓ Test 1 passed: Length matches strlen\n");
+
+    // Test 2: Byte search and count agree with memchr
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = (char)('a' + rand() % 20);
+    }
+    for (size_t len = 0; len < sizeof(buf); len += 7) {
+        for (char c = 'a'; c < 'z'; c++) {
+            assert(dsalib_string_find_byte(buf, len, c) == memchr(buf, c, len));
+            size_t expected = 0;
+            for (size_t i = 0; i < len; i++) expected += buf[i] == c;
+            assert(dsalib_string_count_byte(buf, len, c) == expected);
+        }
+    }
+    assert(dsalib_string_find_byte(NULL, 10, 'a') == NULL);
+    printf("  ✓ Test 2 passed: find_byte and count_byte\n");
+
+    // Test 3: Substring search agrees with a naive scan
+    const char* needles[] = {"ab", "abc", "hello", "aaaa", "xyz", "dcba"};
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = (char)('a' + rand() % 4);
+    }
+    memcpy(buf + 250, "hello", 5);
+    for (size_t n = 0; n < sizeof(needles) / sizeof(needles[0]); n++) {
+        size_t nlen = strlen(needles[n]);
+        const char* expected = NULL;
+        for (size_t i = 0; i + nlen <= sizeof(buf) && !expected; i++) {
+            if (memcmp(buf + i, needles[n], nlen) == 0) expected = buf + i;
+        }
+        assert(dsalib_string_find(buf, sizeof(buf), needles[n], nlen) == expected);
+    }
+    assert(dsalib_string_find(buf, sizeof(buf), "c", 1) == memchr(buf, 'c', sizeof(buf)));
+    assert(dsalib_string_find(buf, 10, "", 0) == buf);
+    assert(dsalib_string_find("ab", 2, "abc", 3) == NULL);
+    printf("  ✓ Test 3 passed: Substring search\n");
+
+    printf("All string scanning tests passed!\n\n");
+}
+
+void test_string_split() {
+    printf("Testing string splitting...\n");
+
+    // Test 4: Fields, including empty ones
+    const char* csv = "alpha,,beta,gamma,";
+    dsalib_string_span_t spans[8];
+    size_t n = dsalib_string_split(csv, strlen(csv), ',', spans, 8);
+    assert(n == 5);
+    assert(span_equals(spans[0], "alpha") && span_equals(spans[1], "") && span_equals(spans[2], "beta"));
+    assert(span_equals(spans[3], "gamma") && span_equals(spans[4], ""));
+    assert(dsalib_string_split(csv, strlen(csv), ',', NULL, 0) == 5);
+    assert(dsalib_string_split(csv, strlen(csv), ',', spans, 2) == 5);
+    printf("  ✓ Test 4 passed: Split with empty fields and sizing call\n");
+
+    // Test 5: Lines with CRLF, long input crossing 64-byte chunks
+    char text[4096];
+    size_t len = 0;
+    for (int line = 0; line < 100; line++) {
+        len += (size_t)sprintf(text + len, "line %d%s\n", line, line % 3 == 0 ? "\r" : "");
+    }
+    dsalib_string_span_t lines[128];
+    assert(dsalib_string_split_lines(text, len, lines, 128) == 100);
+    for (int line = 0; line < 100; line++) {
+        char expected[32];
+        sprintf(expected, "line %d", line);
+        assert(span_equals(lines[line], expected));
+    }
+    assert(dsalib_string_split_lines("a\nb", 3, lines, 128) == 2 && span_equals(lines[1], "b"));
+    assert(dsalib_string_split_lines("", 0, lines, 128) == 0);
+    assert(dsalib_string_split_lines(NULL, 0, lines, 128) == 0);
+    printf("  ✓ Test 5 passed: Line splitting\n");
+
+    printf("All string split tests passed!\n\n");
+}
+
+void test_string_parse() {
+    printf("Testing int parsing...\n");
+
+    // Test 6: Single values
+    int value;
+    dsalib_string_span_t span = {"-2147483648", 11};
+    assert(dsalib_string_parse_int(span, &value) && value == INT_MIN);
+    span = (dsalib_string_span_t){"+2147483647", 11};
+    assert(dsalib_string_parse_int(span, &value) && value == INT_MAX);
+    span = (dsalib_string_span_t){"2147483648", 10};
+    assert(!dsalib_string_parse_int(span, &value));
+    span = (dsalib_string_span_t){"12a", 3};
+    assert(!dsalib_string_parse_int(span, &value));
+    span = (dsalib_string_span_t){"-", 1};
+    assert(!dsalib_string_parse_int(span, &value));
+    printf("  ✓ Test 6 passed: parse_int bounds and rejects\n");
+
+    // Test 7: Bulk parsing against strtol
+    char text[1 << 16];
+    int expected[4096];
+    size_t len = 0;
+    for (int i = 0; i < 4096; i++) {
+        expected[i] = rand() - RAND_MAX / 2;
+        len += (size_t)sprintf(text + len, i % 2 ? "%d, " : "%d\n", expected[i]);
+    }
+    int parsed[4096];
+    size_t consumed;
+    assert(dsalib_string_parse_ints(text, len, parsed, 4096, &consumed) == 4096);
+    assert(memcmp(parsed, expected, sizeof(expected)) == 0);
+    printf("  ✓ Test 7 passed: Bulk parse of 4096 values\n");
+
+    // Test 8: Stopping early and resuming
+    const char* small = "1 2 3 -4 99999999999 5";
+    size_t got = dsalib_string_parse_ints(small, strlen(small), parsed, 2, &consumed);
+    assert(got == 2 && parsed[1] == 2);
+    size_t offset = consumed;
+    got = dsalib_string_parse_ints(small + offset, strlen(small) - offset, parsed, 10, &consumed);
+    assert(got == 2 && parsed[0] == 3 && parsed[1] == -4);
+    assert(strncmp(small + offset + consumed, "99999999999", 11) == 0);
+    assert(dsalib_string_parse_ints(NULL, 5, parsed, 10, &consumed) == 0 && consumed == 0);
+    printf("  ✓ Test 8 passed: Early stop, overflow and resume\n");
+
+    printf("All int parsing tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("String Utils Test Suite\n");
+    printf("================================\n\n");
+
+    srand(33);
+    test_string_scanning();
+    test_string_split();
+    test_string_parse();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include <dsalib/containers/timer_wheel.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    uint64_t expires;     // Expected firing tick
+    dsalib_timer_id_t id; // 0 when not pending
+    int fired;            // Times the callback ran
+} record_t;
+
+typedef struct {
+    dsalib_timer_wheel_t* wheel;
+    uint64_t last; // Tick of the previous callback
+    size_t fired;  // Callbacks so far
+} fire_ctx_t;
+
+/* Checks each timer fires once, exactly at its expiry, in expiry order. */
+static void on_fire(void* ctx, dsalib_timer_id_t timer, void* data) {
+    fire_ctx_t* fire = ctx;
+    record_t* record = data;
+    assert(record->id == timer);
+    assert(record->expires == fire->wheel->now);
+    assert(fire->wheel->now >= fire->last);
+    assert(!dsalib_timer_wheel_cancel(fire->wheel, timer));
+    fire->last = fire->wheel->now;
+    record->fired++;
+    record->id = 0;
+    fire->fired++;
+}
+
+static uint64_t random_delay(void) {
+    switch (rand() % 5) {
+    case 0: return (uint64_t)(rand() % 300);
+    case 1: return (uint64_t)(rand() % 70000);
+    case 2: return (uint64_t)rand() % 20000000;
+    case 3: return ((uint64_t)rand() << 8) + (uint64_t)(rand() % 256);
+    default: return ((uint64_t)1 << 33) + (uint64_t)rand();
+    }
+}
+
+void test_timer_wheel_basic() {
+    printf("Testing timer_wheel basics...\n");
+
+    // Test 1: Timers fire at their tick, across a cascade boundary
+    dsalib_timer_wheel_t* wheel = dsalib_timer_wheel_create(250, 0);
+    assert(wheel != NULL);
+    record_t records[4] = {{251, 0, 0}, {256, 0, 0}, {300, 0, 0}, {70000, 0, 0}};
+    fire_ctx_t fire = {wheel, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        records[i].id = dsalib_timer_wheel_schedule(wheel, records[i].expires, &records[i]);
+        assert(records[i].id != 0);
+    }
+    assert(dsalib_timer_wheel_size(wheel) == 4);
+    assert(dsalib_timer_wheel_advance(wheel, 255, on_fire, &fire) == 1);
+    assert(records[0].fired == 1 && records[1].fired == 0);
+    assert(dsalib_timer_wheel_advance(wheel, 299, on_fire, &fire) == 1);
+    assert(dsalib_timer_wheel_advance(wheel, 300, on_fire, &fire) == 1);
+    assert(dsalib_timer_wheel_advance(wheel, 69999, on_fire, &fire) == 0);
+    assert(dsalib_timer_wheel_advance(wheel, 1000000, on_fire, &fire) == 1);
+    assert(wheel->now == 1000000 && dsalib_timer_wheel_size(wheel) == 0);
+    printf("  ✓ Test 1 passed: Exact expiry across wheel levels\n");
+
+    // Test 2: Cancel, stale ids and past expiries
+    record_t a = {0, 0, 0}, b = {1000001, 0, 0};
+    a.id = dsalib_timer_wheel_schedule(wheel, 5, &a); // In the past: due next tick
+    a.expires = 1000001;
+    b.id = dsalib_timer_wheel_schedule(wheel, b.expires, &b);
+    dsalib_timer_id_t cancelled = b.id;
+    assert(dsalib_timer_wheel_cancel(wheel, b.id));
+    assert(!dsalib_timer_wheel_cancel(wheel, cancelled));
+    b.id = 0;
+    record_t c = {1000001, 0, 0};
+    c.id = dsalib_timer_wheel_schedule(wheel, c.expires, &c); // Reuses b's node
+    assert(c.id != cancelled && (uint32_t)c.id == (uint32_t)cancelled);
+    assert(!dsalib_timer_wheel_cancel(wheel, cancelled));
+    assert(dsalib_timer_wheel_advance(wheel, 1000001, on_fire, &fire) == 2);
+    assert(a.fired == 1 && b.fired == 0 && c.fired == 1);
+    assert(!dsalib_timer_wheel_cancel(wheel, 0));
+    assert(!dsalib_timer_wheel_cancel(wheel, (dsalib_timer_id_t)1 << 32 | 123456));
+    dsalib_timer_wheel_destroy(wheel);
+    printf("  ✓ Test 2 passed: Cancel, stale ids and past expiries\n");
+
+    // Test 3: Invalid input
+    assert(dsalib_timer_wheel_schedule(NULL, 1, NULL) == 0);
+    assert(!dsalib_timer_wheel_cancel(NULL, 1));
+    assert(dsalib_timer_wheel_advance(NULL, 1, on_fire, NULL) == 0);
+    assert(dsalib_timer_wheel_size(NULL) == 0);
+    dsalib_timer_wheel_destroy(NULL);
+    printf("  ✓ Test 3 passed: Invalid arguments\n");
+
+    printf("All timer_wheel basic tests passed!\n\n");
+}
+
+/* Reschedules the timer once from inside the callback. */
+static void on_fire_reschedule(void* ctx, dsalib_timer_id_t timer, void* data) {
+    fire_ctx_t* fire = ctx;
+    record_t* record = data;
+    assert(record->id == timer && record->expires == fire->wheel->now);
+    record->fired++;
+    record->id = 0;
+    fire->fired++;
+    if (record->fired == 1) {
+        record->expires = fire->wheel->now + 1000;
+        record->id = dsalib_timer_wheel_schedule(fire->wheel, record->expires, record);
+    }
+}
+
+void test_timer_wheel_random() {
+    printf("Testing timer_wheel against a reference...\n");
+
+    // Test 1: Random schedules, cancels and advances over all four wheels
+    size_t n = 20000;
+    record_t* records = calloc(n, sizeof(record_t));
+    dsalib_timer_wheel_t* wheel = dsalib_timer_wheel_create(12345, 16);
+    fire_ctx_t fire = {wheel, 0, 0};
+    size_t scheduled = 0, cancelled = 0;
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 200; i++) {
+            record_t* record = &records[(size_t)rand() % n];
+            if (record->id) {
+                assert(dsalib_timer_wheel_cancel(wheel, record->id));
+                record->id = 0;
+                cancelled++;
+            } else {
+                record->expires = wheel->now + 1 + random_delay();
+                record->fired = 0;
+                record->id = dsalib_timer_wheel_schedule(wheel, record->expires, record);
+                scheduled++;
+            }
+        }
+        uint64_t target = wheel->now + (round % 10 == 9 ? (uint64_t)rand() << 4 : (uint64_t)(rand() % 100000));
+        fire.last = wheel->now;
+        dsalib_timer_wheel_advance(wheel, target, on_fire, &fire);
+        assert(wheel->now == target);
+        for (size_t i = 0; i < n; i++) {
+            assert(records[i].fired <= 1);
+            assert(records[i].id == 0 || records[i].expires > target);
+        }
+    }
+    assert(dsalib_timer_wheel_size(wheel) == scheduled - cancelled - fire.fired);
+    dsalib_timer_wheel_advance(wheel, wheel->now + ((uint64_t)1 << 40), on_fire, &fire);
+    assert(dsalib_timer_wheel_size(wheel) == 0);
+    assert(fire.fired == scheduled - cancelled);
+    printf("  ✓ Test 1 passed: %zu schedules, %zu cancels, every timer fired on time\n", scheduled, cancelled);
+
+    // Test 2: Callbacks that schedule new timers
+    for (size_t i = 0; i < 1000; i++) {
+        records[i].expires = wheel->now + 1 + (uint64_t)(rand() % 5000);
+        records[i].fired = 0;
+        records[i].id = dsalib_timer_wheel_schedule(wheel, records[i].expires, &records[i]);
+    }
+    fire.fired = 0;
+    dsalib_timer_wheel_advance(wheel, wheel->now + 10000, on_fire_reschedule, &fire);
+    assert(fire.fired == 2000 && dsalib_timer_wheel_size(wheel) == 0);
+    printf("  ✓ Test 2 passed: Rescheduling from the callback\n");
+
+    dsalib_timer_wheel_destroy(wheel);
+    free(records);
+    printf("All timer_wheel reference tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Timer Wheel Test Suite\n");
+    printf("================================\n\n");
+
+    srand(42);
+    test_timer_wheel_basic();
+    test_timer_wheel_random();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
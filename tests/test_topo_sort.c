@@ -0,0 +1,261 @@
+#include <dsalib/graph/topo_sort.h>
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Random DAG: edges always go from lower to higher rank under a shuffled ranking. */
+static dsalib_csr_graph_t* random_dag(size_t n, size_t m) {
+    uint32_t* rank = malloc(n * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++) {
+        rank[i] = (uint32_t)i;
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = (size_t)rand() % (i + 1);
+        uint32_t tmp = rank[i];
+        rank[i] = rank[j];
+        rank[j] = tmp;
+    }
+    dsalib_edge_t* edges = malloc(m * sizeof(dsalib_edge_t));
+    for (size_t e = 0; e < m; e++) {
+        size_t a = (size_t)rand() % n;
+        size_t b = (size_t)rand() % n;
+        if (a == b) b = (b + 1) % n;
+        if (a > b) {
+            size_t tmp = a;
+            a = b;
+            b = tmp;
+        }
+        edges[e].u = rank[a];
+        edges[e].v = rank[b];
+    }
+    dsalib_csr_graph_t* graph = dsalib_csr_graph_create(n, edges, m);
+    free(edges);
+    free(rank);
+    return graph;
+}
+
+/* True if order is a permutation in which every edge points forward. */
+static bool is_topological(const dsalib_csr_graph_t* graph, const uint32_t* order) {
+    size_t n = graph->num_nodes;
+    size_t* position = malloc(n * sizeof(size_t));
+    for (size_t i = 0; i < n; i++) {
+        position[i] = SIZE_MAX;
+    }
+    bool ok = true;
+    for (size_t i = 0; i < n; i++) {
+        if (position[order[i]] != SIZE_MAX) ok = false;
+        position[order[i]] = i;
+    }
+    for (size_t u = 0; ok && u < n; u++) {
+        size_t count;
+        const uint32_t* next = dsalib_csr_graph_successors(graph, u, &count);
+        for (size_t i = 0; i < count; i++) {
+            if (position[u] >= position[next[i]]) ok = false;
+        }
+    }
+    free(position);
+    return ok;
+}
+
+typedef struct {
+    const dsalib_csr_graph_t* graph;
+    _Atomic uint32_t* finished; // 1 once a node's task has returned
+    _Atomic size_t runs;
+    _Atomic size_t violations; // Tasks that started before a predecessor finished
+    uint32_t* predecessors;    // Flattened reverse adjacency
+    size_t* predecessor_offsets;
+} executor_check_t;
+
+static void check_task(void* ctx, uint32_t node) {
+    executor_check_t* check = ctx;
+    for (size_t i = check->predecessor_offsets[node]; i < check->predecessor_offsets[node + 1]; i++) {
+        if (!atomic_load(&check->finished[check->predecessors[i]])) atomic_fetch_add(&check->violations, 1);
+    }
+    atomic_fetch_add(&check->runs, 1);
+    atomic_store(&check->finished[node], 1);
+}
+
+static void run_checked(const dsalib_csr_graph_t* graph, size_t num_threads, bool* ok, size_t* runs, size_t* violations) {
+    size_t n = graph->num_nodes;
+    executor_check_t check;
+    check.graph = graph;
+    check.finished = malloc(n * sizeof(_Atomic uint32_t));
+    for (size_t i = 0; i < n; i++) {
+        atomic_init(&check.finished[i], 0);
+    }
+    atomic_init(&check.runs, 0);
+    atomic_init(&check.violations, 0);
+
+    // Reverse the graph so each task can look up its predecessors.
+    dsalib_edge_t* reversed = malloc((graph->num_edges ? graph->num_edges : 1) * sizeof(dsalib_edge_t));
+    size_t e = 0;
+    for (size_t u = 0; u < n; u++) {
+        for (size_t i = graph->offsets[u]; i < graph->offsets[u + 1]; i++) {
+            reversed[e].u = graph->targets[i];
+            reversed[e].v = (uint32_t)u;
+            e++;
+        }
+    }
+    dsalib_csr_graph_t* reverse = dsalib_csr_graph_create(n, reversed, graph->num_edges);
+    check.predecessors = reverse->targets;
+    check.predecessor_offsets = reverse->offsets;
+
+    *ok = dsalib_dag_execute(graph, num_threads, check_task, &check);
+    *runs = atomic_load(&check.runs);
+    *violations = atomic_load(&check.violations);
+
+    dsalib_csr_graph_destroy(reverse);
+    free(reversed);
+    free((void*)check.finished);
+}
+
+void test_csr_graph() {
+    printf("Testing csr_graph...\n");
+
+    // Test 1: Successors are grouped by source and keep input order
+    dsalib_edge_t edges[] = {{2, 0}, {0, 1}, {2, 3}, {0, 3}};
+    dsalib_csr_graph_t* graph = dsalib_csr_graph_create(4, edges, 4);
+    assert(graph != NULL);
+    assert(graph->num_edges == 4);
+    size_t count;
+    const uint32_t* next = dsalib_csr_graph_successors(graph, 0, &count);
+    assert(count == 2 && next[0] == 1 && next[1] == 3);
+    next = dsalib_csr_graph_successors(graph, 2, &count);
+    assert(count == 2 && next[0] == 0 && next[1] == 3);
+    assert(dsalib_csr_graph_out_degree(graph, 1) == 0);
+    assert(dsalib_csr_graph_out_degree(graph, 4) == 0);
+    assert(dsalib_csr_graph_successors(graph, 4, &count) == NULL);
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 1 passed: Adjacency matches the edge list\n");
+
+    // Test 2: Invalid input
+    dsalib_edge_t bad[] = {{0, 5}};
+    assert(dsalib_csr_graph_create(4, bad, 1) == NULL);
+    assert(dsalib_csr_graph_create(0, NULL, 0) == NULL);
+    graph = dsalib_csr_graph_create(3, NULL, 0);
+    assert(graph != NULL && graph->num_edges == 0);
+    dsalib_csr_graph_destroy(graph);
+    dsalib_csr_graph_destroy(NULL);
+    printf("  ✓ Test 2 passed: Out-of-range endpoints and empty graphs\n");
+
+    printf("All csr_graph tests passed!\n\n");
+}
+
+void test_topo_sort() {
+    printf("Testing topo_sort...\n");
+
+    // Test 1: Small DAG with a known level structure
+    dsalib_edge_t edges[] = {{0, 2}, {1, 2}, {2, 3}, {2, 4}, {3, 5}, {4, 5}};
+    dsalib_csr_graph_t* graph = dsalib_csr_graph_create(6, edges, 6);
+    uint32_t order[6];
+    assert(dsalib_topo_sort(graph, order) == 6);
+    assert(is_topological(graph, order));
+    size_t levels = 0;
+    assert(dsalib_topo_sort_parallel(graph, 4, order, &levels) == 6);
+    assert(is_topological(graph, order));
+    assert(levels == 4);
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 1 passed: Sequential and parallel orders respect every edge\n");
+
+    // Test 2: Cycle detection
+    dsalib_edge_t cyclic[] = {{0, 1}, {1, 2}, {2, 3}, {3, 1}, {4, 0}};
+    graph = dsalib_csr_graph_create(5, cyclic, 5);
+    assert(dsalib_topo_sort(graph, order) == 2);
+    assert(dsalib_topo_sort_parallel(graph, 2, order, NULL) == 2);
+    dsalib_edge_t self_loop[] = {{0, 0}};
+    dsalib_csr_graph_t* loop = dsalib_csr_graph_create(1, self_loop, 1);
+    assert(dsalib_topo_sort(loop, order) == 0);
+    dsalib_csr_graph_destroy(loop);
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 2 passed: Nodes on or behind a cycle are not ordered\n");
+
+    // Test 3: Large random DAG, wide enough to split levels across threads
+    size_t n = 200000;
+    graph = random_dag(n, 600000);
+    uint32_t* big = malloc(n * sizeof(uint32_t));
+    assert(dsalib_topo_sort(graph, big) == n);
+    assert(is_topological(graph, big));
+    for (size_t threads = 1; threads <= 8; threads *= 2) {
+        assert(dsalib_topo_sort_parallel(graph, threads, big, &levels) == n);
+        assert(is_topological(graph, big));
+        assert(levels > 1);
+    }
+    free(big);
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 3 passed: 200k-node DAG sorted on 1..8 threads\n");
+
+    // Test 4: NULL handling
+    assert(dsalib_topo_sort(NULL, order) == 0);
+    assert(dsalib_topo_sort_parallel(NULL, 2, order, &levels) == 0 && levels == 0);
+    printf("  ✓ Test 4 passed: NULL arguments\n");
+
+    printf("All topo_sort tests passed!\n\n");
+}
+
+void test_dag_execute() {
+    printf("Testing dag_execute...\n");
+
+    bool ok;
+    size_t runs, violations;
+
+    // Test 1: Every task runs once, after all of its predecessors
+    size_t n = 50000;
+    dsalib_csr_graph_t* graph = random_dag(n, 150000);
+    for (size_t threads = 1; threads <= 8; threads *= 2) {
+        run_checked(graph, threads, &ok, &runs, &violations);
+        assert(ok && runs == n && violations == 0);
+    }
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 1 passed: Dependencies respected on 1..8 threads\n");
+
+    // Test 2: Long chain plus a wide fan-out
+    dsalib_edge_t* edges = malloc(2000 * sizeof(dsalib_edge_t));
+    for (uint32_t i = 0; i < 1000; i++) {
+        edges[i].u = i;
+        edges[i].v = i + 1;
+        edges[1000 + i].u = 0;
+        edges[1000 + i].v = 1001 + i;
+    }
+    graph = dsalib_csr_graph_create(2001, edges, 2000);
+    run_checked(graph, 4, &ok, &runs, &violations);
+    assert(ok && runs == 2001 && violations == 0);
+    dsalib_csr_graph_destroy(graph);
+    free(edges);
+    printf("  ✓ Test 2 passed: Chains and fan-outs\n");
+
+    // Test 3: Cycles make the run fail without running the cycle
+    dsalib_edge_t cyclic[] = {{0, 1}, {1, 2}, {2, 1}, {0, 3}};
+    graph = dsalib_csr_graph_create(4, cyclic, 4);
+    run_checked(graph, 2, &ok, &runs, &violations);
+    assert(!ok && runs == 2 && violations == 0);
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 3 passed: Cycle reported, other nodes still run\n");
+
+    // Test 4: NULL handling
+    assert(!dsalib_dag_execute(NULL, 2, check_task, NULL));
+    graph = dsalib_csr_graph_create(1, NULL, 0);
+    assert(!dsalib_dag_execute(graph, 2, NULL, NULL));
+    dsalib_csr_graph_destroy(graph);
+    printf("  ✓ Test 4 passed: NULL arguments\n");
+
+    printf("All dag_execute tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Topological Sort Test Suite\n");
+    printf("================================\n\n");
+
+    srand(35);
+    test_csr_graph();
+    test_topo_sort();
+    test_dag_execute();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
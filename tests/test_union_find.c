@@ -0,0 +1,136 @@
+#include <dsalib/containers/union_find.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void test_union_find_basic() {
+    printf("Testing union_find basics...\n");
+
+    // Test 1: Create with singletons
+    dsalib_union_find_t* uf = dsalib_union_find_create(10);
+    assert(uf != NULL);
+    assert(dsalib_union_find_count_sets(uf) == 10);
+    for (size_t i = 0; i < 10; i++) {
+        assert(dsalib_union_find_find(uf, i) == i);
+        assert(dsalib_union_find_set_size(uf, i) == 1);
+    }
+    printf("  ✓ Test 1 passed: Every element starts in its own set\n");
+
+    // Test 2: Union and connected
+    assert(dsalib_union_find_union(uf, 0, 1));
+    assert(dsalib_union_find_union(uf, 2, 3));
+    assert(dsalib_union_find_union(uf, 1, 3));
+    assert(dsalib_union_find_connected(uf, 0, 2));
+    assert(!dsalib_union_find_connected(uf, 0, 4));
+    assert(dsalib_union_find_count_sets(uf) == 7);
+    assert(dsalib_union_find_set_size(uf, 3) == 4);
+    printf("  ✓ Test 2 passed: Union merges sets\n");
+
+    // Test 3: Redundant union returns false
+    assert(!dsalib_union_find_union(uf, 0, 3));
+    assert(dsalib_union_find_count_sets(uf) == 7);
+    printf("  ✓ Test 3 passed: Redundant union is rejected\n");
+
+    // Test 4: Invalid arguments
+    assert(dsalib_union_find_find(uf, 10) == SIZE_MAX);
+    assert(!dsalib_union_find_union(uf, 0, 10));
+    assert(!dsalib_union_find_connected(NULL, 0, 1));
+    assert(dsalib_union_find_count_sets(NULL) == 0);
+    assert(dsalib_union_find_create(0) == NULL);
+    dsalib_union_find_destroy(NULL);
+    printf("  ✓ Test 4 passed: Invalid arguments handled\n");
+
+    dsalib_union_find_destroy(uf);
+    printf("All union_find basic tests passed!\n\n");
+}
+
+void test_union_find_chain() {
+    printf("Testing union_find on a long chain...\n");
+
+    // Test 1: Chain 0-1-2-...-n-1 collapses into one set
+    const size_t n = 100000;
+    dsalib_union_find_t* uf = dsalib_union_find_create(n);
+    assert(uf != NULL);
+    for (size_t i = 1; i < n; i++) {
+        assert(dsalib_union_find_union(uf, i - 1, i));
+    }
+    assert(dsalib_union_find_count_sets(uf) == 1);
+    assert(dsalib_union_find_set_size(uf, 0) == n);
+    assert(dsalib_union_find_connected(uf, 0, n - 1));
+    printf("  ✓ Test 1 passed: %zu-element chain\n", n);
+
+    dsalib_union_find_destroy(uf);
+    printf("All union_find chain tests passed!\n\n");
+}
+
+void test_concurrent_union_find() {
+    printf("Testing concurrent_union_find...\n");
+
+    // Test 1: Sequential semantics match the plain version
+    dsalib_concurrent_union_find_t* cuf = dsalib_concurrent_union_find_create(8);
+    assert(cuf != NULL);
+    assert(dsalib_concurrent_union_find_union(cuf, 0, 1));
+    assert(dsalib_concurrent_union_find_union(cuf, 1, 2));
+    assert(!dsalib_concurrent_union_find_union(cuf, 0, 2));
+    assert(dsalib_concurrent_union_find_connected(cuf, 0, 2));
+    assert(!dsalib_concurrent_union_find_connected(cuf, 0, 3));
+    assert(dsalib_concurrent_union_find_count_sets(cuf) == 6);
+    assert(dsalib_concurrent_union_find_find(cuf, 8) == SIZE_MAX);
+    dsalib_concurrent_union_find_destroy(cuf);
+    printf("  ✓ Test 1 passed: Single-threaded operations\n");
+
+    // Test 2: Multi-threaded edge unions agree with the sequential version
+    const size_t n = 50000;
+    const size_t m = 40000;
+    dsalib_edge_t* edges = malloc(m * sizeof(dsalib_edge_t));
+    for (size_t i = 0; i < m; i++) {
+        edges[i].u = (uint32_t)(rand() % n);
+        edges[i].v = (uint32_t)(rand() % n);
+    }
+    dsalib_union_find_t* uf = dsalib_union_find_create(n);
+    for (size_t i = 0; i < m; i++) {
+        dsalib_union_find_union(uf, edges[i].u, edges[i].v);
+    }
+    cuf = dsalib_concurrent_union_find_create(n);
+    assert(dsalib_concurrent_union_find_union_edges(cuf, edges, m, 4));
+    assert(dsalib_concurrent_union_find_count_sets(cuf) == dsalib_union_find_count_sets(uf));
+    for (size_t i = 0; i < m; i++) {
+        assert(dsalib_concurrent_union_find_connected(cuf, edges[i].u, edges[i].v));
+    }
+    printf("  ✓ Test 2 passed: 4-thread unions match sequential result\n");
+
+    // Test 3: Connected component labels
+    uint32_t* labels = malloc(n * sizeof(uint32_t));
+    size_t components = dsalib_connected_components(n, edges, m, 4, labels);
+    assert(components == dsalib_union_find_count_sets(uf));
+    for (size_t i = 0; i < n; i++) {
+        size_t j = (size_t)rand() % n;
+        assert((labels[i] == labels[j]) == dsalib_union_find_connected(uf, i, j));
+        assert(labels[labels[i]] == labels[i]);
+    }
+    printf("  ✓ Test 3 passed: Parallel connected components\n");
+
+    free(labels);
+    free(edges);
+    dsalib_union_find_destroy(uf);
+    dsalib_concurrent_union_find_destroy(cuf);
+    printf("All concurrent_union_find tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Union-Find Test Suite\n");
+    printf("================================\n\n");
+
+    srand(27);
+    test_union_find_basic();
+    test_union_find_chain();
+    test_concurrent_union_find();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <dsalib/containers/vector.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int int_at(dsalib_vector_t* vec, size_t index) {
+    return *(int*)dsalib_vector_at(vec, index);
+}
+
+void test_vector_basic() {
+    printf("Testing vector basic operations...\n");
+
+    // Test 1: Short vectors stay inline
+    dsalib_vector_t vec;
+    assert(dsalib_vector_init(&vec, sizeof(int), DSALIB_VECTOR_GROW_2X));
+    for (int i = 0; i < 16; i++) {
+        assert(dsalib_vector_push_back(&vec, &i));
+    }
+    assert(dsalib_vector_is_inline(&vec));
+    assert(dsalib_vector_size(&vec) == 16 && dsalib_vector_capacity(&vec) == 16);
+    printf("  ✓ Test 1 passed: 16 ints fit in the inline buffer\n");
+
+    // Test 2: Spilling to the heap keeps the contents
+    for (int i = 16; i < 1000; i++) {
+        assert(dsalib_vector_push_back(&vec, &i));
+    }
+    assert(!dsalib_vector_is_inline(&vec));
+    for (int i = 0; i < 1000; i++) {
+        assert(int_at(&vec, (size_t)i) == i);
+    }
+    assert(dsalib_vector_at(&vec, 1000) == NULL);
+    printf("  ✓ Test 2 passed: Growth past the inline buffer\n");
+
+    // Test 3: Pop back and shrink back inline
+    int value;
+    while (dsalib_vector_size(&vec) > 10) {
+        assert(dsalib_vector_pop_back(&vec, &value));
+        assert(value == (int)dsalib_vector_size(&vec));
+    }
+    assert(dsalib_vector_shrink_to_fit(&vec));
+    assert(dsalib_vector_is_inline(&vec));
+    assert(int_at(&vec, 9) == 9);
+    dsalib_vector_release(&vec);
+    assert(dsalib_vector_size(&vec) == 0 && dsalib_vector_is_inline(&vec));
+    printf("  ✓ Test 3 passed: Pop back, shrink_to_fit returns inline\n");
+
+    // Test 4: Growth policies
+    dsalib_vector_t fast, slow;
+    dsalib_vector_init(&fast, sizeof(double), DSALIB_VECTOR_GROW_2X);
+    dsalib_vector_init(&slow, sizeof(double), DSALIB_VECTOR_GROW_1_5X);
+    assert(dsalib_vector_capacity(&fast) == 8);
+    for (int i = 0; i < 9; i++) {
+        double d = i;
+        dsalib_vector_push_back(&fast, &d);
+        dsalib_vector_push_back(&slow, &d);
+    }
+    assert(dsalib_vector_capacity(&fast) == 16);
+    assert(dsalib_vector_capacity(&slow) == 12);
+    assert(*(double*)dsalib_vector_at(&slow, 8) == 8.0);
+    dsalib_vector_release(&fast);
+    dsalib_vector_release(&slow);
+    printf("  ✓ Test 4 passed: 2x and 1.5x growth\n");
+
+    printf("All vector basic tests passed!\n\n");
+}
+
+void test_vector_ranges() {
+    printf("Testing vector ranges...\n");
+
+    // Test 5: Insert and erase ranges
+    dsalib_vector_t* vec = dsalib_vector_create(sizeof(int), DSALIB_VECTOR_GROW_1_5X);
+    int values[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int middle[] = {100, 101, 102};
+    assert(dsalib_vector_insert(vec, 0, values, 10));
+    assert(dsalib_vector_insert(vec, 5, middle, 3));
+    assert(dsalib_vector_size(vec) == 13);
+    assert(int_at(vec, 4) == 4 && int_at(vec, 5) == 100 && int_at(vec, 7) == 102 && int_at(vec, 8) == 5);
+    assert(dsalib_vector_erase(vec, 5, 3));
+    for (int i = 0; i < 10; i++) {
+        assert(int_at(vec, (size_t)i) == i);
+    }
+    assert(!dsalib_vector_insert(vec, 11, values, 1));
+    assert(!dsalib_vector_erase(vec, 8, 3));
+    assert(dsalib_vector_erase(vec, 10, 0));
+    printf("  ✓ Test 5 passed: Insert and erase ranges\n");
+
+    // Test 6: Swap remove
+    int removed;
+    assert(dsalib_vector_swap_remove(vec, 2, &removed));
+    assert(removed == 2 && int_at(vec, 2) == 9 && dsalib_vector_size(vec) == 9);
+    assert(dsalib_vector_swap_remove(vec, 8, NULL));
+    assert(dsalib_vector_size(vec) == 8 && int_at(vec, 7) == 7);
+    assert(!dsalib_vector_swap_remove(vec, 8, NULL));
+    printf("  ✓ Test 6 passed: Swap remove\n");
+
+    dsalib_vector_destroy(vec);
+    printf("All vector range tests passed!\n\n");
+}
+
+void test_vector_ownership() {
+    printf("Testing vector ownership transfer...\n");
+
+    // Test 7: Adopt a malloc'ed buffer without copying
+    int* buffer = malloc(100 * sizeof(int));
+    for (int i = 0; i < 50; i++) {
+        buffer[i] = i * i;
+    }
+    dsalib_vector_t vec;
+    dsalib_vector_init(&vec, sizeof(int), DSALIB_VECTOR_GROW_2X);
+    assert(dsalib_vector_adopt(&vec, buffer, 50, 100));
+    assert(dsalib_vector_data(&vec) == buffer && dsalib_vector_capacity(&vec) == 100);
+    assert(!dsalib_vector_adopt(&vec, buffer, 101, 100));
+    printf("  ✓ Test 7 passed: Adopt\n");
+
+    // Test 8: Detach hands the same buffer back
+    size_t size, capacity;
+    int* out = dsalib_vector_detach(&vec, &size, &capacity);
+    assert(out == buffer && size == 50 && capacity == 100 && out[7] == 49);
+    assert(dsalib_vector_size(&vec) == 0 && dsalib_vector_is_inline(&vec));
+    free(out);
+
+    int three = 3;
+    dsalib_vector_push_back(&vec, &three);
+    out = dsalib_vector_detach(&vec, &size, &capacity);
+    assert(out != NULL && out[0] == 3 && size == 1 && capacity == 1);
+    free(out);
+    assert(dsalib_vector_detach(&vec, NULL, NULL) == NULL);
+    printf("  ✓ Test 8 passed: Detach heap and inline vectors\n");
+
+    // Test 9: Swap and move by assignment
+    dsalib_vector_t a, b;
+    dsalib_vector_init(&a, sizeof(int), DSALIB_VECTOR_GROW_2X);
+    dsalib_vector_init(&b, sizeof(int), DSALIB_VECTOR_GROW_2X);
+    for (int i = 0; i < 40; i++) {
+        dsalib_vector_push_back(&a, &i);
+    }
+    dsalib_vector_push_back(&b, &three);
+    assert(dsalib_vector_swap(&a, &b));
+    assert(dsalib_vector_size(&a) == 1 && int_at(&a, 0) == 3);
+    assert(dsalib_vector_size(&b) == 40 && int_at(&b, 39) == 39);
+    dsalib_vector_t moved = a;
+    assert(int_at(&moved, 0) == 3);
+    dsalib_vector_release(&b);
+    dsalib_vector_release(&moved);
+    printf("  ✓ Test 9 passed: Swap and move by assignment\n");
+
+    // Test 10: NULL handling
+    assert(!dsalib_vector_init(NULL, 4, DSALIB_VECTOR_GROW_2X));
+    assert(!dsalib_vector_init(&vec, 0, DSALIB_VECTOR_GROW_2X));
+    assert(dsalib_vector_create(0, DSALIB_VECTOR_GROW_2X) == NULL);
+    assert(dsalib_vector_size(NULL) == 0 && dsalib_vector_capacity(NULL) == 0);
+    assert(!dsalib_vector_push_back(NULL, &three));
+    assert(!dsalib_vector_pop_back(NULL, NULL));
+    assert(dsalib_vector_at(NULL, 0) == NULL);
+    dsalib_vector_release(NULL);
+    dsalib_vector_destroy(NULL);
+    printf("  ✓ Test 10 passed: NULL handled gracefully\n");
+
+    printf("All vector ownership tests passed!\n\n");
+}
+
+int main() {
+    printf("================================\n");
+    printf("Vector Test Suite\n");
+    printf("================================\n\n");
+
+    test_vector_basic();
+    test_vector_ranges();
+    test_vector_ownership();
+
+    printf("================================\n");
+    printf("All tests passed successfully!\n");
+    printf("================================\n");
+
+    return 0;
+}